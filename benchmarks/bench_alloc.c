@@ -0,0 +1,104 @@
+/* File        : bench_alloc.c
+* Deskripsi   : Implementasi penghitung alokasi untuk program benchmark.
+*               Blok dari allocator yang dibungkus diawali header 16 byte berisi ukuran
+*               dan penanda (magic). Pointer yang dialokasikan di luar pembungkus (misalnya
+*               oleh fungsi libc yang memanggil malloc secara internal) tidak memiliki
+*               penanda tersebut dan diteruskan apa adanya ke allocator asli.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "bench_alloc.h"
+#include <stdint.h>
+
+#define BENCH_ALLOC_HEADER_SIZE 16
+#define BENCH_ALLOC_MAGIC 0x5A17C0DEu
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+/* Header di depan setiap blok yang dilacak. Ukurannya tetap 16 byte agar alignment
+   pointer yang dikembalikan sama dengan milik allocator asli. */
+typedef union {
+    struct {
+        size_t size;
+        uint32_t magic;
+    } info;
+    unsigned char raw[BENCH_ALLOC_HEADER_SIZE];
+} AllocHeader;
+
+static BenchAllocStats stats = {0};
+
+// Mengembalikan header milik 'ptr', atau NULL jika 'ptr' tidak dialokasikan lewat pembungkus.
+static AllocHeader *GetHeader(void *ptr) {
+    if (ptr == NULL) return NULL;
+    AllocHeader *header = (AllocHeader *)((unsigned char *)ptr - BENCH_ALLOC_HEADER_SIZE);
+    return header->info.magic == BENCH_ALLOC_MAGIC ? header : NULL;
+}
+
+// Mencatat blok baru berukuran 'size' pada 'base' dan mengembalikan pointer untuk pemanggil.
+static void *TrackBlock(void *base, size_t size) {
+    if (base == NULL) return NULL;
+    AllocHeader *header = (AllocHeader *)base;
+    header->info.size = size;
+    header->info.magic = BENCH_ALLOC_MAGIC;
+    stats.liveBytes += size;
+    if (stats.liveBytes > stats.peakBytes) stats.peakBytes = stats.liveBytes;
+    return (unsigned char *)base + BENCH_ALLOC_HEADER_SIZE;
+}
+
+void *__wrap_malloc(size_t size) {
+    stats.allocCount++;
+    stats.totalBytes += size;
+    return TrackBlock(__real_malloc(size + BENCH_ALLOC_HEADER_SIZE), size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    if (size != 0 && count > (SIZE_MAX - BENCH_ALLOC_HEADER_SIZE) / size) return NULL;
+    size_t bytes = count * size;
+    stats.allocCount++;
+    stats.totalBytes += bytes;
+    return TrackBlock(__real_calloc(1, bytes + BENCH_ALLOC_HEADER_SIZE), bytes);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    if (ptr == NULL) return __wrap_malloc(size);
+
+    AllocHeader *header = GetHeader(ptr);
+    stats.allocCount++;
+    stats.totalBytes += size;
+    if (header == NULL) return __real_realloc(ptr, size);
+
+    size_t oldSize = header->info.size;
+    void *base = __real_realloc(header, size + BENCH_ALLOC_HEADER_SIZE);
+    if (base == NULL) return NULL; // Blok lama tetap utuh dan tetap terhitung.
+    stats.liveBytes -= oldSize;
+    return TrackBlock(base, size);
+}
+
+void __wrap_free(void *ptr) {
+    if (ptr == NULL) return;
+    stats.freeCount++;
+
+    AllocHeader *header = GetHeader(ptr);
+    if (header == NULL) {
+        __real_free(ptr);
+        return;
+    }
+    stats.liveBytes -= header->info.size;
+    header->info.magic = 0;
+    __real_free(header);
+}
+
+/* Mengirimkan salinan statistik allocator saat ini. */
+BenchAllocStats BenchAlloc_GetStats(void) {
+    return stats;
+}
+
+/* I.S. : peakBytes berisi puncak sebelumnya.
+   F.S. : peakBytes diatur sama dengan liveBytes saat ini. */
+void BenchAlloc_ResetPeak(void) {
+    stats.peakBytes = stats.liveBytes;
+}
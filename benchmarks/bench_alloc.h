@@ -0,0 +1,33 @@
+/* File        : bench_alloc.h
+* Deskripsi   : Deklarasi penghitung alokasi untuk program benchmark.
+*               malloc/calloc/realloc/free dibungkus melalui opsi linker
+*               -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free sehingga
+*               setiap alokasi di seluruh program (termasuk raylib) ikut terhitung.
+*               Setiap blok diberi header kecil berisi ukurannya agar byte yang masih
+*               hidup dan puncaknya dapat dilacak.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef BENCH_ALLOC_H
+#define BENCH_ALLOC_H
+
+#include <stddef.h>
+
+/* Statistik kumulatif allocator sejak program dimulai. */
+typedef struct {
+    size_t allocCount;   // Jumlah panggilan malloc/calloc/realloc
+    size_t freeCount;    // Jumlah panggilan free dengan pointer non-NULL
+    size_t totalBytes;   // Total byte yang diminta
+    size_t liveBytes;    // Byte yang sedang teralokasi
+    size_t peakBytes;    // Puncak liveBytes sejak BenchAlloc_ResetPeak terakhir
+} BenchAllocStats;
+
+/* Mengirimkan salinan statistik allocator saat ini. */
+BenchAllocStats BenchAlloc_GetStats(void);
+
+/* I.S. : peakBytes berisi puncak sebelumnya.
+   F.S. : peakBytes diatur sama dengan liveBytes saat ini. */
+void BenchAlloc_ResetPeak(void);
+
+#endif
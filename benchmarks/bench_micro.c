@@ -0,0 +1,623 @@
+/* File        : bench_micro.c
+* Deskripsi   : Micro-benchmark untuk kernel inti gameplay (pergerakan musuh, serangan
+*               tower, pencarian target chain, pembentukan jalur, validasi rute editor,
+*               wave, shot, dan lookup pohon upgrade). Fixture dibuat secara sintetis: peta berbentuk
+*               jalur ular (serpentine), N musuh tersebar di sepanjang jalur, dan M tower
+*               di slot tower yang ada, dengan satu preset per kombinasi upgrade.
+*               Setiap kernel dilaporkan dalam ns/op dan jumlah alokasi per op.
+*               Alokasi dihitung oleh bench_alloc.c (lihat task "build micro benchmarks").
+*
+*               Pemakaian: bench_micro [--enemies N] [--towers M] [--map-size S]
+*               Jalankan dari direktori akar proyek agar aset dapat dimuat.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "common.h"
+#include "raymath.h"
+#include "enemy.h"
+#include "map.h"
+#include "path_cache.h"
+#include "flow_field.h"
+#include "path_validator.h"
+#include "maze.h"
+#include "enemy_kernel.h"
+#include "event_scheduler.h"
+#include "wave_script.h"
+#include "tower.h"
+#include "upgrade_tree.h"
+#include "player_resources.h"
+#include "status.h"
+#include "bench_alloc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_MIN_SECONDS 0.25      // Waktu terukur minimum per benchmark
+#define BENCH_MAX_BATCHES 100000
+#define BENCH_FRAME_DT (1.0f / 60.0f)
+#define BENCH_ENEMY_HP 1000000000   // Cukup besar agar tidak ada musuh yang mati selama pengukuran
+#define BENCH_ENEMY_SPEED 40.0f
+#define BENCH_PATH_FILL 0.8f        // Musuh hanya ditempatkan di 80% awal jalur agar tidak mencapai ujung
+#define BENCH_SHOT_COUNT 50         // Jumlah proyektil fixture UpdateShots
+#define BENCH_MAZE_PLACEMENTS 100   // Tower yang dipasang berturut-turut per batch Maze/PlaceQueryPlace
+
+/* --- Preset kombinasi upgrade tower --- */
+
+/* Satu kombinasi upgrade: jalur root -> tier 2 -> tier 3 yang dibeli setiap tower fixture.
+   Stat tower dihitung oleh pohon upgrade itu sendiri, bukan disalin ke sini. */
+typedef struct {
+    const char *name;
+    UpgradeType path[3];    // Diakhiri UPGRADE_NONE jika jalurnya lebih pendek
+} TowerPreset;
+
+static const TowerPreset towerPresets[] = {
+    { "plain",              { UPGRADE_NONE } },
+    { "lightning+stun",     { UPGRADE_ATTACK_SPEED_BASE, UPGRADE_LIGHTNING_ATTACK, UPGRADE_STUN_EFFECT } },
+    { "chain+wide_range",   { UPGRADE_ATTACK_SPEED_BASE, UPGRADE_CHAIN_ATTACK, UPGRADE_WIDE_CHAIN_RANGE } },
+    { "aoe+large_radius",   { UPGRADE_ATTACK_POWER_BASE, UPGRADE_AREA_ATTACK, UPGRADE_LARGE_AOE_RADIUS } },
+    { "critical+high_crit", { UPGRADE_ATTACK_POWER_BASE, UPGRADE_CRITICAL_ATTACK, UPGRADE_HIGH_CRIT_CHANCE } },
+    { "mass_slow",          { UPGRADE_SPECIAL_EFFECT_BASE, UPGRADE_MASS_SLOW } },
+};
+#define TOWER_PRESET_COUNT ((int)(sizeof(towerPresets) / sizeof(towerPresets[0])))
+
+/* --- State fixture --- */
+
+static int fixtureEnemyCount = 200;
+static int fixtureTowerCount = 40;
+static int fixtureMapSize = 64;
+static EnemyWave *fixtureWave = NULL;
+static const SpawnPoint fixtureSpawn = {1, 1};
+static const MapPath *fixtureRoute = NULL;
+static RouteTable scratchRoutes = {0};
+static Enemy *enemySnapshot = NULL;
+static EnemyKinematics kinematicsSnapshot = {0};
+static EnemyKernelEvents benchEvents = {0};
+static Tower *firstTower = NULL;
+static int chainCursor = 0;
+static int lookupCursor = 0;
+static SpawnPoint flowToggleTile = {-1, -1};
+static TileGrid validatorGrid = {0};
+static SpawnPoint validatorToggleTile = {-1, -1};
+static int validatorToggleValue = 0;
+static int mazeCursor = 0;
+static SpawnPoint mazePlaced[BENCH_MAZE_PLACEMENTS];
+static int mazePlacedCount = 0;
+static int mazePlaceCursor = 0;
+
+// Mengisi 'grid' dengan peta serpentine berukuran size x size: baris jalur setiap 3 baris,
+// dihubungkan bergantian di ujung kanan dan kiri. Baris di antaranya adalah slot tower.
+// Mengembalikan baris jalur terakhir, atau -1 jika alokasi gagal.
+static int FillSerpentineGrid(TileGrid *grid, int size) {
+    if (!CreateTileGrid(grid, size, size)) return -1;
+
+    int lastPathRow = 1;
+    for (int r = 1; r < size - 1; r += 3) {
+        for (int c = 1; c < size - 1; c++) {
+            SetGridTile(grid, r, c, 1);
+        }
+        lastPathRow = r;
+    }
+    bool connectRight = true;
+    for (int r = 1; r + 3 <= lastPathRow; r += 3) {
+        int c = connectRight ? size - 2 : 1;
+        SetGridTile(grid, r + 1, c, 1);
+        SetGridTile(grid, r + 2, c, 1);
+        connectRight = !connectRight;
+    }
+    for (int r = 1; r < size - 1; r++) {
+        for (int c = 1; c < size - 1; c++) {
+            if (GetGridTile(grid, r, c) == 0 && r <= lastPathRow) {
+                SetGridTile(grid, r, c, 4);
+            }
+        }
+    }
+    return lastPathRow;
+}
+
+// Membuat peta serpentine berukuran size x size sebagai gameMap.
+static bool BuildSerpentineMap(int size) {
+    TileGrid grid = {0};
+    int lastPathRow = FillSerpentineGrid(&grid, size);
+    if (lastPathRow < 0) return false;
+    SetGridTile(&grid, lastPathRow, size - 1, 1);   // Exit di tepi kanan ujung baris jalur terakhir
+
+    bool ok = LoadGameMapFromGrid(&grid);
+    FreeTileGrid(&grid);
+    return ok;
+}
+
+// Menyebar musuh fixture di sepanjang jalur dan menyimpan salinannya untuk reset.
+static void SpawnFixtureEnemies(void) {
+    Enemy template = fixtureWave->enemiesToSpawnInThisWave > 0 ? BuildWaveEnemy(fixtureWave, 0) : (Enemy){0};
+    template.parentWave = fixtureWave;
+    template.maxHp = BENCH_ENEMY_HP;
+    template.baseSpeed = BENCH_ENEMY_SPEED;
+    template.routeId = 0;
+    float usableLength = fixtureRoute->totalLength * BENCH_PATH_FILL;
+
+    Enemies_DeactivateAll();
+    for (int i = 0; i < fixtureEnemyCount; i++) {
+        SpawnEnemy(&template);
+        Enemy *e = &allActiveEnemies[i];
+        enemyKinematics.distance[i] = usableLength * i / fixtureEnemyCount;
+        e->position = GetMapPathPosition(fixtureRoute, enemyKinematics.distance[i], &e->segment);
+    }
+    memcpy(enemySnapshot, allActiveEnemies, sizeof(Enemy) * maxTotalActiveEnemies);
+    CopyEnemyKinematics(&kinematicsSnapshot, &enemyKinematics);
+}
+
+// Mengembalikan semua musuh ke keadaan fixture awal. Event stun dari pass sebelumnya dibuang
+// agar heap scheduler tidak terus membesar selama benchmark.
+static void RestoreEnemies(void) {
+    Scheduler_Reset();
+    memcpy(allActiveEnemies, enemySnapshot, sizeof(Enemy) * maxTotalActiveEnemies);
+    CopyEnemyKinematics(&enemyKinematics, &kinematicsSnapshot);
+    totalActiveEnemiesCount = fixtureEnemyCount;
+}
+
+// Menempatkan tower di slot yang tersebar merata di seluruh peta.
+static void PlaceFixtureTowers(void) {
+    int slotCount = 0;
+    for (int r = 0; r < GetMapRows(); r++)
+        for (int c = 0; c < GetMapCols(); c++)
+            if (GetMapTile(r, c) == 4) slotCount++;
+
+    int step = fixtureTowerCount > 0 && slotCount > fixtureTowerCount ? slotCount / fixtureTowerCount : 1;
+    int slot = 0;
+    int placed = 0;
+    SetMoney(50 * (fixtureTowerCount + 1));
+    for (int r = 0; r < GetMapRows() && placed < fixtureTowerCount; r++) {
+        for (int c = 0; c < GetMapCols() && placed < fixtureTowerCount; c++) {
+            if (GetMapTile(r, c) != 4) continue;
+            if (slot++ % step != 0) continue;
+            PlaceTower(r, c, TOWER_TYPE_1);
+            placed++;
+        }
+    }
+    fixtureTowerCount = placed;
+    firstTower = towersListHead;
+}
+
+// Tower pertama dipakai untuk lookup pohon upgrade; beri jalur kecepatan -> berantai.
+static void MarkLookupTower(void) {
+    if (!firstTower) return;
+    MarkTowerUpgrade(firstTower, UPGRADE_ATTACK_SPEED_BASE);
+    MarkTowerUpgrade(firstTower, UPGRADE_CHAIN_ATTACK);
+    RefreshTowerStats(firstTower);
+}
+
+// Mengembalikan musuh dan mengosongkan slot shot sebelum satu pass serangan.
+static void ResetAttackFixture(void) {
+    RestoreEnemies();
+    InitShots();
+}
+
+/* I.S. : Tower fixture mungkin sudah membeli upgrade lain.
+   F.S. : Upgrade lama semua tower fixture dilepas, jalur 'preset' dibeli, dan stat setiap
+          tower dihitung ulang dari pohon upgrade. */
+static void ApplyTowerPreset(const TowerPreset *preset) {
+    int steps = (int)(sizeof(preset->path) / sizeof(preset->path[0]));
+    for (Tower *t = towersListHead; t != NULL; t = (Tower *)t->next) {
+        FreeTowerUpgrades(t);
+        for (int i = 0; i < steps && preset->path[i] != UPGRADE_NONE; i++) {
+            if (!MarkTowerUpgrade(t, preset->path[i])) {
+                TraceLog(LOG_ERROR, "BENCH: Preset %s: upgrade %d is not in the upgrade tree.", preset->name, preset->path[i]);
+            }
+        }
+        RefreshTowerStats(t);
+    }
+}
+
+// Mengisi pool shot dengan proyektil yang belum sampai agar UpdateShots bekerja penuh.
+static void FillShots(void) {
+    InitShots();
+    for (int i = 0; i < BENCH_SHOT_COUNT; i++) {
+        SpawnProjectile((Vector2){0, 0}, (Vector2){100, 100}, RAYWHITE, 3.0f, 1.0e6f);
+    }
+}
+
+/* --- Operasi yang diukur --- */
+
+static void OpEnemiesUpdate(void) {
+    Enemies_Update(BENCH_FRAME_DT);
+}
+
+static void OpMovementKernel(void) {
+    RunEnemyMovementKernel(&enemyKinematics, BENCH_FRAME_DT, &benchEvents);
+}
+
+// Satu op = satu pass serangan di mana semua tower siap menembak.
+static void OpTowerAttacks(void) {
+    for (Tower *t = towersListHead; t != NULL; t = (Tower *)t->next) {
+        t->attackCooldown = 0.0f;
+    }
+    UpdateTowerAttacks(fixtureWave, BENCH_FRAME_DT);
+}
+
+static void OpFindNextChainTarget(void) {
+    Enemy *target = &allActiveEnemies[chainCursor];
+    Enemy *excluded[1] = { target };
+    volatile Enemy *next = FindNextChainTarget(target, excluded, 1, 150.0f);
+    (void)next;
+    chainCursor = (chainCursor + 1) % fixtureEnemyCount;
+}
+
+static void OpBuildRouteTable(void) {
+    BuildRouteTable(&scratchRoutes, &fixtureSpawn, 1);
+}
+
+static void OpPathCacheAcquire(void) {
+    PathCache_Release(PathCache_Acquire(&fixtureSpawn, 1));
+}
+
+static void OpFlowFieldBuild(void) {
+    FlowField_Build(&fixtureSpawn, 1);
+}
+
+// Memasang lalu melepas tower di slot kosong; setiap perubahan memperbaiki flow field secara inkremental.
+static void OpFlowFieldToggleTile(void) {
+    SetMapTile(flowToggleTile.row, flowToggleTile.col, 7);
+    SetMapTile(flowToggleTile.row, flowToggleTile.col, 4);
+}
+
+// Menanyakan apakah tile jalan berikutnya boleh ditutup tower; analisis cut vertex sudah di-cache.
+static void OpMazeQuery(void) {
+    int cells = fixtureMapSize * fixtureMapSize;
+    volatile bool blocked = Maze_WouldBlockSpawns(mazeCursor / fixtureMapSize, mazeCursor % fixtureMapSize);
+    (void)blocked;
+    mazeCursor = (mazeCursor + 1) % cells;
+}
+
+// Pertanyaan yang sama setelah peta berubah (tower dipasang lalu dijual), sehingga analisis dibangun ulang.
+static void OpMazeQueryAfterChange(void) {
+    OpFlowFieldToggleTile();
+    OpMazeQuery();
+}
+
+// Seperti klik pemain: mencari slot kosong berikutnya, menanyakan apakah boleh ditutup, lalu
+// memasang tower di sana. Setiap pemasangan mengubah revisi peta, jadi pertanyaan berikutnya
+// menganalisis ulang seluruh peta sekali.
+static void OpMazePlaceQueryPlace(void) {
+    int cells = fixtureMapSize * fixtureMapSize;
+    for (int i = 0; i < cells && mazePlacedCount < BENCH_MAZE_PLACEMENTS; i++) {
+        int row = mazePlaceCursor / fixtureMapSize;
+        int col = mazePlaceCursor % fixtureMapSize;
+        mazePlaceCursor = (mazePlaceCursor + 1) % cells;
+        if (GetMapTile(row, col) != 4 || Maze_WouldBlockSpawns(row, col)) continue;
+        SetMapTile(row, col, 7);
+        mazePlaced[mazePlacedCount++] = (SpawnPoint){row, col};
+        return;
+    }
+}
+
+// Menjual semua tower dari OpMazePlaceQueryPlace lalu membangun ulang analisis di luar pengukuran.
+static void ResetMazePlacements(void) {
+    while (mazePlacedCount > 0) {
+        mazePlacedCount--;
+        SetMapTile(mazePlaced[mazePlacedCount].row, mazePlaced[mazePlacedCount].col, 4);
+    }
+    mazePlaceCursor = 0;
+    Maze_WouldBlockSpawns(fixtureSpawn.row, fixtureSpawn.col);
+}
+
+// Memilih slot tower kosong pertama sebagai tile yang diblokir dan dibuka pada peta flow field.
+static bool SetupFlowFieldFixture(void) {
+    for (int r = 0; r < fixtureMapSize && flowToggleTile.row < 0; r++) {
+        for (int c = 0; c < fixtureMapSize; c++) {
+            if (GetMapTile(r, c) == 4) {
+                flowToggleTile = (SpawnPoint){r, c};
+                break;
+            }
+        }
+    }
+    return flowToggleTile.row >= 0 && FlowField_Build(&fixtureSpawn, 1);
+}
+
+// Membuat grid serpentine untuk validator editor dengan exit di ujung baris jalur terakhir.
+static bool SetupValidatorFixture(int size) {
+    int lastPathRow = FillSerpentineGrid(&validatorGrid, size);
+    if (lastPathRow < 0) return false;
+    SetGridTile(&validatorGrid, lastPathRow, size - 1, 1);
+    return PathValidator_Rebuild(&validatorGrid, &fixtureSpawn, 1, false);
+}
+
+// Memilih tile yang diubah bolak-balik: slot tower di samping jalur (dicat menjadi jalan) atau
+// tile jalur di tengah rute (dihapus sehingga rute terputus).
+static void SelectValidatorToggle(bool cutRoute) {
+    int size = validatorGrid.rows;
+    int row = cutRoute ? (size / 6) * 3 + 1 : 2;
+    validatorToggleTile = (SpawnPoint){row, size / 2};
+    validatorToggleValue = cutRoute ? 0 : 1;
+}
+
+// Satu drag editor dengan perbaikan penuh: tile diubah lalu dikembalikan, validator dibangun ulang setiap kali.
+static void OpValidatorFullRebuild(void) {
+    int row = validatorToggleTile.row;
+    int col = validatorToggleTile.col;
+    int original = GetGridTile(&validatorGrid, row, col);
+    SetGridTile(&validatorGrid, row, col, validatorToggleValue);
+    PathValidator_Rebuild(&validatorGrid, &fixtureSpawn, 1, false);
+    SetGridTile(&validatorGrid, row, col, original);
+    PathValidator_Rebuild(&validatorGrid, &fixtureSpawn, 1, false);
+}
+
+// Perubahan yang sama dengan OpValidatorFullRebuild, tetapi diperbaiki secara inkremental (LPA*).
+static void OpValidatorIncremental(void) {
+    int row = validatorToggleTile.row;
+    int col = validatorToggleTile.col;
+    int original = GetGridTile(&validatorGrid, row, col);
+    SetGridTile(&validatorGrid, row, col, validatorToggleValue);
+    PathValidator_OnTileChanged(row, col);
+    SetGridTile(&validatorGrid, row, col, original);
+    PathValidator_OnTileChanged(row, col);
+}
+
+static void OpCreateFreeWave(void) {
+    EnemyWave *wave = CreateWave(&fixtureSpawn, 1);
+    FreeWave(&wave);
+}
+
+static void OpUpdateShots(void) {
+    UpdateShots(BENCH_FRAME_DT);
+}
+
+static void OpFindNodeByType(void) {
+    UpgradeType type = (UpgradeType)(UPGRADE_ATTACK_SPEED_BASE + lookupCursor);
+    volatile UpgradeNode *node = FindNodeByType(GetUpgradeTreeRoot(&tower1UpgradeTree), type);
+    (void)node;
+    lookupCursor = (lookupCursor + 1) % (UPGRADE_HIGH_CRIT_CHANCE - UPGRADE_ATTACK_SPEED_BASE + 1);
+}
+
+static void OpFindCurrentUpgradeNode(void) {
+    volatile UpgradeNode *node = FindCurrentUpgradeNode(firstTower);
+    (void)node;
+}
+
+static void OpUpdateUpgradeTreeStatus(void) {
+    UpdateUpgradeTreeStatus(&tower1UpgradeTree, firstTower);
+}
+
+static void OpGetTowerStats(void) {
+    volatile const TowerStats *stats = GetTowerStats(firstTower->upgradeBits, firstTower->upgradeBitWords);
+    (void)stats;
+}
+
+/* --- Pemeriksaan aturan exit --- */
+
+/* Satu peta kecil untuk memeriksa bahwa tabel rute gameplay dan validator editor sepakat. */
+typedef struct {
+    const char *name;
+    const char *rows[5];        // '1' = jalan, 'S' = titik awal, karakter lain = kosong
+} ExitRuleCase;
+
+static const ExitRuleCase exitRuleCases[] = {
+    { "edge_to_edge",          { "..S..", "..1..", "..1..", "..1..", "..1.." } },
+    { "inner_dead_end_only",   { ".....", ".S11.", "...1.", "...1.", "....." } },
+    { "edge_then_inner_branch",{ "..S..", "..1..", "1111.", "..1..", "....." } },
+    { "edge_spawn_dead_end",   { "..S..", "..1..", "..11.", ".....", "....." } },
+};
+#define EXIT_RULE_CASE_COUNT ((int)(sizeof(exitRuleCases) / sizeof(exitRuleCases[0])))
+
+/* I.S. : Aset peta sudah dimuat; gameMap boleh berisi apa saja.
+   F.S. : Setiap kasus di exitRuleCases dimuat sebagai gameMap dan grid validator. Mengembalikan
+          false (dengan log) jika ada titik awal yang dianggap terhubung oleh salah satu modul
+          tetapi tidak oleh modul lainnya. gameMap harus dimuat ulang setelahnya. */
+static bool CheckExitRuleAgreement(void) {
+    bool agree = true;
+    for (int c = 0; c < EXIT_RULE_CASE_COUNT; c++) {
+        const ExitRuleCase *test = &exitRuleCases[c];
+        TileGrid grid = {0};
+        SpawnPoint spawn = {-1, -1};
+        if (!CreateTileGrid(&grid, 5, 5)) return false;
+        for (int r = 0; r < 5; r++) {
+            for (int col = 0; col < 5; col++) {
+                char cell = test->rows[r][col];
+                if (cell == 'S') spawn = (SpawnPoint){r, col};
+                SetGridTile(&grid, r, col, (cell == '1' || cell == 'S') ? 1 : 0);
+            }
+        }
+
+        PathValidator_Rebuild(&grid, &spawn, 1, false);
+        bool validatorReachable = PathValidator_GetSpawnDistance(0) != PATH_VALIDATOR_UNREACHABLE;
+        RouteTable table = {0};
+        bool routeReachable = LoadGameMapFromGrid(&grid) && BuildRouteTable(&table, &spawn, 1) &&
+                              table.spawnRouteCount[0] > 0;
+        if (validatorReachable != routeReachable) {
+            TraceLog(LOG_ERROR, "BENCH: Exit rule mismatch on '%s': validator=%s, route table=%s.", test->name,
+                     validatorReachable ? "reachable" : "blocked", routeReachable ? "reachable" : "blocked");
+            agree = false;
+        }
+        FreeRouteTable(&table);
+        PathValidator_Free();
+        FreeTileGrid(&grid);
+    }
+    return agree;
+}
+
+/* --- Harness --- */
+
+typedef void (*BenchOp)(void);
+
+/* I.S. : Fixture telah disiapkan.
+   F.S. : 'op' dijalankan dalam batch berisi 'opsPerBatch' op sampai total waktu terukur
+          mencapai BENCH_MIN_SECONDS. 'reset' (boleh NULL) dipanggil sebelum setiap batch
+          dan tidak ikut diukur. Hasil ns/op, alokasi/op, dan byte/op dicetak. */
+static void RunBenchmark(const char *name, BenchOp op, BenchOp reset, int opsPerBatch) {
+    // Pemanasan: satu batch tanpa pengukuran.
+    if (reset) reset();
+    for (int i = 0; i < opsPerBatch; i++) op();
+
+    double elapsed = 0.0;
+    long long ops = 0;
+    size_t allocs = 0, bytes = 0, frees = 0;
+    for (int batch = 0; batch < BENCH_MAX_BATCHES && elapsed < BENCH_MIN_SECONDS; batch++) {
+        if (reset) reset();
+
+        BenchAllocStats before = BenchAlloc_GetStats();
+        double start = GetTime();
+        for (int i = 0; i < opsPerBatch; i++) op();
+        elapsed += GetTime() - start;
+        BenchAllocStats after = BenchAlloc_GetStats();
+        allocs += after.allocCount - before.allocCount;
+        bytes += after.totalBytes - before.totalBytes;
+        frees += after.freeCount - before.freeCount;
+        ops += opsPerBatch;
+    }
+
+    printf("%-38s %12.1f %10.2f %12.1f %10.2f %10lld\n", name,
+           elapsed * 1.0e9 / ops, (double)allocs / ops, (double)bytes / ops, (double)frees / ops, ops);
+}
+
+/* I.S. : Sembarang.
+   F.S. : Perbaikan penuh dan inkremental validator rute dibandingkan pada grid serpentine
+          size x size untuk dua jenis perubahan tile. Grid validator dibebaskan. */
+static void RunValidatorBenchmarks(int size) {
+    if (!SetupValidatorFixture(size)) {
+        TraceLog(LOG_ERROR, "BENCH: Validator fixture %dx%d has no route; skipping.", size, size);
+        PathValidator_Free();
+        FreeTileGrid(&validatorGrid);
+        return;
+    }
+    static const char *changeNames[] = { "PaintSide", "CutRoute" };
+    for (int cut = 0; cut < 2; cut++) {
+        SelectValidatorToggle(cut == 1);
+        char name[64];
+        snprintf(name, sizeof(name), "PathValidator/%s/Full/%dx%d", changeNames[cut], size, size);
+        RunBenchmark(name, OpValidatorFullRebuild, NULL, 1);
+        PathValidator_Rebuild(&validatorGrid, &fixtureSpawn, 1, false);
+        snprintf(name, sizeof(name), "PathValidator/%s/LPA*/%dx%d", changeNames[cut], size, size);
+        RunBenchmark(name, OpValidatorIncremental, NULL, 10);
+    }
+    PathValidator_Free();
+    FreeTileGrid(&validatorGrid);
+}
+
+// Membaca argumen "--enemies", "--towers", dan "--map-size".
+static void ParseArguments(int argc, char *argv[]) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--enemies") == 0) fixtureEnemyCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--towers") == 0) fixtureTowerCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--map-size") == 0) fixtureMapSize = atoi(argv[++i]);
+    }
+    if (fixtureEnemyCount < 1) fixtureEnemyCount = 1;
+    if (fixtureTowerCount < 0) fixtureTowerCount = 0;
+    if (fixtureMapSize < 8) fixtureMapSize = 8;
+    if (fixtureMapSize > MAX_MAP_ROWS) fixtureMapSize = MAX_MAP_ROWS;
+}
+
+int main(int argc, char *argv[]) {
+    ParseArguments(argc, argv);
+
+    // Jendela tersembunyi tetap dibutuhkan untuk konteks OpenGL (tekstur aset) dan timer GetTime.
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(320, 240, "bench_micro");
+    SetRandomSeed(12345);
+    srand(12345);
+
+    maxTotalActiveEnemies = fixtureEnemyCount;
+    Enemies_InitAssets();
+    InitMapAssets();
+    InitTowerAssets();
+    InitShots();
+    InitUpgradeTree(&tower1UpgradeTree, TOWER_TYPE_1);
+    CreateStatus(&statusStack);
+
+    SetTraceLogLevel(LOG_ERROR);    // Kasus yang memang buntu mencatat peringatan pathfinding
+    bool exitRulesAgree = CheckExitRuleAgreement();
+    SetTraceLogLevel(LOG_WARNING);
+    if (!exitRulesAgree) {
+        CloseWindow();
+        return 1;
+    }
+
+    enemySnapshot = (Enemy *)calloc(maxTotalActiveEnemies, sizeof(Enemy));
+    if (!allActiveEnemies || !enemySnapshot || !BuildSerpentineMap(fixtureMapSize) ||
+        !InitEnemyKinematics(&kinematicsSnapshot, maxTotalActiveEnemies) ||
+        !InitEnemyKernelEvents(&benchEvents, kinematicsSnapshot.capacity)) {
+        TraceLog(LOG_ERROR, "BENCH: Failed to build fixtures.");
+        CloseWindow();
+        return 1;
+    }
+    WaveScript_Compile(NULL, 1);
+    fixtureWave = CreateWave(&fixtureSpawn, 1);
+    fixtureRoute = fixtureWave ? GetRoute(fixtureWave->routes, 0) : NULL;
+    if (!fixtureRoute || fixtureRoute->count < 2) {
+        TraceLog(LOG_ERROR, "BENCH: Generated map has no usable path.");
+        CloseWindow();
+        return 1;
+    }
+    SpawnFixtureEnemies();
+    PlaceFixtureTowers();
+    SetTraceLogLevel(LOG_ERROR); // Log INFO dari wave/shot di dalam loop pengukuran akan mendominasi hasil
+
+    printf("bench_micro: map %dx%d, path %d points, %d enemies, %d towers, movement kernel %s\n\n",
+           fixtureMapSize, fixtureMapSize, fixtureRoute->count, fixtureEnemyCount, fixtureTowerCount,
+           GetEnemyKernelName());
+    printf("%-38s %12s %10s %12s %10s %10s\n", "benchmark", "ns/op", "allocs/op", "bytes/op", "frees/op", "ops");
+
+    RunBenchmark("Enemies_Update", OpEnemiesUpdate, RestoreEnemies, 100);
+
+    // Kernel pergerakan saja, untuk setiap implementasi yang didukung CPU ini.
+    static const EnemyKernelMode kernelModes[] = { ENEMY_KERNEL_SCALAR, ENEMY_KERNEL_SSE2, ENEMY_KERNEL_AVX2 };
+    for (int m = 0; m < (int)(sizeof(kernelModes) / sizeof(kernelModes[0])); m++) {
+        SetEnemyKernelMode(kernelModes[m]);
+        char name[64];
+        snprintf(name, sizeof(name), "EnemyMovementKernel/%s", GetEnemyKernelName());
+        RunBenchmark(name, OpMovementKernel, RestoreEnemies, 100);
+    }
+    SetEnemyKernelMode(ENEMY_KERNEL_AUTO);
+
+    for (int p = 0; p < TOWER_PRESET_COUNT; p++) {
+        ApplyTowerPreset(&towerPresets[p]);
+        char name[64];
+        snprintf(name, sizeof(name), "UpdateTowerAttacks/%s", towerPresets[p].name);
+        RunBenchmark(name, OpTowerAttacks, ResetAttackFixture, 1);
+    }
+    ApplyTowerPreset(&towerPresets[0]);
+    MarkLookupTower();
+
+    RestoreEnemies();
+    RunBenchmark("FindNextChainTarget", OpFindNextChainTarget, NULL, 1000);
+    RunBenchmark("BuildRouteTable", OpBuildRouteTable, NULL, 10);
+    RunBenchmark("PathCache_Acquire", OpPathCacheAcquire, NULL, 10000);
+    RunBenchmark("CreateWave+FreeWave", OpCreateFreeWave, NULL, 10);
+    RunBenchmark("UpdateShots", OpUpdateShots, FillShots, 1000);
+    RunBenchmark("FindNodeByType", OpFindNodeByType, NULL, 10000);
+    RunBenchmark("FindCurrentUpgradeNode", OpFindCurrentUpgradeNode, NULL, 10000);
+    RunBenchmark("UpdateUpgradeTreeStatus", OpUpdateUpgradeTreeStatus, NULL, 10000);
+    RunBenchmark("GetTowerStats", OpGetTowerStats, NULL, 10000);
+    if (SetupFlowFieldFixture()) {
+        RunBenchmark("FlowField_Build", OpFlowFieldBuild, NULL, 10);
+        RunBenchmark("FlowField/PlaceRemoveTower", OpFlowFieldToggleTile, NULL, 1000);
+        Maze_Configure(true, &fixtureSpawn, 1);
+        RunBenchmark("Maze_WouldBlockSpawns/cached", OpMazeQuery, NULL, 10000);
+        RunBenchmark("Maze_WouldBlockSpawns/after_change", OpMazeQueryAfterChange, NULL, 10);
+        RunBenchmark("Maze/PlaceQueryPlace", OpMazePlaceQueryPlace, ResetMazePlacements, BENCH_MAZE_PLACEMENTS);
+        Maze_Clear();
+    } else {
+        TraceLog(LOG_ERROR, "BENCH: Flow field fixture has no reachable exit; skipping flow field benchmarks.");
+    }
+    FlowField_Clear();
+    RunValidatorBenchmarks(64);
+    RunValidatorBenchmarks(256);
+
+    while (towersListHead != NULL) RemoveTower(towersListHead);
+    Scheduler_Shutdown();
+    FreeWave(&fixtureWave);
+    WaveScript_Clear();
+    FreeRouteTable(&scratchRoutes);
+    PathCache_Clear();
+    free(enemySnapshot);
+    FreeEnemyKinematics(&kinematicsSnapshot);
+    FreeEnemyKernelEvents(&benchEvents);
+    FreeUpgradeTree(&tower1UpgradeTree);
+    ShutdownShots();
+    ShutdownTowerAssets();
+    ShutdownMapAssets();
+    Enemies_ShutdownAssets();
+    FreeTileGrid(&gameMap);
+    CloseWindow();
+    return 0;
+}
@@ -0,0 +1,275 @@
+/* File        : bench_scenarios.c
+* Deskripsi   : Benchmark skenario end-to-end di atas peta yang dikirim bersama game.
+*               Setiap skenario (file .txt di benchmarks/scenarios) memuat satu peta
+*               (maps/map1-4.txt atau peta bawaan "default"), menempatkan tower dari
+*               file skenario, lalu menjalankan UpdateGameplay dengan delta time tetap
+*               secepat mungkin sampai sejumlah wave selesai. Hasilnya: ticks/detik,
+*               puncak musuh aktif, puncak memori heap, dan jumlah alokasi.
+*               Program keluar dengan status 1 jika ada skenario yang gagal dimuat atau
+*               tidak selesai dalam batas tick, sehingga bisa dipakai sebagai gerbang
+*               regresi performa.
+*
+*               Format file skenario: satu perintah per baris, '#' untuk komentar.
+*                 name <nama>          nama di laporan (bawaan: nama file tanpa ekstensi)
+*                 map <file|default>   peta yang dimainkan
+*                 waves <n>            jumlah wave yang dijalankan sampai selesai
+*                 lives <n>, money <n> nyawa dan uang awal (dibuat besar agar skenario
+*                                      tidak berakhir lebih awal)
+*                 dt <detik>           delta time tetap per tick
+*                 maxTicks <n>         batas tick; skenario dianggap gagal jika terlampaui
+*                 tower <row> <col>    tower yang ditempatkan (harus di tile 4)
+*
+*               Pemakaian: bench_scenarios [--csv file] [scenario.txt ...]
+*               Tanpa argumen skenario, semua skenario bawaan dijalankan.
+*               Jalankan dari direktori akar proyek agar aset dan peta dapat dimuat.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "common.h"
+#include "gameplay.h"
+#include "level_editor.h"
+#include "main_menu.h"
+#include "enemy.h"
+#include "map.h"
+#include "tower.h"
+#include "player_resources.h"
+#include "utils.h"
+#include "bench_alloc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SCENARIO_MAX_TOWERS 64
+#define SCENARIO_DEFAULT_START_ROW 0   // Sama dengan titik awal cadangan di RestartGameplay
+#define SCENARIO_DEFAULT_START_COL 4
+
+/* Isi satu file skenario. */
+typedef struct {
+    char name[64];
+    char mapFile[256];       // Path file peta, atau "default" untuk peta bawaan
+    int waves;
+    int lives;
+    int money;
+    float deltaTime;
+    int maxTicks;
+    int towerCount;
+    int towerRows[SCENARIO_MAX_TOWERS];
+    int towerCols[SCENARIO_MAX_TOWERS];
+} Scenario;
+
+/* Hasil pengukuran satu skenario. */
+typedef struct {
+    bool completed;
+    int ticks;
+    double seconds;
+    int towersPlaced;
+    int peakEnemies;
+    int livesLeft;
+    size_t peakHeapBytes;
+    size_t allocCount;
+    size_t freeCount;
+    long long liveDeltaBytes;
+} ScenarioResult;
+
+static const char *defaultScenarioFiles[] = {
+    "benchmarks/scenarios/default.txt",
+    "benchmarks/scenarios/map1.txt",
+    "benchmarks/scenarios/map2.txt",
+    "benchmarks/scenarios/map3.txt",
+    "benchmarks/scenarios/map4.txt",
+};
+#define DEFAULT_SCENARIO_COUNT ((int)(sizeof(defaultScenarioFiles) / sizeof(defaultScenarioFiles[0])))
+
+/* I.S. : 'scenario' sembarang.
+   F.S. : 'scenario' berisi data dari 'fileName'. Baris kosong dan baris yang diawali '#'
+          diabaikan. Mengembalikan false jika file tidak dapat dibuka atau tidak valid. */
+static bool LoadScenario(const char *fileName, Scenario *scenario) {
+    FILE *file = fopen(fileName, "r");
+    if (!file) {
+        TraceLog(LOG_ERROR, "SCENARIO: Failed to open %s.", fileName);
+        return false;
+    }
+
+    *scenario = (Scenario){ .waves = 5, .lives = 1000, .money = 100000, .deltaTime = 1.0f / 60.0f, .maxTicks = 200000 };
+    StrCopySafe(scenario->name, GetFileNameWithoutExt(fileName), sizeof(scenario->name));
+
+    char line[256];
+    int lineNumber = 0;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        lineNumber++;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r' || line[0] == '\0') continue;
+
+        int row, col;
+        char text[256];
+        if (sscanf(line, "name %63s", text) == 1) StrCopySafe(scenario->name, text, sizeof(scenario->name));
+        else if (sscanf(line, "map %255s", text) == 1) StrCopySafe(scenario->mapFile, text, sizeof(scenario->mapFile));
+        else if (sscanf(line, "waves %d", &scenario->waves) == 1) {}
+        else if (sscanf(line, "lives %d", &scenario->lives) == 1) {}
+        else if (sscanf(line, "money %d", &scenario->money) == 1) {}
+        else if (sscanf(line, "dt %f", &scenario->deltaTime) == 1) {}
+        else if (sscanf(line, "maxTicks %d", &scenario->maxTicks) == 1) {}
+        else if (sscanf(line, "tower %d %d", &row, &col) == 2) {
+            if (scenario->towerCount >= SCENARIO_MAX_TOWERS) {
+                TraceLog(LOG_WARNING, "SCENARIO: %s:%d: More than %d towers, ignored.", fileName, lineNumber, SCENARIO_MAX_TOWERS);
+                continue;
+            }
+            scenario->towerRows[scenario->towerCount] = row;
+            scenario->towerCols[scenario->towerCount] = col;
+            scenario->towerCount++;
+        } else {
+            TraceLog(LOG_WARNING, "SCENARIO: %s:%d: Unknown line ignored.", fileName, lineNumber);
+        }
+    }
+    fclose(file);
+
+    if (scenario->mapFile[0] == '\0' || scenario->waves < 1 || scenario->deltaTime <= 0.0f || scenario->maxTicks < 1) {
+        TraceLog(LOG_ERROR, "SCENARIO: %s is missing 'map' or has invalid waves/dt/maxTicks.", fileName);
+        return false;
+    }
+    return true;
+}
+
+/* I.S. : State editor berisi peta sebelumnya.
+   F.S. : Peta skenario dimuat ke state editor sehingga RestartGameplay memakainya
+          lewat jalur peta kustom (jumlah wave dibatasi oleh customWaveCount).
+          Peta bawaan disalin dari gameMap dengan titik awal cadangan RestartGameplay. */
+static bool LoadScenarioMap(const Scenario *scenario) {
+    if (strcmp(scenario->mapFile, "default") == 0) {
+        ResetMapToDefault();
+        if (!CopyTileGrid(&editorState.map, &gameMap)) return false;
+        ClearEditorStartPoints();
+        AddEditorStartPoint(SCENARIO_DEFAULT_START_ROW, SCENARIO_DEFAULT_START_COL);
+        SetEditorMapFileName("default");
+        return true;
+    }
+    if (!LoadLevelFromFile(scenario->mapFile)) return false;
+    SetEditorMapFileName(scenario->mapFile);
+    return true;
+}
+
+/* I.S. : Gameplay telah diinisialisasi.
+   F.S. : 'scenario' dijalankan sampai semua wave selesai, state gameplay berubah
+          (game over), atau batas tick tercapai. Hasilnya ditulis ke 'result'. */
+static bool RunScenario(const Scenario *scenario, ScenarioResult *result) {
+    *result = (ScenarioResult){0};
+
+    selectedCustomMapIndex = -1;
+    if (!LoadScenarioMap(scenario)) {
+        TraceLog(LOG_ERROR, "SCENARIO: %s: Failed to load map %s.", scenario->name, scenario->mapFile);
+        return false;
+    }
+    customWaveCount = scenario->waves;
+
+    BenchAlloc_ResetPeak();
+    BenchAllocStats before = BenchAlloc_GetStats();
+
+    RestartGameplay();
+    if (currentGameState != GAMEPLAY) {
+        TraceLog(LOG_ERROR, "SCENARIO: %s: Map has no valid path.", scenario->name);
+        return false;
+    }
+    SetLife(scenario->lives);
+    SetMoney(scenario->money);
+
+    for (int i = 0; i < scenario->towerCount; i++) {
+        PlaceTower(scenario->towerRows[i], scenario->towerCols[i], TOWER_TYPE_1);
+        if (GetTowerAtMapCoord(scenario->towerRows[i], scenario->towerCols[i]) != NULL) {
+            result->towersPlaced++;
+        } else {
+            TraceLog(LOG_ERROR, "SCENARIO: %s: Could not place tower at (%d, %d).",
+                     scenario->name, scenario->towerRows[i], scenario->towerCols[i]);
+        }
+    }
+
+    double start = GetTime();
+    while (result->ticks < scenario->maxTicks) {
+        UpdateGameplay(scenario->deltaTime);
+        result->ticks++;
+        if (totalActiveEnemiesCount > result->peakEnemies) result->peakEnemies = totalActiveEnemiesCount;
+
+        if (currentGameState != GAMEPLAY) break;
+        if (currentWaveNum >= scenario->waves && GetActiveWaveCount() == 0) {
+            result->completed = true;
+            break;
+        }
+    }
+    result->seconds = GetTime() - start;
+
+    BenchAllocStats after = BenchAlloc_GetStats();
+    result->livesLeft = GetLife();
+    result->peakHeapBytes = after.peakBytes;
+    result->allocCount = after.allocCount - before.allocCount;
+    result->freeCount = after.freeCount - before.freeCount;
+    result->liveDeltaBytes = (long long)after.liveBytes - (long long)before.liveBytes;
+    return true;
+}
+
+// Mencetak satu baris hasil ke layar dan, jika ada, ke file CSV.
+static void ReportResult(const Scenario *scenario, const ScenarioResult *result, FILE *csv) {
+    double ticksPerSecond = result->seconds > 0.0 ? result->ticks / result->seconds : 0.0;
+    printf("%-12s %6d %8d %12.0f %8d %12.1f %10zu %10zu %12.1f %6d  %s\n",
+           scenario->name, result->towersPlaced, result->ticks, ticksPerSecond, result->peakEnemies,
+           result->peakHeapBytes / 1024.0, result->allocCount, result->freeCount,
+           result->liveDeltaBytes / 1024.0, result->livesLeft,
+           result->completed ? "ok" : "INCOMPLETE");
+    if (csv) {
+        fprintf(csv, "%s,%s,%d,%d,%.4f,%.1f,%d,%zu,%zu,%zu,%lld,%d,%d\n",
+                scenario->name, scenario->mapFile, scenario->waves, result->ticks, result->seconds,
+                ticksPerSecond, result->peakEnemies, result->peakHeapBytes, result->allocCount,
+                result->freeCount, result->liveDeltaBytes, result->livesLeft, result->completed ? 1 : 0);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const char *csvFileName = NULL;
+    const char *scenarioFiles[64];
+    int scenarioFileCount = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) csvFileName = argv[++i];
+        else if (scenarioFileCount < 64) scenarioFiles[scenarioFileCount++] = argv[i];
+    }
+    if (scenarioFileCount == 0) {
+        for (int i = 0; i < DEFAULT_SCENARIO_COUNT; i++) scenarioFiles[scenarioFileCount++] = defaultScenarioFiles[i];
+    }
+
+    // Jendela tersembunyi tetap dibutuhkan untuk konteks OpenGL saat tekstur dimuat.
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(320, 240, "bench_scenarios");
+    SetRandomSeed(12345);
+    srand(12345);
+    InitGameplay();
+    SetTraceLogLevel(LOG_ERROR); // Log INFO per wave/tower akan mendominasi waktu tick
+
+    FILE *csv = NULL;
+    if (csvFileName) {
+        csv = fopen(csvFileName, "w");
+        if (!csv) TraceLog(LOG_ERROR, "SCENARIO: Failed to open %s for writing.", csvFileName);
+        else fprintf(csv, "scenario,map,waves,ticks,seconds,ticks_per_second,peak_enemies,peak_heap_bytes,allocs,frees,live_delta_bytes,lives_left,completed\n");
+    }
+
+    printf("%-12s %6s %8s %12s %8s %12s %10s %10s %12s %6s  %s\n", "scenario", "towers", "ticks", "ticks/s",
+           "peak_en", "peak_KiB", "allocs", "frees", "live_dKiB", "lives", "result");
+
+    int failures = 0;
+    for (int i = 0; i < scenarioFileCount; i++) {
+        Scenario scenario;
+        ScenarioResult result;
+        if (!LoadScenario(scenarioFiles[i], &scenario) || !RunScenario(&scenario, &result)) {
+            printf("%-12s failed to run (%s)\n", GetFileNameWithoutExt(scenarioFiles[i]), scenarioFiles[i]);
+            failures++;
+            continue;
+        }
+        ReportResult(&scenario, &result, csv);
+        if (!result.completed) failures++;
+    }
+
+    if (csv) fclose(csv);
+    while (towersListHead != NULL) RemoveTower(towersListHead);
+    UnloadGameplay();
+    FreeTileGrid(&editorState.map);
+    FreeTileGrid(&gameMap);
+    CloseWindow();
+    return failures > 0 ? 1 : 0;
+}
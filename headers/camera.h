@@ -0,0 +1,57 @@
+/* File        : camera.h
+* Deskripsi   : Deklarasi untuk modul Kamera (Camera) gameplay.
+*               Modul ini mengelola posisi pandang (pan) dan perbesaran (zoom) peta,
+*               serta menyediakan fungsi culling agar hanya objek yang terlihat di
+*               layar yang digambar.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include "common.h"
+
+#define CAMERA_MIN_ZOOM 1.0f
+#define CAMERA_MAX_ZOOM 6.0f
+#define CAMERA_ZOOM_STEP 0.15f
+#define CAMERA_PAN_SPEED 600.0f
+#define CULL_MARGIN_PIXELS 64.0f
+
+/* ADT untuk kamera gameplay. */
+/* 'target' adalah titik di koordinat dunia (piksel peta) yang berada di tengah layar,
+   'zoom' adalah pengali terhadap skala "fit to screen" dari peta. */
+typedef struct {
+    Vector2 target;
+    float zoom;
+} GameCamera;
+
+extern GameCamera gameCamera;
+
+/* I.S. : Kamera berada pada posisi dan zoom sembarang.
+   F.S. : Kamera berada di tengah peta dengan zoom 1 (seluruh peta terlihat). */
+void ResetGameCamera(void);
+
+/* I.S. : Kamera pada posisi frame sebelumnya.
+   F.S. : Posisi dan zoom kamera diperbarui berdasarkan input pemain
+          (roda mouse untuk zoom, WASD/panah atau drag tombol tengah mouse untuk pan). */
+void UpdateGameCamera(float deltaTime);
+
+/* I.S. : 'tileScale', 'offsetX', dan 'offsetY' berisi nilai lama.
+   F.S. : Ketiganya diisi dengan skala dan offset layar peta sesuai state kamera saat ini. */
+void ApplyGameCamera(float *tileScale, float *offsetX, float *offsetY);
+
+/* Mengirimkan true jika persegi 'worldRect' (koordinat dunia) terlihat di layar
+   untuk skala dan offset yang diberikan. */
+bool IsWorldRectVisible(Rectangle worldRect, float globalScale, float offsetX, float offsetY);
+
+/* Mengirimkan true jika titik 'worldPos' (koordinat dunia) berada di dalam layar,
+   diperluas sebesar 'marginPixels' piksel layar di setiap sisi. */
+bool IsWorldPointVisible(Vector2 worldPos, float marginPixels, float globalScale, float offsetX, float offsetY);
+
+/* I.S. : Parameter output berisi nilai sembarang.
+   F.S. : Rentang baris [rowStart, rowEnd) dan kolom [colStart, colEnd) dari tile yang
+          terlihat di layar telah diisi (sudah dibatasi ke ukuran peta). */
+void GetVisibleTileRange(float globalScale, float offsetX, float offsetY, int *rowStart, int *rowEnd, int *colStart, int *colEnd);
+
+#endif
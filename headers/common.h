@@ -12,7 +12,6 @@
 
 #define VIRTUAL_WIDTH 2560
 #define VIRTUAL_HEIGHT 1600
-#define MAX_UPGRADE_TYPES 200 // <-- TAMBAHKAN KONSTANTA INI
 
 #include "raylib.h"
 #include <stdbool.h> 
@@ -101,6 +100,7 @@ typedef struct UpgradeNode {
     struct UpgradeNode* parent; 
     struct UpgradeNode* firstChild;  
     struct UpgradeNode* nextSibling;
+    int flatIndex;              // Indeks node di pohon pipih (CompileUpgradeTree), -1 jika belum dikompilasi
     UpgradeEffectType effectType;
 
     union {
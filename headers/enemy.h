@@ -11,9 +11,10 @@
 #define ENEMY_H
 
 #include "common.h"
+#include "path_cache.h"
+#include "wave_script.h"
 #define TIMER_OVERALL_SIZE_FACTOR 0.8f
 #define TIMER_IMAGE_DISPLAY_FACTOR 0.8f
-#define MAX_PATH_POINTS 100
 #define WAVE_TIMER_DURATION 10.0f
 #define SPAWN_DELAY 1.5f 
 #define WAVE_INTERVAL 10.0f
@@ -22,34 +23,60 @@
 typedef struct EnemyWave EnemyWave;
 
 // ADT untuk Animasi Sprite
+// Hanya berisi data statis (tekstur dan ukuran frame); frame yang tampil dihitung saat menggambar
+// dari lama animasi berjalan.
 typedef struct {
     Texture2D texture;
     int frameCols;        
     int frameSpeed;   
     int frameCount;   
-    int currentFrame; 
-    float frameCounter;
     int frameWidth;   
     int frameHeight;  
-    Rectangle frameRec;
 } AnimSprite;
 
+// Jenis serangan tower, dipakai untuk resistansi archetype musuh.
+typedef enum {
+    DAMAGE_PROJECTILE,
+    DAMAGE_AREA,
+    DAMAGE_CHAIN,
+    DAMAGE_TYPE_COUNT
+} DamageType;
+
+#define ENEMY_ARCHETYPE_COUNT 2
+
+// ADT untuk data statis satu jenis musuh. Semua musuh sejenis berbagi satu entri tabel archetype.
+typedef struct {
+    const char *name;                       // Nama jenis di skrip wave
+    const char *spriteFile;
+    int spriteCols;
+    int spriteSpeed;
+    int spriteFrames;
+    float drawScale;
+    int baseHp;                             // HP pada wave 1; bertambah 10 per wave
+    float baseSpeed;                        // Kecepatan dasar sebelum bonus wave dan variasi acak
+    int bounty;                             // Uang yang didapat pemain saat musuh dikalahkan
+    float resistance[DAMAGE_TYPE_COUNT];    // Bagian damage yang ditahan (0 = damage penuh)
+    AnimSprite sprite;                      // Diisi oleh Enemies_InitAssets
+} EnemyArchetype;
+
 // ADT untuk satu entitas Enemy
+// HP, kecepatan, jarak tempuh, dan sisa stun musuh yang sedang aktif disimpan di
+// enemyKinematics (enemy_kernel.h) pada indeks slot yang sama; akses lewat fungsi Get/Set.
 typedef struct {    
-    AnimSprite animData; 
     Vector2 position;
-    int hp;
-    float speed;
+    int maxHp;          // HP awal saat di-spawn
+    float baseSpeed;    // Kecepatan awal saat di-spawn
     bool active;
     bool spawned;
-    int segment;     
-    float t;         
-    int spriteType;     
-    float drawScale;   
+    int routeId;        // Indeks rute di tabel rute wave induknya
+    int segment;        // Petunjuk segmen terakhir untuk GetMapPathPosition
+    int flowTile;       // Mode flow field: indeks tile tujuan berikutnya (row * cols + col)
+    float flowConsumed; // Mode flow field: jarak tempuh yang sudah diubah menjadi langkah
+    int stunUntilTick;  // Tick scheduler saat stun berakhir, -1 jika tidak terkena stun
+    int archetype;      // Indeks di tabel archetype musuh
+    float animPhase;    // Offset terhadap jam animasi global (detik), diisi saat spawn
     int waveNum;     
     EnemyWave* parentWave; 
-    bool isStunned;
-    float stunTimer;
 } Enemy;
 
 // ADT untuk Antrian Musuh (Queue) yang akan di-spawn dalam satu wave
@@ -66,7 +93,9 @@ typedef struct {
 
 // ADT untuk satu Gelombang Musuh (Wave)
 struct EnemyWave {
-    EnemyQueue enemyQueue; 
+    const WaveSpawnEntry *spawnTable;   // Potongan tabel spawn Wave Script untuk wave ini
+    SpawnPoint spawns[MAX_SPAWN_POINTS];
+    int spawnCount;
     Enemy *activeEnemies;  
     int maxActiveEnemies;  
     int currentActiveCount;
@@ -74,16 +103,14 @@ struct EnemyWave {
     int activeCount;
     
     Texture2D timerTexture; 
-    Vector2 path[MAX_PATH_POINTS];
-    int pathCount;
+    const RouteTable *routes;   // Handle ke tabel rute bersama di Path Cache, dilepas oleh FreeWave
     int waveNum;
 
     int enemiesToSpawnInThisWave; 
-    float spawnTimer;      
     int spawnedCount;
     
     int nextSpawnIndex;    
-    float timerCurrentTime;
+    int activationTick;         // Tick scheduler saat hitung mundur wave selesai
     float timerDuration;
     bool timerVisible;
     bool active;
@@ -169,23 +196,20 @@ void ClearWaveQueue(WaveQueue *q);
 // dari 'filename' dan properti animasi yang sesuai.
 AnimSprite LoadAnimSprite(const char *filename, int cols, int speed, int frameCount);
 
-// I.S. : 'sprite' berada pada frame animasi tertentu.
-// F.S. : 'sprite->currentFrame' mungkin bertambah berdasarkan 'deltaTime' dan 'frameSpeed'.
-void UpdateAnimSprite(AnimSprite *sprite);
-
 // I.S. : 'sprite' terdefinisi.
-// F.S. : Frame animasi saat ini dari 'sprite' digambar ke layar pada 'position' yang ditentukan.
-void DrawAnimSprite(const AnimSprite *sprite, Vector2 position, float scale, Color tint);
+// F.S. : Frame 'sprite' setelah animasi berjalan 'time' detik digambar ke layar pada 'position'.
+void DrawAnimSprite(const AnimSprite *sprite, float time, Vector2 position, float scale, Color tint);
+
+// Mengirimkan archetype musuh ke-'index', atau archetype pertama jika indeks tidak valid.
+const EnemyArchetype *GetEnemyArchetype(int index);
+
+// Mengirimkan indeks archetype bernama 'name', atau -1 jika tidak ada.
+int FindEnemyArchetype(const char *name);
 
 //I.S : Sprite terdefinisi
 //F.S : Semua sprite dibebaskan dari memori
 void UnloadAnimSprite(AnimSprite *sprite);
 
-// I.S. : 'waveToBuild->path' kosong.
-// F.S. : 'waveToBuild->path' telah diisi dengan koordinat jalur yang ditemukan dari titik awal.
-// 'waveToBuild->pathCount' diperbarui.
-void Enemies_BuildPath(int startX, int startY, EnemyWave* waveToBuild); 
-
 // I.S. : Diberikan sebuah target saat ini dan daftar target yang sudah dikecualikan.
 // F.S. : Mengembalikan pointer ke musuh terdekat berikutnya dalam jangkauan 'range' yang belum ada
 // di dalam daftar 'excludedTargets'. Mengembalikan NULL jika tidak ada.
@@ -193,26 +217,40 @@ Enemy* FindNextChainTarget(Enemy* currentTarget, Enemy* excludedTargets[], int e
 
 // I.S. : Posisi dan status musuh pada frame sebelumnya.
 // F.S. : Posisi semua musuh yang aktif di 'allActiveEnemies' diperbarui sesuai 'deltaTime' dan jalurnya.
+// Musuh yang HP-nya habis atau mencapai ujung jalur dinonaktifkan.
 void Enemies_Update(float deltaTime);
 
+// Mengirimkan musuh ke-'index' dari tabel spawn 'wave', siap diberikan ke SpawnEnemy.
+// Titik awal dan rute dipilih saat ini; HP, kecepatan, dan sprite diambil dari tabel.
+Enemy BuildWaveEnemy(EnemyWave *wave, int index);
+
+// I.S. : 'enemy' adalah musuh dari tabel spawn wave yang belum di-spawn.
+// F.S. : Salinan 'enemy' menempati slot kosong pertama di 'allActiveEnemies' di awal jalurnya,
+// dengan HP dan kecepatan awal. Mengembalikan false jika tidak ada slot kosong.
+bool SpawnEnemy(const Enemy *enemy);
+
+// I.S. : Sembarang.
+// F.S. : Semua slot di 'allActiveEnemies' tidak aktif dan 'totalActiveEnemiesCount' bernilai 0.
+void Enemies_DeactivateAll(void);
+
 // I.S. : 'allActiveEnemies' berisi data musuh yang akan digambar.
 // F.S. : Semua musuh yang 'active' telah digambar ke layar pada posisi dan skala yang tepat.
 void Enemies_Draw(float globalScale, float offsetX, float offsetY);
 
 // I.S. : EnemyWave belum dibuat
 // F.S. : Sebuah 'EnemyWave' dibuat, dialokasikan di memori, dan dikembalikan.
-EnemyWave* CreateWave(int startRow, int startCol); 
+// Tabel rutenya diambil dari Path Cache untuk 'spawns'; 'routes' bernilai NULL jika cache penuh
+// atau peta memakai flow field. Musuh dibagi bergiliran ke setiap titik awal dan mendapat salah
+// satu rute titik awal tersebut (atau mulai dari pusat tile titik awal pada mode flow field).
+// Komposisi musuh diambil dari tabel spawn Wave Script untuk 'currentWaveNum' tanpa alokasi per musuh.
+// Timer wave digambar di titik awal pertama.
+EnemyWave* CreateWave(const SpawnPoint *spawns, int spawnCount); 
 
 // I.S. : 'wave' menunjuk ke sebuah EnemyWave yang valid.
 // F.S. : Semua memori yang dialokasikan untuk 'wave' dan antrian di dalamnya telah dibebaskan.
 // Pointer 'wave' diatur menjadi NULL.
 void FreeWave(EnemyWave **wave);
 
-// I.S. : 'wave' memiliki timer yang sedang berjalan atau tidak aktif.
-// F.S. : 'timerCurrentTime' dari 'wave' diperbarui. Jika timer selesai, 'wave->active' menjadi true
-// dan fungsi mengembalikan 'true'. Jika tidak, mengembalikan 'false'.
-bool UpdateWaveTimer(EnemyWave *wave, float deltaTime);
-
 // I.S. : 'wave' adalah gelombang yang sedang atau telah berjalan.
 // F.S. : Mengembalikan 'true' jika semua musuh dari 'wave' ini sudah di-spawn DAN sudah tidak ada lagi
 // yang aktif di layar. Mengembalikan 'false' jika sebaliknya.
@@ -228,7 +266,21 @@ Vector2 GetEnemyPosition(const Enemy *enemy);
 // Mengembalikan nilai HP dari 'enemy'.
 int GetEnemyHP(const Enemy *enemy);
 
-// Mengirimkan nilai waktu saat ini (progress) dari timer 'wave'.
+// Mengirimkan jarak yang sudah ditempuh 'enemy' sepanjang jalurnya.
+float GetEnemyDistance(const Enemy *enemy);
+
+// Mengirimkan rute yang diikuti 'enemy', atau NULL jika wave-nya tidak memiliki tabel rute.
+const MapPath *GetEnemyRoute(const Enemy *enemy);
+
+// Mengirimkan true jika 'enemy' sedang terkena stun.
+bool IsEnemyStunned(const Enemy *enemy);
+
+// I.S. : 'enemy' aktif, mungkin sedang terkena stun.
+// F.S. : 'enemy' tidak bergerak selama 'duration' detik ke depan.
+void StunEnemy(Enemy *enemy, float duration);
+
+// Mengirimkan nilai waktu saat ini (progress) dari timer 'wave', dihitung dari selisih tick
+// scheduler saat ini dengan 'wave->activationTick'.
 float GetWaveTimerCurrentTime(const EnemyWave *wave);
 
 // Mengirimkan true jika visual timer untuk 'wave' sedang ditampilkan.
@@ -250,8 +302,14 @@ int GetTimerMapCol(const EnemyWave *wave);
 // F.S. : HP 'enemy' diatur menjadi nilai 'hp' yang baru.
 void SetEnemyHP(Enemy *enemy, int hp);
 
+// I.S. : 'enemy' aktif dengan HP sembarang.
+// F.S. : HP 'enemy' berkurang sebesar 'damage' setelah dikurangi resistansi archetype-nya
+// terhadap 'type'.
+void DamageEnemy(Enemy *enemy, int damage, DamageType type);
+
 // I.S. : Waktu progress timer 'wave' sembarang.
-// F.S. : Properti 'wave->timerCurrentTime' diatur menjadi nilai 'time' yang baru.
+// F.S. : 'wave->activationTick' digeser sehingga progress timer bernilai 'time'. Event aktivasi
+// yang sudah dijadwalkan tidak ikut bergeser; pemanggil menjadwalkan ulang jika perlu.
 void SetWaveTimerCurrentTime(EnemyWave *wave, float time);
 
 // I.S. : Durasi timer 'wave' sembarang.
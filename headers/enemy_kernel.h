@@ -0,0 +1,91 @@
+/* File        : enemy_kernel.h
+* Deskripsi   : Deklarasi untuk modul Enemy Kernel.
+*               State kinematik musuh (jarak tempuh, kecepatan, status stun, HP, dan panjang jalur)
+*               disimpan sebagai array datar per field (SoA) yang indeksnya sama dengan slot di
+*               allActiveEnemies. Kernel pergerakan memproses 4 (SSE2) atau 8 (AVX2) musuh sekaligus
+*               dan menghasilkan daftar indeks musuh yang mati dan yang mencapai ujung jalur.
+*               Jalur skalar dipakai di CPU tanpa SSE2/AVX2 atau pada compiler selain GCC/Clang.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef ENEMY_KERNEL_H
+#define ENEMY_KERNEL_H
+
+#include "raylib.h"
+#include <stdint.h>
+
+#define ENEMY_KERNEL_LANES 8    // Kapasitas array dibulatkan ke kelipatan ini
+
+/* Implementasi kernel yang dipakai. */
+typedef enum {
+    ENEMY_KERNEL_AUTO,      // Pilih yang terbaik yang didukung CPU
+    ENEMY_KERNEL_SCALAR,
+    ENEMY_KERNEL_SSE2,
+    ENEMY_KERNEL_AVX2
+} EnemyKernelMode;
+
+/* State kinematik semua slot musuh dalam bentuk SoA. Slot yang tidak aktif (termasuk
+   padding di akhir array) berada dalam keadaan "diam": kecepatan 0, HP positif, dan
+   panjang jalur tak hingga, sehingga kernel tidak perlu mask aktif. */
+typedef struct {
+    float *distance;
+    float *speed;
+    float *stunned;     // 1 selama di-stun, 0 jika tidak; stun dicabut oleh event scheduler
+    float *pathLength;
+    int32_t *hp;
+    int count;          // Jumlah slot yang dipakai
+    int capacity;       // 'count' dibulatkan ke atas ke kelipatan ENEMY_KERNEL_LANES
+} EnemyKinematics;
+
+/* Daftar indeks slot hasil satu kali pemanggilan kernel. Buffer berukuran 'capacity'. */
+typedef struct {
+    int *died;
+    int diedCount;
+    int *reachedEnd;
+    int reachedEndCount;
+    int capacity;
+} EnemyKernelEvents;
+
+extern EnemyKinematics enemyKinematics;
+
+/* I.S. : 'kinematics' sembarang.
+   F.S. : 'kinematics' memiliki 'count' slot dalam keadaan diam.
+          Mengembalikan false jika alokasi gagal. */
+bool InitEnemyKinematics(EnemyKinematics *kinematics, int count);
+
+/* I.S. : 'kinematics' mungkin memiliki array yang dialokasikan.
+   F.S. : Semua array dibebaskan dan 'kinematics' kosong. */
+void FreeEnemyKinematics(EnemyKinematics *kinematics);
+
+/* I.S. : 'dest' dan 'src' memiliki kapasitas yang sama.
+   F.S. : Isi semua array 'src' disalin ke 'dest'. */
+void CopyEnemyKinematics(EnemyKinematics *dest, const EnemyKinematics *src);
+
+/* I.S. : 'slot' valid.
+   F.S. : Slot 'slot' berada dalam keadaan diam. */
+void ResetEnemyKinematicsSlot(EnemyKinematics *kinematics, int slot);
+
+/* I.S. : 'events' sembarang.
+   F.S. : 'events' memiliki buffer untuk 'capacity' indeks per daftar.
+          Mengembalikan false jika alokasi gagal. */
+bool InitEnemyKernelEvents(EnemyKernelEvents *events, int capacity);
+
+/* I.S. : 'events' mungkin memiliki buffer yang dialokasikan.
+   F.S. : Buffer dibebaskan dan 'events' kosong. */
+void FreeEnemyKernelEvents(EnemyKernelEvents *events);
+
+/* I.S. : 'kinematics' berisi state frame sebelumnya; kapasitas 'events' >= kapasitas 'kinematics'.
+   F.S. : Slot yang tidak sedang di-stun maju sejauh speed * deltaTime. Slot dengan HP <= 0
+          masuk ke 'died', slot lain yang jaraknya >= panjang jalur masuk ke 'reachedEnd'. Keduanya terurut naik. */
+void RunEnemyMovementKernel(EnemyKinematics *kinematics, float deltaTime, EnemyKernelEvents *events);
+
+/* I.S. : Sembarang.
+   F.S. : Kernel berikutnya memakai 'mode'. Mode yang tidak didukung CPU diturunkan ke
+          mode terbaik yang didukung. */
+void SetEnemyKernelMode(EnemyKernelMode mode);
+
+/* Mengirimkan nama implementasi kernel yang sedang dipakai ("avx2", "sse2", atau "scalar"). */
+const char *GetEnemyKernelName(void);
+
+#endif
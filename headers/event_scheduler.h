@@ -0,0 +1,59 @@
+/* File        : event_scheduler.h
+* Deskripsi   : Deklarasi untuk modul Event Scheduler.
+*               Waktu gameplay dihitung dalam tick tetap (SCHEDULER_TICK_RATE per detik). Semua
+*               kejadian berwaktu (aktivasi wave, spawn musuh, hitung mundur wave berikutnya,
+*               berakhirnya stun, dan berakhirnya pesan status) dijadwalkan sebagai pasangan
+*               (tick, event) di dalam binary heap. Setiap frame hanya event yang sudah jatuh
+*               tempo yang dijalankan, sehingga wave yang sedang menunggu tidak memakan waktu.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef EVENT_SCHEDULER_H
+#define EVENT_SCHEDULER_H
+
+#include "raylib.h"
+
+#define SCHEDULER_TICK_RATE 60
+
+/* Fungsi yang dijalankan saat event jatuh tempo. 'target' dan 'arg' diteruskan apa adanya
+   dari Scheduler_Schedule. */
+typedef void (*ScheduledEventFn)(void *target, int arg);
+
+/* I.S. : Scheduler mungkin berisi event dari sesi sebelumnya.
+   F.S. : Semua event dibuang dan tick kembali ke 0. Buffer heap tetap dipakai ulang. */
+void Scheduler_Reset(void);
+
+/* I.S. : Scheduler mungkin memiliki buffer heap.
+   F.S. : Buffer dibebaskan dan scheduler kosong. */
+void Scheduler_Shutdown(void);
+
+/* I.S. : Scheduler berisi event sembarang.
+   F.S. : 'fn(target, arg)' dijadwalkan pada tick saat ini + 'delayTicks' (minimal tick saat ini).
+          Event dengan tick yang sama dijalankan sesuai urutan penjadwalan.
+          Mengembalikan false jika heap tidak bisa diperbesar. */
+bool Scheduler_Schedule(int delayTicks, ScheduledEventFn fn, void *target, int arg);
+
+/* I.S. : Scheduler mungkin berisi event untuk 'target'.
+   F.S. : Semua event dengan 'target' tersebut dibuang. Dipanggil sebelum objek target dibebaskan. */
+void Scheduler_CancelTarget(const void *target);
+
+/* I.S. : Tick dan sisa waktu dari frame sebelumnya.
+   F.S. : 'deltaTime' ditambahkan ke akumulator, tick maju sebanyak tick penuh yang terkumpul,
+          lalu semua event dengan tick <= tick saat ini dijalankan berurutan. Event yang
+          dijadwalkan oleh handler dengan tick yang sudah lewat ikut dijalankan pada frame ini. */
+void Scheduler_Advance(float deltaTime);
+
+/* Mengirimkan tick saat ini. */
+int Scheduler_GetTick(void);
+
+/* Mengirimkan jumlah event yang masih menunggu. */
+int Scheduler_GetPendingCount(void);
+
+/* Mengirimkan 'seconds' yang dibulatkan ke tick terdekat. Durasi positif minimal satu tick. */
+int Scheduler_SecondsToTicks(float seconds);
+
+/* Mengirimkan lama 'ticks' dalam detik. */
+float Scheduler_TicksToSeconds(int ticks);
+
+#endif
@@ -0,0 +1,56 @@
+/* File        : flow_field.h
+* Deskripsi   : Deklarasi untuk modul Flow Field.
+*               Pada peta bermode flow field, musuh tidak mengikuti rute tetap. Satu medan jarak
+*               (jumlah langkah ke tile exit terdekat) dihitung dengan BFS multi-sumber atas
+*               gameMap, lalu setiap musuh cukup melangkah ke tetangga yang jaraknya lebih kecil.
+*               Tile jalan (1) dan tile tower yang kosong (4) bisa dilewati; tower yang dipasang
+*               memblokir tile-nya. Perubahan tile diperbaiki secara inkremental hanya pada
+*               daerah yang terpengaruh, bukan dengan BFS ulang seluruh peta.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include "raylib.h"
+#include "map.h"
+#include <limits.h>
+
+#define FLOW_FIELD_UNREACHABLE INT_MAX
+
+/* I.S. : Flow field mungkin aktif untuk peta sebelumnya.
+   F.S. : Flow field aktif untuk gameMap saat ini. Tile exit adalah tile jalan (1) di tepi peta
+          yang bukan salah satu 'spawns'. Mengembalikan false jika alokasi gagal atau tidak ada
+          titik awal yang bisa mencapai exit; flow field tidak aktif dalam kasus itu. */
+bool FlowField_Build(const SpawnPoint *spawns, int spawnCount);
+
+/* I.S. : Flow field mungkin aktif.
+   F.S. : Buffer flow field dibebaskan dan flow field tidak aktif. */
+void FlowField_Clear(void);
+
+/* Mengirimkan true jika peta saat ini memakai flow field. */
+bool FlowField_IsActive(void);
+
+/* I.S. : Tile (row, col) pada gameMap baru saja berubah nilai.
+   F.S. : Jika flow field aktif, jarak semua tile yang bergantung pada tile tersebut sudah
+          diperbarui. Tile yang diblokir membuat daerah di belakangnya dihitung ulang dari
+          tepi daerah itu; tile yang dibuka hanya menyebarkan jarak yang lebih pendek. */
+void FlowField_OnTileChanged(int row, int col);
+
+/* Mengirimkan true jika musuh bisa melewati tile (row, col) pada mode flow field. */
+bool FlowField_IsWalkable(int row, int col);
+
+/* Mengirimkan true jika (row, col) adalah tile exit flow field saat ini: tile jalan (1) di tepi
+   peta yang bukan titik awal. */
+bool FlowField_IsExit(int row, int col);
+
+/* Mengirimkan jumlah langkah dari tile (row, col) ke exit terdekat, 0 untuk tile exit, atau
+   FLOW_FIELD_UNREACHABLE jika tile diblokir, tidak terhubung ke exit, atau flow field tidak aktif. */
+int FlowField_GetDistance(int row, int col);
+
+/* Mengirimkan indeks tile (row * cols + col) tetangga 'tile' yang jaraknya paling kecil dan lebih
+   kecil dari jarak 'tile', atau -1 jika tidak ada (tile exit atau terkurung). */
+int FlowField_NextTile(int tile);
+
+#endif
@@ -66,4 +66,7 @@ float GetMapScreenOffsetX(void);
 //Mengirimkan nilai offset Y layar peta saat ini.
 float GetMapScreenOffsetY(void);
 
+//Mengirimkan jumlah gelombang yang sedang aktif (sedang hitung mundur atau masih memiliki musuh).
+int GetActiveWaveCount(void);
+
 #endif
\ No newline at end of file
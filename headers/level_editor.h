@@ -12,6 +12,7 @@
 #include "common.h"
 #include "raylib.h"
 #include "map.h"
+#include "wave_script.h"
 
 #define EDITOR_BUTTON_WIDTH_FACTOR 1.0f
 #define EDITOR_BUTTON_HEIGHT_FACTOR 1.0f
@@ -38,13 +39,15 @@ typedef enum
 /* Struct ini menampung semua data yang dibutuhkan selama sesi editing. */
 typedef struct
 {
-    int map[MAP_ROWS][MAP_COLS];
-    int baseGameMap[MAP_ROWS][MAP_COLS];
+    TileGrid map;
     EditorTool selectedTool;
     bool wavePanelActive;
-    int startRow; 
-    int startCol;
+    SpawnPoint startPoints[MAX_SPAWN_POINTS];
+    int startPointCount;
     int waveCount;
+    WaveScript waveScript;  // Baris "wave ..." dari file peta, disimpan kembali apa adanya
+    bool flowFieldMode;     // Musuh mengikuti flow field (tower bisa menutup jalan) alih-alih rute tetap
+    bool mazeMode;          // Tower boleh dipasang di tile jalan; selalu disertai flowFieldMode
     bool isDraggingPath;
     Texture2D pathButtonTex;
     Texture2D towerButtonTex;
@@ -66,9 +69,9 @@ extern bool editorInitialized;
 extern LevelEditorState editorState;
 
 /* I.S. : State level editor belum terinisialisasi.
-   F.S. : Seluruh state editor, termasuk salinan peta, tool yang dipilih, dan aset UI,
-          telah diinisialisasi dan siap digunakan. */
-void InitializeLevelEditor(const int current_game_map[MAP_ROWS][MAP_COLS]);
+   F.S. : Seluruh state editor, termasuk peta kosong seukuran 'currentGameMap', tool yang
+          dipilih, dan aset UI, telah diinisialisasi dan siap digunakan. */
+void InitializeLevelEditor(const TileGrid *currentGameMap);
 
 /* I.S. : Aset-aset untuk level editor (seperti tekstur tombol) sedang dimuat di memori.
    F.S. : Semua aset yang dialokasikan untuk level editor telah dibebaskan dari memori. */
@@ -85,8 +88,9 @@ void HandleLevelEditorInput(float globalScale, float offsetX, float offsetY);
 void DrawLevelEditor(float globalScale, float offsetX, float offsetY);
 
 /* I.S. : State editor berisi data peta lama atau kosong.
-   F.S. : State editor (peta, wave count, start point) telah diisi dengan data yang dibaca
-          dari 'fileName'. Mengembalikan true jika berhasil, false jika gagal. */
+   F.S. : State editor (ukuran peta, peta, wave count, skrip wave, start point) telah diisi dengan data
+          yang dibaca dari 'fileName'. File tanpa baris "size" dianggap berukuran
+          DEFAULT_MAP_ROWS x DEFAULT_MAP_COLS. Mengembalikan true jika berhasil, false jika gagal. */
 bool LoadLevelFromFile(const char *fileName);
 
 /* I.S. : State editor berisi data peta yang akan disimpan.
@@ -119,17 +123,29 @@ bool GetEditorRequestSaveAndPlay();
 /* Mengirimkan ID tile pada posisi (row, col) dari peta yang ada di editor. */
 int GetEditorMapTile(int row, int col);
 
+/* Mengirimkan pointer ke grid peta yang ada di editor (beserta ukurannya). */
+const TileGrid *GetEditorMap(void);
+
 /* Mengirimkan path file dari peta yang sedang dikerjakan. */
 const char *GetEditorMapFileName();
 
 /* Mengirimkan jumlah gelombang yang telah diatur di editor. */
 int GetEditorWaveCount();
 
-/* Mengirimkan posisi baris titik awal musuh yang telah diatur. */
-int GetEditorStartRow(); 
+/* Mengirimkan skrip wave peta di editor (kosong jika peta memakai komposisi bawaan). */
+const WaveScript *GetEditorWaveScript(void);
+
+/* Mengirimkan array titik awal musuh yang telah diatur (sebanyak GetEditorStartPointCount()). */
+const SpawnPoint *GetEditorStartPoints(void);
+
+/* Mengirimkan jumlah titik awal musuh yang telah diatur. */
+int GetEditorStartPointCount(void);
+
+/* Mengirimkan true jika peta di editor memakai mode flow field. */
+bool GetEditorFlowFieldMode(void);
 
-/* Mengirimkan posisi kolom titik awal musuh yang telah diatur. */
-int GetEditorStartCol(); 
+/* Mengirimkan true jika peta di editor memakai mode labirin. */
+bool GetEditorMazeMode(void);
 
 /* I.S. : Tool yang aktif adalah tool sebelumnya.
    F.S. : State tool yang aktif diubah menjadi 'tool'. */
@@ -155,12 +171,26 @@ void SetEditorMapFileName(const char *fileName);
    F.S. : Jumlah gelombang di state editor diatur menjadi 'count' (dengan validasi minimal 1). */
 void SetEditorWaveCount(int count);
 
-/* I.S. : Posisi baris titik awal memiliki nilai lama.
-   F.S. : Posisi baris titik awal di state editor diatur menjadi 'row'. */
-void SetEditorStartRow(int row); 
+/* I.S. : Mode pergerakan musuh di editor memiliki nilai lama.
+   F.S. : Peta di editor memakai flow field jika 'enabled' bernilai true, atau rute tetap (dan mode
+          labirin dimatikan) jika false. */
+void SetEditorFlowFieldMode(bool enabled);
+
+/* I.S. : Mode labirin di editor memiliki nilai lama.
+   F.S. : Mode labirin diatur menjadi 'enabled'. Mengaktifkan mode labirin juga mengaktifkan flow field. */
+void SetEditorMazeMode(bool enabled);
+
+/* I.S. : State editor berisi titik awal sembarang.
+   F.S. : State editor tidak memiliki titik awal. */
+void ClearEditorStartPoints(void);
+
+/* I.S. : State editor berisi titik awal sembarang.
+   F.S. : (row, col) ditambahkan ke daftar titik awal jika belum ada. Mengembalikan false
+          jika daftar sudah berisi MAX_SPAWN_POINTS titik awal. */
+bool AddEditorStartPoint(int row, int col);
 
-/* I.S. : Posisi kolom titik awal memiliki nilai lama.
-   F.S. : Posisi kolom titik awal di state editor diatur menjadi 'col'. */
-void SetEditorStartCol(int col); 
+/* I.S. : State editor berisi titik awal sembarang.
+   F.S. : (row, col) dihapus dari daftar titik awal. Mengembalikan false jika tidak ada. */
+bool RemoveEditorStartPoint(int row, int col);
 
 #endif
\ No newline at end of file
@@ -3,7 +3,7 @@
 *               Modul ini mengelola semua data dan aset yang berkaitan dengan 
 *               grid peta permainan, termasuk ukuran, data tile, dan tekstur. 
 * Dibuat oleh : Ahmad Riyadh Almaliki
-* Perubahan terakhir : Senin, 9 Juni 2025
+* Perubahan terakhir : Senin, 19 Oktober 2026
 */
 
 #ifndef MAP_H
@@ -12,12 +12,33 @@
 #include "common.h"
 #include "raylib.h"
 
-#define MAX_PATH_POINTS 100
-#define MAP_ROWS 14
-#define MAP_COLS 23
+#define DEFAULT_MAP_ROWS 14
+#define DEFAULT_MAP_COLS 23
+#define MAX_MAP_ROWS 256
+#define MAX_MAP_COLS 256
 #define TILE_SIZE 27
+#define MAX_SPAWN_POINTS 8
 
-extern int gameMap[MAP_ROWS][MAP_COLS];
+/* ADT untuk grid tile dua dimensi yang ukurannya ditentukan saat runtime. */
+/* Data disimpan berurutan per baris di heap; tile (row, col) berada di
+   tiles[row * stride + col]. */
+typedef struct {
+    int rows;
+    int cols;
+    int stride;
+    int *tiles;
+} TileGrid;
+
+/* Titik awal (spawn) musuh pada grid peta. Satu peta boleh memiliki beberapa titik awal. */
+typedef struct {
+    int row;
+    int col;
+} SpawnPoint;
+
+// Akses langsung ke tile tanpa pengecekan batas, untuk loop yang indeksnya sudah pasti valid.
+#define GRID_AT(grid, row, col) ((grid)->tiles[(row) * (grid)->stride + (col)])
+
+extern TileGrid gameMap;
 extern Texture2D tileSheetTex;
 extern Texture2D emptyCircleTex;
 
@@ -38,11 +59,53 @@ F.S:  Keadaan akhir: Peta dirender ke tampilan.
 */
 void DrawMap(float globalScale, float offsetX, float offsetY);
 
+// I.S: Tekstur tilesheet telah dimuat.
+// F.S: Satu tile 'tileIndex' (beserta penanda slot tower) digambar pada 'destRect'.
+void DrawMapTile(int tileIndex, Rectangle destRect, Color tint);
+
 /* I.S. : `gameMap` dapat berisi data apa pun, baik dari peta default, peta kustom yang dimuat, atau hasil modifikasi dari level editor. 
           `defaultGameMap` berisi data peta asli yang tidak pernah berubah.
    F.S. : Isi dari `gameMap` sepenuhnya ditimpa dari 'defaultGameMap' */
 void ResetMapToDefault();
 
+/* I.S. : 'grid' sembarang (boleh sudah berisi data).
+   F.S. : 'grid' berukuran rows x cols dengan semua tile bernilai 0. Data lama dibebaskan.
+          Mengembalikan false jika ukuran tidak valid atau alokasi gagal. */
+bool CreateTileGrid(TileGrid *grid, int rows, int cols);
+
+/* I.S. : 'grid' mungkin memiliki data yang dialokasikan.
+   F.S. : Memori 'grid' dibebaskan dan ukurannya menjadi 0 x 0. */
+void FreeTileGrid(TileGrid *grid);
+
+/* I.S. : 'dest' sembarang, 'src' terdefinisi.
+   F.S. : 'dest' memiliki ukuran dan isi yang sama dengan 'src'.
+          Mengembalikan false jika alokasi gagal. */
+bool CopyTileGrid(TileGrid *dest, const TileGrid *src);
+
+// Mengirimkan true jika (row, col) berada di dalam 'grid'.
+bool IsInsideGrid(const TileGrid *grid, int row, int col);
+
+// Mengambil nilai tile pada (row, col) dari 'grid', atau 0 jika di luar batas.
+int GetGridTile(const TileGrid *grid, int row, int col);
+
+// Mengirimkan true jika (row, col) adalah tile exit 'grid': tile jalan (1) di tepi peta yang bukan
+// salah satu dari 'spawns'. Aturan ini dipakai bersama oleh tabel rute, flow field, dan validator editor.
+bool IsGridExitTile(const TileGrid *grid, const SpawnPoint *spawns, int spawnCount, int row, int col);
+
+// I.S: Tile (row, col) pada 'grid' memiliki nilai lama.
+// F.S: Tile diubah menjadi 'value' jika koordinat valid.
+void SetGridTile(TileGrid *grid, int row, int col, int value);
+
+// I.S: `gameMap` berisi peta lama.
+// F.S: `gameMap` berisi salinan 'source' (ukuran ikut berubah) dan cache chunk ditandai kotor.
+bool LoadGameMapFromGrid(const TileGrid *source);
+
+// Mengembalikan jumlah baris peta gameplay saat ini.
+int GetMapRows(void);
+
+// Mengembalikan jumlah kolom peta gameplay saat ini.
+int GetMapCols(void);
+
 // Mengembalikan persegi untuk ubin berdasarkan indeksnya.
 // Nilai pengembalian: persegi panjang yang menentukan posisi ubin di tilesheet.
 Rectangle GetTileSourceRect(int index);
@@ -53,19 +116,15 @@ int GetMapTile(int row, int col);
 
 // Deskripsi: Mengatur nilai ubin pada koordinat peta yang ditentukan.
 // I.S: Peta dengan nilai ubin yang ada.
-// F.S: Ubin yang ditentukan diperbarui dengan nilai baru.
+// F.S: Ubin yang ditentukan diperbarui dengan nilai baru; flow field (jika aktif) ikut diperbarui.
 void SetMapTile(int row, int col, int value);
 
 // Mengembalikan tekstur tilesheet untuk rendering.
 // Nilai Pengembalian: Tekstur2D yang berisi tilesheet. 
 Texture2D GetTileSheetTexture();
 
-// Mengembalikan jumlah poin di jalur.
-// Nilai Pengembalian: Hitungan Integer dari titik jalur.
-int GetPathCount();
-
-// Mengembalikan titik jalur pada indeks yang ditentukan.
-// Nilai pengembalian: titik vektor2 atau (0,0) jika indeks tidak valid.
-Vector2 GetPathPoint(int index);
+// Mengembalikan nomor revisi gameMap. Nilainya bertambah setiap kali isi peta berubah,
+// sehingga data turunan (misalnya cache jalur) dapat mengetahui bahwa ia sudah usang.
+unsigned int GetMapRevision(void);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+/* File        : map_chunk.h
+* Deskripsi   : Deklarasi untuk modul Chunk Peta (Map Chunk).
+*               Peta dibagi menjadi potongan (chunk) berukuran MAP_CHUNK_SIZE x MAP_CHUNK_SIZE tile.
+*               Setiap chunk digambar sekali ke RenderTexture miliknya sendiri secara lazy
+*               (saat pertama kali terlihat oleh kamera) lalu dipakai ulang setiap frame,
+*               sehingga DrawMap cukup menggambar satu tekstur per chunk, bukan per tile.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef MAP_CHUNK_H
+#define MAP_CHUNK_H
+
+#include "common.h"
+
+#define MAP_CHUNK_SIZE 32           // Jumlah tile per sisi chunk
+#define MAP_CHUNK_TILE_PIXELS 32    // Resolusi tile di dalam tekstur chunk (sama dengan tilesheet)
+#define MAP_CHUNK_CACHE_LIMIT 48    // Jumlah maksimum tekstur chunk yang dimuat bersamaan
+#define MAP_OVERVIEW_TILE_PIXELS 4  // Resolusi tile pada tekstur overview (zoom jauh)
+
+/* I.S. : Tile (row, col) pada 'gameMap' baru saja berubah.
+   F.S. : Chunk yang memuat tile tersebut ditandai kotor dan akan digambar ulang
+          saat berikutnya terlihat. */
+void InvalidateMapChunk(int row, int col);
+
+/* I.S. : Isi atau ukuran 'gameMap' berubah seluruhnya (peta baru dimuat).
+   F.S. : Semua chunk dan tekstur overview ditandai kotor. Jika ukuran peta berubah,
+          tabel chunk dibangun ulang pada pemanggilan DrawMapChunks berikutnya. */
+void InvalidateAllMapChunks(void);
+
+/* I.S. : Chunk yang terlihat mungkin belum memiliki tekstur atau teksturnya kotor.
+   F.S. : Chunk yang terlihat telah (di-)bangun bila perlu dan digambar ke layar.
+          Jika chunk yang terlihat melebihi MAP_CHUNK_CACHE_LIMIT, peta digambar dari
+          satu tekstur overview beresolusi rendah. */
+void DrawMapChunks(float globalScale, float offsetX, float offsetY);
+
+/* I.S. : Tekstur chunk dan overview mungkin sedang dimuat.
+   F.S. : Semua tekstur dan tabel chunk dibebaskan dari memori. */
+void UnloadMapChunks(void);
+
+/* Mengirimkan jumlah tekstur chunk yang sedang dimuat di memori. */
+int GetLoadedMapChunkCount(void);
+
+#endif
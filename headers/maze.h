@@ -0,0 +1,46 @@
+/* File        : maze.h
+* Deskripsi   : Deklarasi untuk modul Maze.
+*               Pada mode labirin, tower boleh dipasang di tile jalan sehingga pemain bisa
+*               membentuk rute musuh sendiri, asalkan tidak ada titik awal yang terputus dari
+*               exit. Tile yang bisa dilewati musuh dianalisis sekali per revisi peta untuk mencari
+*               cut vertex (algoritma Tarjan), sehingga setiap pertanyaan "bolehkah tile ini
+*               ditutup?" dijawab dalam O(1). Setiap tower yang dipasang mengubah revisi, jadi
+*               pertanyaan pertama sesudahnya membayar satu analisis linear (setara satu BFS).
+*               Analisis juga dipakai untuk semua peta flow field, karena tower di slot kosong
+*               pada peta tersebut juga bisa menutup jalan.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef MAZE_H
+#define MAZE_H
+
+#include "raylib.h"
+#include "map.h"
+
+/* I.S. : Konfigurasi labirin untuk level sebelumnya.
+   F.S. : Tower boleh dipasang di tile jalan (1) jika 'mazeMode' true. 'spawns' adalah titik
+          awal yang harus tetap terhubung ke exit. Analisis lama dibuang. */
+void Maze_Configure(bool mazeMode, const SpawnPoint *spawns, int spawnCount);
+
+/* Mengirimkan true jika level saat ini memakai mode labirin. */
+bool Maze_IsEnabled(void);
+
+/* Mengirimkan true jika tower boleh dipasang di tile bernilai 'tileValue': slot tower (4) selalu,
+   tile jalan (1) hanya pada mode labirin. */
+bool Maze_IsBuildableTile(int tileValue);
+
+/* Mengirimkan true jika menutup tile (row, col) memutus salah satu titik awal yang saat ini
+   terhubung ke exit. Hanya berlaku saat flow field aktif; selain itu selalu false.
+   Analisis cut vertex dibangun ulang jika revisi peta sudah berubah sejak analisis terakhir. */
+bool Maze_WouldBlockSpawns(int row, int col);
+
+/* Mengirimkan true jika menutup tile (blockRow, blockCol) memutus tile (row, col) yang saat ini
+   terhubung ke exit. Dipakai untuk tile yang sedang ditempati musuh. */
+bool Maze_WouldIsolateTile(int blockRow, int blockCol, int row, int col);
+
+/* I.S. : Modul mungkin memiliki buffer analisis.
+   F.S. : Buffer dibebaskan dan mode labirin tidak aktif. */
+void Maze_Clear(void);
+
+#endif
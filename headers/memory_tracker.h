@@ -0,0 +1,98 @@
+/* File        : memory_tracker.h
+* Deskripsi   : Deklarasi untuk modul Memory Tracker.
+*               Modul ini membungkus alokasi heap dan mencatat tekstur serta sound yang
+*               dimuat, lalu menghitung byte yang hidup, puncak byte, dan jumlah alokasi
+*               per subsistem (tag). Ringkasannya ditampilkan di overlay profiler (F3)
+*               dan ditulis ke log saat UnloadGameplay.
+*               Semua fungsi hanya boleh dipanggil dari thread utama.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef MEMORY_TRACKER_H
+#define MEMORY_TRACKER_H
+
+#include "raylib.h"
+#include <stddef.h>
+
+#define MEMORY_MAX_TRACKED_TEXTURES 512
+#define MEMORY_MAX_TRACKED_SOUNDS 64
+
+/* Subsistem pemilik sebuah alokasi atau aset. */
+typedef enum {
+    MEM_TAG_ENEMY,
+    MEM_TAG_TOWER,
+    MEM_TAG_WAVE,
+    MEM_TAG_UPGRADE,
+    MEM_TAG_EDITOR,
+    MEM_TAG_AUDIO,
+    MEM_TAG_MAP,
+    MEM_TAG_OTHER,      // Menu, HUD, transisi, dan lain-lain
+    MEM_TAG_COUNT
+} MemoryTag;
+
+/* Statistik satu tag, untuk heap atau untuk aset (tekstur/sound). */
+typedef struct {
+    size_t liveBytes;
+    size_t peakBytes;
+    int liveCount;
+    int totalAllocs;
+    int totalFrees;
+} MemoryStats;
+
+/* I.S. : Sembarang.
+   F.S. : Mengembalikan blok berukuran 'size' byte yang dicatat atas nama 'tag',
+          atau NULL jika alokasi gagal. Blok harus dibebaskan dengan Memory_Free. */
+void *Memory_Alloc(MemoryTag tag, size_t size);
+
+/* I.S. : Sembarang.
+   F.S. : Sama seperti Memory_Alloc, tetapi untuk 'count' elemen berukuran 'size'
+          dan isinya diinisialisasi nol. */
+void *Memory_Calloc(MemoryTag tag, size_t count, size_t size);
+
+/* I.S. : 'ptr' NULL atau blok dari Memory_Alloc/Calloc/Realloc.
+   F.S. : Blok diubah ukurannya menjadi 'size' byte dan dicatat atas nama 'tag'.
+          Jika gagal, mengembalikan NULL dan blok lama tetap utuh. */
+void *Memory_Realloc(MemoryTag tag, void *ptr, size_t size);
+
+/* I.S. : 'ptr' NULL atau blok dari Memory_Alloc/Calloc/Realloc/StrDup.
+   F.S. : Blok dibebaskan dan statistik tag pemiliknya diperbarui. */
+void Memory_Free(void *ptr);
+
+/* Mengirimkan salinan 'text' yang dialokasikan atas nama 'tag' (bebaskan dengan Memory_Free). */
+char *Memory_StrDup(MemoryTag tag, const char *text);
+
+/* I.S. : 'texture' baru saja dimuat.
+   F.S. : Ukuran data piksel 'texture' dicatat atas nama 'tag'. */
+void Memory_TrackTexture(MemoryTag tag, Texture2D texture);
+
+/* I.S. : 'texture' akan di-unload.
+   F.S. : Catatan 'texture' dihapus dari registri. */
+void Memory_UntrackTexture(Texture2D texture);
+
+/* I.S. : 'sound' baru saja dimuat.
+   F.S. : Ukuran sampel 'sound' dicatat atas nama 'tag'. */
+void Memory_TrackSound(MemoryTag tag, Sound sound);
+
+/* I.S. : 'sound' akan di-unload.
+   F.S. : Catatan 'sound' dihapus dari registri. */
+void Memory_UntrackSound(Sound sound);
+
+/* Mengirimkan statistik heap untuk 'tag'. */
+MemoryStats Memory_GetHeapStats(MemoryTag tag);
+
+/* Mengirimkan statistik aset (tekstur dan sound) untuk 'tag'. */
+MemoryStats Memory_GetAssetStats(MemoryTag tag);
+
+/* Mengirimkan nama 'tag' untuk ditampilkan. */
+const char *Memory_GetTagName(MemoryTag tag);
+
+/* I.S. : Sembarang.
+   F.S. : Ringkasan statistik heap dan aset per tag ditulis ke log dengan label 'context'. */
+void Memory_LogReport(const char *context);
+
+/* I.S. : Sedang di dalam BeginDrawing/EndDrawing.
+   F.S. : Tabel statistik per tag digambar mulai dari (x, y). Mengembalikan tinggi tabel. */
+int DrawMemoryTable(int x, int y, int fontSize, int lineHeight);
+
+#endif
@@ -0,0 +1,104 @@
+/* File        : path_cache.h
+* Deskripsi   : Deklarasi untuk modul Path Cache.
+*               Semua rute musuh pada sebuah peta dienumerasi satu kali saat level dimuat ke
+*               dalam tabel rute: dari setiap titik awal, setiap percabangan jalan menghasilkan
+*               rute terpisah. Tabel untuk pasangan (revisi peta, daftar titik awal) dipakai
+*               bersama oleh semua wave lewat sebuah handle, dan setiap musuh cukup menyimpan
+*               id rute serta jarak tempuhnya.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef PATH_CACHE_H
+#define PATH_CACHE_H
+
+#include "raylib.h"
+#include "map.h"
+
+#define PATH_CACHE_MAX_ENTRIES 4
+#define ROUTE_TABLE_MAX_ROUTES_PER_SPAWN 16
+
+/* ADT untuk satu rute. Titik-titiknya adalah pusat tile dalam koordinat dunia (piksel
+   peta sebelum diskala). Rute juga menyimpan parameterisasi panjang busur:
+   cumulativeLengths[i] adalah jarak dari titik awal ke points[i], dan directions[i]
+   adalah vektor satuan dari points[i] ke points[i + 1]. Dengan begitu posisi musuh cukup
+   diturunkan dari satu skalar jarak tempuh. Ketiga array menunjuk ke pool milik RouteTable. */
+typedef struct {
+    Vector2 *points;
+    float *cumulativeLengths;   // 'count' elemen, elemen pertama selalu 0
+    Vector2 *directions;        // 'count - 1' elemen
+    float totalLength;
+    int count;
+    int spawnIndex;             // Indeks titik awal rute ini di RouteTable.spawns
+} MapPath;
+
+/* ADT untuk tabel semua rute dari sekumpulan titik awal. Rute milik titik awal ke-i
+   adalah routes[spawnFirstRoute[i]] sampai routes[spawnFirstRoute[i] + spawnRouteCount[i] - 1].
+   Titik semua rute disimpan berurutan dalam satu pool sehingga tabel hanya memiliki
+   empat blok memori berapa pun jumlah rutenya. */
+typedef struct {
+    MapPath *routes;
+    int routeCount;
+    SpawnPoint spawns[MAX_SPAWN_POINTS];
+    int spawnFirstRoute[MAX_SPAWN_POINTS];
+    int spawnRouteCount[MAX_SPAWN_POINTS];
+    int spawnCount;
+    Vector2 *pointPool;
+    float *lengthPool;
+    Vector2 *directionPool;
+    int poolCount;
+    unsigned int mapRevision;
+    int refCount;
+} RouteTable;
+
+/* I.S. : 'table' kosong atau berisi tabel lama.
+   F.S. : 'table' berisi semua rute pada gameMap dari 'spawns'. Dari setiap titik awal, jalan
+          ditelusuri secara depth-first dengan urutan arah atas, kanan, bawah, kiri; setiap
+          cabang yang mencapai tile exit (IsGridExitTile, aturan yang sama dengan validator
+          editor) menghasilkan satu rute yang berakhir di exit tersebut. Cabang yang buntu di
+          tengah peta tidak menghasilkan rute. Titik awal yang bukan tile jalan atau tidak
+          terhubung ke exit tidak memiliki rute. Buffer lama dibebaskan.
+          Mengembalikan false jika tidak ada rute sama sekali atau alokasi gagal. */
+bool BuildRouteTable(RouteTable *table, const SpawnPoint *spawns, int spawnCount);
+
+/* I.S. : 'table' mungkin memiliki buffer yang dialokasikan.
+   F.S. : Buffer 'table' dibebaskan dan 'table' menjadi kosong. */
+void FreeRouteTable(RouteTable *table);
+
+/* Mengirimkan rute dengan id 'routeId' dari 'table', atau NULL jika id tidak valid. */
+const MapPath *GetRoute(const RouteTable *table, int routeId);
+
+/* Mengirimkan id rute ke-'ordinal' (dibungkus modulo jumlah rute) milik titik awal
+   'spawnIndex' (dibungkus modulo jumlah titik awal). Titik awal tanpa rute dilewati ke
+   titik awal berikutnya. Mengirimkan -1 jika tabel kosong. */
+int GetSpawnRouteId(const RouteTable *table, int spawnIndex, int ordinal);
+
+/* I.S. : 'path' memiliki minimal dua titik; '*segmentHint' adalah segmen hasil pemanggilan
+          sebelumnya untuk musuh yang sama (atau 0).
+   F.S. : Mengembalikan posisi pada jarak 'distance' dari titik awal (dibatasi ke ujung jalur).
+          '*segmentHint' diperbarui ke segmen yang memuat posisi tersebut. Jika jarak hanya
+          maju sedikit, pencarian cukup melangkah dari petunjuk; jika tidak, memakai binary search. */
+Vector2 GetMapPathPosition(const MapPath *path, float distance, int *segmentHint);
+
+/* I.S. : Cache mungkin sudah berisi tabel rute untuk revisi peta saat ini.
+   F.S. : Mengembalikan handle tabel rute dari 'spawns' untuk revisi gameMap saat ini;
+          tabel dibangun jika belum ada di cache. Jumlah referensinya bertambah satu.
+          Mengembalikan NULL jika cache penuh oleh tabel yang masih dipakai.
+          Handle tetap valid sampai dilepas dengan PathCache_Release, walaupun peta berubah. */
+const RouteTable *PathCache_Acquire(const SpawnPoint *spawns, int spawnCount);
+
+/* I.S. : 'table' adalah handle dari PathCache_Acquire atau NULL.
+   F.S. : Jumlah referensi 'table' berkurang satu. Tabel tetap di cache untuk dipakai ulang
+          sampai revisi peta berubah. */
+void PathCache_Release(const RouteTable *table);
+
+/* I.S. : Cache berisi tabel rute sembarang.
+   F.S. : Tabel rute dari 'spawns' untuk revisi peta saat ini sudah ada di cache.
+          Mengembalikan jumlah rute di tabel tersebut (0 jika tidak ada rute yang valid). */
+int PathCache_Prepare(const SpawnPoint *spawns, int spawnCount);
+
+/* I.S. : Cache berisi tabel rute sembarang.
+   F.S. : Semua tabel yang tidak sedang dipakai dibebaskan. */
+void PathCache_Clear(void);
+
+#endif
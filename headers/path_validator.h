@@ -0,0 +1,51 @@
+/* File        : path_validator.h
+* Deskripsi   : Deklarasi untuk modul Path Validator.
+*               Level editor perlu tahu setiap saat apakah semua titik awal masih terhubung ke
+*               exit, termasuk di tengah drag tool jalan. Modul ini menyimpan jarak terpendek
+*               dari setiap tile ke exit dengan Lifelong Planning A* (LPA*): pencarian berjalan
+*               mundur dari semua exit ke titik awal, dan setiap perubahan tile hanya memperbaiki
+*               tile yang jaraknya benar-benar berubah, bukan membangun ulang seluruh peta.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef PATH_VALIDATOR_H
+#define PATH_VALIDATOR_H
+
+#include "raylib.h"
+#include "map.h"
+#include <limits.h>
+
+#define PATH_VALIDATOR_UNREACHABLE INT_MAX
+
+/* I.S. : Validator mungkin berisi hasil untuk peta sebelumnya.
+   F.S. : Validator mengikuti 'grid' dengan titik awal 'spawns'. Tile jalan (1) bisa dilewati;
+          jika 'flowFieldMode' true, slot tower (4) juga bisa dilewati. Tile exit adalah tile
+          jalan di tepi peta yang bukan titik awal. Jarak setiap titik awal sudah dihitung.
+          'grid' harus tetap hidup selama validator dipakai.
+          Mengembalikan PathValidator_IsValid(), atau false jika alokasi gagal. */
+bool PathValidator_Rebuild(const TileGrid *grid, const SpawnPoint *spawns, int spawnCount, bool flowFieldMode);
+
+/* I.S. : Tile (row, col) pada grid validator baru saja berubah nilai.
+   F.S. : Jarak semua titik awal sudah diperbarui. Hanya tile yang jaraknya terpengaruh
+          yang diproses ulang. Jika ukuran grid berubah, validator dibangun ulang penuh. */
+void PathValidator_OnTileChanged(int row, int col);
+
+/* Mengirimkan true jika ada minimal satu titik awal dan semua titik awal terhubung ke exit. */
+bool PathValidator_IsValid(void);
+
+/* Mengirimkan jumlah langkah terpendek dari titik awal ke-'spawnIndex' ke exit, atau
+   PATH_VALIDATOR_UNREACHABLE jika titik awal tidak terhubung atau indeks tidak valid. */
+int PathValidator_GetSpawnDistance(int spawnIndex);
+
+/* I.S. : 'tiles' memiliki ruang untuk 'maxTiles' indeks.
+   F.S. : 'tiles' berisi indeks tile (row * cols + col) rute terpendek dari titik awal
+          ke-'spawnIndex' sampai exit. Mengembalikan jumlah tile yang ditulis, atau 0 jika
+          titik awal tidak terhubung. Rute dipotong jika lebih panjang dari 'maxTiles'. */
+int PathValidator_GetRoute(int spawnIndex, int *tiles, int maxTiles);
+
+/* I.S. : Validator mungkin memiliki buffer yang dialokasikan.
+   F.S. : Buffer dibebaskan dan validator kosong. */
+void PathValidator_Free(void);
+
+#endif
@@ -0,0 +1,77 @@
+/* File        : profiler.h
+* Deskripsi   : Deklarasi untuk modul Profiler.
+*               Modul ini mengukur waktu yang dihabiskan setiap subsistem per frame,
+*               menyimpannya dalam riwayat ring buffer, menampilkan grafik overlay
+*               (toggle dengan F3), dan menulis riwayat ke file CSV saat program ditutup.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "common.h"
+
+#define PROFILER_HISTORY_FRAMES 600
+#define PROFILER_TOGGLE_KEY KEY_F3
+
+/* Enum untuk semua bagian (section) kode yang diukur oleh profiler. */
+typedef enum {
+    PROF_UPDATE_GAMEPLAY,
+    PROF_ENEMIES_UPDATE,
+    PROF_TOWER_ATTACKS,
+    PROF_UPDATE_SHOTS,
+    PROF_UPDATE_STATUS,
+    PROF_UPDATE_AUDIO,
+    PROF_DRAW_MAP,
+    PROF_ENEMIES_DRAW,
+    PROF_DRAW_TOWERS,
+    PROF_DRAW_SHOTS,
+    PROF_SECTION_COUNT
+} ProfileSection;
+
+/* Makro pengukuran. Kompilasi dengan -DDISABLE_PROFILER untuk menghapus semua
+   instrumentasi tanpa mengubah pemanggilnya. */
+#ifdef DISABLE_PROFILER
+#define PROFILE_BEGIN(section) ((void)0)
+#define PROFILE_END(section) ((void)0)
+#else
+#define PROFILE_BEGIN(section) Profiler_BeginSection(section)
+#define PROFILE_END(section) Profiler_EndSection(section)
+#endif
+
+/* I.S. : Frame sebelumnya telah selesai atau profiler belum pernah dipakai.
+   F.S. : Slot riwayat untuk frame baru telah dikosongkan dan waktu mulai frame dicatat. */
+void Profiler_BeginFrame(void);
+
+/* I.S. : Frame sedang berjalan.
+   F.S. : Total waktu frame dicatat dan indeks ring buffer maju ke slot berikutnya. */
+void Profiler_EndFrame(void);
+
+/* I.S. : 'section' belum sedang diukur.
+   F.S. : Waktu mulai 'section' dicatat. */
+void Profiler_BeginSection(ProfileSection section);
+
+/* I.S. : 'section' sedang diukur (Profiler_BeginSection telah dipanggil).
+   F.S. : Waktu yang berlalu sejak Profiler_BeginSection ditambahkan ke frame saat ini.
+          Section yang dipanggil beberapa kali dalam satu frame diakumulasi. */
+void Profiler_EndSection(ProfileSection section);
+
+/* I.S. : Overlay profiler dalam keadaan tampil atau tersembunyi.
+   F.S. : Keadaan overlay dibalik jika tombol PROFILER_TOGGLE_KEY ditekan. */
+void Profiler_HandleInput(void);
+
+/* I.S. : Riwayat profiler berisi data frame terakhir.
+   F.S. : Jika overlay aktif, grafik batang bertumpuk per frame dan tabel rata-rata
+          per section telah digambar ke layar. */
+void DrawProfilerOverlay(void);
+
+/* I.S. : Riwayat profiler berisi data hingga PROFILER_HISTORY_FRAMES frame terakhir.
+   F.S. : Riwayat ditulis ke 'fileName' dalam format CSV (satu baris per frame, milidetik).
+          Mengembalikan false jika file tidak dapat dibuka atau belum ada data. */
+bool Profiler_DumpCSV(const char *fileName);
+
+/* Mengirimkan rata-rata waktu (milidetik) 'section' selama riwayat yang tersimpan. */
+double Profiler_GetAverageMs(ProfileSection section);
+
+#endif
@@ -0,0 +1,50 @@
+/* File        : shot_batch.h
+* Deskripsi   : Deklarasi untuk modul Shot Batch.
+*               Efek visual tembakan digambar per tipe sebagai satu mesh (satu draw call per tipe
+*               per frame). Setiap efek menempati satu quad di slot yang sama dengan slot pool-nya.
+*               Data quad (posisi, warna, waktu mulai, durasi, ukuran) hanya ditulis saat efek
+*               di-spawn; posisi proyektil, ukuran, dan fade dihitung di shader dari jam efek,
+*               sehingga CPU tidak mengerjakan apa pun per efek per frame.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef SHOT_BATCH_H
+#define SHOT_BATCH_H
+
+#include "tower.h"
+
+#define SHOT_BATCH_MAX_EFFECTS 16384    // Batas quad per tipe agar indeks muat di unsigned short
+
+/* I.S. : Jendela dan konteks OpenGL sudah dibuat. Shader batch belum dimuat.
+   F.S. : Shader batch dimuat. Mengembalikan false jika shader gagal dikompilasi; efek
+          kemudian digambar satu per satu oleh DrawShots. */
+bool ShotBatch_Init(void);
+
+/* I.S. : Shader dan mesh batch mungkin sedang dimuat.
+   F.S. : Semua mesh, shader, dan buffer CPU batch dibebaskan. */
+void ShotBatch_Shutdown(void);
+
+/* Mengirimkan true jika efek digambar lewat batch. */
+bool ShotBatch_IsReady(void);
+
+/* Mengirimkan jumlah slot quad yang dimiliki mesh batch tipe 'type'. */
+int ShotBatch_GetCapacity(ShotType type);
+
+/* I.S. : Mesh batch tipe 'type' memiliki kapasitas sembarang.
+   F.S. : Mesh diperbesar sampai 'capacity' slot, paling banyak SHOT_BATCH_MAX_EFFECTS. Isi slot
+          lama dipertahankan. Mengembalikan true jika mesh sekarang memuat 'capacity' slot; false
+          jika 'capacity' melebihi batas (mesh mungkin tetap diperbesar sampai batas) atau mesh
+          tidak bisa dibuat. */
+bool ShotBatch_Reserve(ShotType type, int capacity);
+
+/* I.S. : 'slot' adalah slot pool tempat 'shot' baru disimpan.
+   F.S. : Quad di 'slot' ditulis ulang dari 'shot' dan diunggah ke GPU pada gambar berikutnya. */
+void ShotBatch_Write(ShotType type, int slot, const Shot *shot);
+
+/* I.S. : Quad tipe 'type' di slot 0..'slotCount'-1 berisi efek hidup atau yang sudah selesai.
+   F.S. : Semua quad tersebut digambar dalam satu draw call. Efek yang belum mulai atau sudah
+          selesai pada waktu 'time' diciutkan oleh shader sehingga tidak terlihat. */
+void ShotBatch_Draw(ShotType type, int slotCount, float time, float globalScale, float offsetX, float offsetY);
+
+#endif
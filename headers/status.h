@@ -21,6 +21,7 @@ typedef struct {
     infotype messages[MAX_STACK_SIZE];
     float alphas[MAX_STACK_SIZE];
     float timers[MAX_STACK_SIZE];
+    unsigned int serials[MAX_STACK_SIZE];
     float posX[MAX_STACK_SIZE]; 
 } Stack;
 
@@ -40,7 +41,8 @@ bool IsStackEmpty(Stack S);
 void Push(Stack *S, const char* message);
 
 /* IS : S adalah stack status. */
-/* FS : Timer dan alpha dari setiap pesan di dalam S di-update. */
+/* FS : Posisi dan alpha dari setiap pesan di dalam S di-update. Masa tampil pesan
+        diakhiri oleh event scheduler, bukan dihitung mundur di sini. */
 void UpdateStatus(Stack *S, float deltaTime);
 
 /* Menggambar isi stack ke layar, dengan elemen TOP di paling atas. */
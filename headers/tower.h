@@ -10,6 +10,7 @@
 #define TOWER_H
 #include "common.h"
 #include "map.h"
+#include <stdint.h>
 
 #define TOWER_FRAME_WIDTH 70
 #define TOWER_FRAME_HEIGHT 130
@@ -20,7 +21,14 @@
 #define ORBIT_BUTTON_DRAW_SCALE 1.0f 
 #define ORBIT_RADIUS_TILE_FACTOR 1.0f
 
-#define MAX_VISUAL_SHOTS 50 
+#define TOWER_BASE_COST 50
+#define TOWER_BASE_DAMAGE 25
+#define TOWER_BASE_RANGE 100.0f
+#define TOWER_BASE_ATTACK_SPEED 1.0f
+
+#define SHOT_POOL_INITIAL_CAPACITY 64     // Kapasitas awal pool efek visual per tipe; digandakan saat penuh
+#define CHAIN_BEAM_DURATION 0.15f         // Lama beam serangan berantai terlihat (detik)
+#define SHOT_QUEUE_INITIAL_CAPACITY 256   // Kapasitas awal antrian efek yang di-spawn dalam satu frame
 
 struct EnemyWave; 
 
@@ -41,8 +49,10 @@ typedef struct Tower{
     int row; 
     int col; 
     int totalCost;
+    int groundTile;     // Nilai tile sebelum tower dipasang (4, atau 1 pada mode labirin)
     struct Tower *next; 
-    bool purchasedUpgrades[UPGRADE_MASS_SLOW + 1]; 
+    uint64_t *upgradeBits;      // Bitset upgrade yang dibeli, bit ke-i = node pohon pipih ke-i; NULL jika belum ada
+    int upgradeBitWords;
     
     bool hasChainAttack;
     int chainJumps;
@@ -64,23 +74,20 @@ typedef enum {
     SHOT_TYPE_NORMAL_IMPACT, 
     SHOT_TYPE_PROJECTILE,
     SHOT_TYPE_AOE_BLAST,
-    SHOT_TYPE_CRIT_SHATTER
+    SHOT_TYPE_CRIT_SHATTER,
+    SHOT_TYPE_CHAIN_BEAM,
+    SHOT_TYPE_COUNT
 } ShotType;
 
-//Struct Tembakan
+//Struct Tembakan. Keadaan efek pada setiap saat dihitung dari jam efek, 'startTime', dan 'duration'.
 typedef struct {
     Vector2 startPos;  
-    Vector2 endPos;    
+    Vector2 endPos;         // Sama dengan 'startPos' untuk efek tumbukan
     Color color;    
-    float travelTime;  
-    float currentTravelTime; 
-    bool active;       
     ShotType type; 
-    float radius;      
-    bool isImpactEffect;     
-    float impactTimer;       
-    float impactDuration;    
-    float impactMaxSize;
+    float size;             // Jari-jari proyektil, ukuran maksimum efek tumbukan, atau setengah lebar beam (piksel)
+    float startTime;        // Waktu jam efek saat efek mulai terlihat
+    float duration;         // Lama terbang proyektil, atau lama animasi efek lainnya
 } Shot;
 
 extern Texture2D tower1Texture;
@@ -100,8 +107,9 @@ extern Texture2D upgradeButtonTex;
    F.S. : Semua aset yang diperlukan oleh modul Tower telah dimuat ke memori. */
 void InitTowerAssets();
 
-/* I.S. : Sistem visual tembakan (shots) belum siap digunakan.
-   F.S. : Array internal untuk menampung efek visual telah diinisialisasi dan siap digunakan. */
+/* I.S. : Sistem visual tembakan (shots) belum siap digunakan, atau berisi efek dari sesi sebelumnya.
+   F.S. : Pool dan antrian efek visual kosong, jam efek kembali ke 0, dan sistem siap digunakan.
+          Buffer yang sudah ada dipakai ulang. */
 void InitShots(void);
 
 /* I.S. : Aset-aset tower sedang digunakan.
@@ -110,28 +118,41 @@ void InitShots(void);
 void ShutdownTowerAssets();
 
 /* I.S. : Sistem visual tembakan sedang berjalan.
-   F.S. : Tidak ada tindakan spesifik di implementasi saat ini, namun disiapkan untuk dealokasi di masa depan. */
+   F.S. : Pool dan antrian efek visual dibebaskan. */
 void ShutdownShots(void);
 
+/* Catatan: SpawnProjectile dan SpawnImpactEffect hanya memesan slot di antrian efek dengan satu
+   operasi atomik, sehingga boleh dipanggil dari beberapa thread sekaligus. Efeknya masuk ke pool
+   pada UpdateShots/DrawShots berikutnya, yang harus dipanggil dari thread utama. */
+
 /* I.S. : Aksi dalam game (misalnya serangan tower) terjadi.
-   F.S. : Sebuah efek visual proyektil baru yang bergerak dari 'startPos' ke 'endPos' dibuat dan diaktifkan. */
+   F.S. : Sebuah efek visual proyektil baru yang bergerak dari 'startPos' ke 'endPos' dibuat dan diaktifkan,
+          diikuti efek tumbukan biasa di 'endPos' yang mulai saat proyektil tiba. */
 void SpawnProjectile(Vector2 startPos, Vector2 endPos, Color color, float radius, float travelTime);
 
 /* I.S. : Sebuah proyektil mengenai target atau sebuah serangan area terjadi.
    F.S. : Sebuah efek visual tumbukan (impact) dengan tipe tertentu ('type') dibuat dan diaktifkan di 'position'. */
 void SpawnImpactEffect(Vector2 position, ShotType type, Color color);
 
-/* I.S. : Posisi dan durasi semua efek visual pada frame sebelumnya.
-   F.S. : Posisi proyektil diperbarui, dan durasi animasi untuk efek tumbukan dikurangi berdasarkan 'deltaTime'.*/
+/* I.S. : Sebuah serangan berantai melompat dari 'startPos' ke 'endPos'.
+   F.S. : Sebuah efek visual beam dari 'startPos' ke 'endPos' dibuat dan memudar selama CHAIN_BEAM_DURATION. */
+void SpawnChainBeam(Vector2 startPos, Vector2 endPos, Color color);
+
+/* I.S. : Jam efek dan pool efek visual pada frame sebelumnya.
+   F.S. : Efek di antrian masuk ke pool, jam efek maju sebesar 'deltaTime', dan efek yang sudah
+          selesai dikembalikan ke free-list. Posisi dan animasi efek dihitung dari jam saat digambar. */
 void UpdateShots(float deltaTime);
 
 /* I.S. : Terdapat efek visual (shots) yang aktif.
-   F.S. : Semua efek visual yang 'active' digambar ke layar sesuai dengan tipe dan propertinya. */
+   F.S. : Efek di antrian masuk ke pool, lalu semua efek yang hidup digambar ke layar sesuai
+          dengan tipe dan propertinya: satu draw call per tipe jika shader batch tersedia,
+          atau satu per satu dengan fungsi gambar raylib jika tidak. */
 void DrawShots(float globalScale, float offsetX, float offsetY);
 
 /* I.S. : Petak di (row, col) adalah petak yang valid dan kosong. Pemain memiliki cukup uang.
    F.S. : Sebuah tower baru dibuat dan ditambahkan ke daftar tower pada posisi tersebut.
-          Uang pemain berkurang, dan tile di peta diperbarui. */
+          Uang pemain berkurang, dan tile di peta diperbarui. Pada peta flow field, tower
+          yang akan memutus jalan musuh ke exit ditolak. */
 void PlaceTower(int row, int col, TowerType type);
 
 /* I.S. : Keadaan tower dan musuh pada frame sebelumnya.
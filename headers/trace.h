@@ -0,0 +1,47 @@
+/* File        : trace.h
+* Deskripsi   : Deklarasi untuk modul Trace.
+*               Modul ini merekam span (begin/end) dari kode simulasi dan render ke file
+*               berformat Trace Event Format (JSON) yang bisa dibuka di chrome://tracing
+*               atau Perfetto. Setiap thread menulis ke ring buffer miliknya sendiri tanpa
+*               lock, dan sebuah thread flusher menulis isinya ke file secara asinkron.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "common.h"
+
+#define TRACE_BUFFER_EVENTS 16384     // Kapasitas ring buffer per thread (harus pangkat 2)
+#define TRACE_FLUSH_INTERVAL_MS 5     // Jeda antar flush oleh thread flusher
+
+/* Makro instrumentasi. 'name' harus berupa string literal (pointer-nya disimpan apa adanya).
+   Kompilasi dengan -DDISABLE_TRACE untuk menghapus semua instrumentasi. */
+#ifdef DISABLE_TRACE
+#define TRACE_BEGIN(name) ((void)0)
+#define TRACE_END(name) ((void)0)
+#else
+#define TRACE_BEGIN(name) Trace_Emit((name), 'B')
+#define TRACE_END(name) Trace_Emit((name), 'E')
+#endif
+
+/* I.S. : Tracing tidak aktif.
+   F.S. : File 'fileName' dibuat, thread flusher berjalan, dan event mulai direkam.
+          Mengembalikan false jika file atau thread gagal dibuat. */
+bool Trace_Init(const char *fileName);
+
+/* I.S. : Tracing mungkin aktif.
+   F.S. : Perekaman dihentikan, semua event yang tersisa ditulis, file JSON ditutup
+          dengan benar, dan semua buffer dibebaskan. */
+void Trace_Shutdown(void);
+
+/* I.S. : Sembarang.
+   F.S. : Jika tracing aktif, satu event dengan fase 'phase' ('B' atau 'E') dicatat ke
+          ring buffer thread pemanggil. Jika buffer penuh, event dibuang dan dihitung. */
+void Trace_Emit(const char *name, char phase);
+
+/* Mengirimkan true jika tracing sedang aktif. */
+bool Trace_IsActive(void);
+
+#endif
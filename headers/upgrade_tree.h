@@ -10,17 +10,59 @@
 #define UPGRADE_TREE_H
 
 #include "common.h"
+#include <stdint.h>
+
+#define TOWER_STATS_CACHE_SIZE 64   // Jumlah kombinasi upgrade yang disimpan; harus pangkat dua
 
 struct Tower;
 struct UpgradeNode;
 
+/* Satu node di pohon pipih. Node disimpan dalam urutan pre-order, sehingga subtree sebuah node
+   adalah rentang [indeks node, 'subtreeEnd'). Anak langsung disimpan berurutan di 'childIndices'
+   mulai dari 'childStart'. */
+typedef struct
+{
+    UpgradeNode *node;
+    int parent;                 // Indeks parent, -1 untuk root
+    int subtreeEnd;
+    int childStart;
+    int childCount;
+} FlatUpgradeNode;
+
 /* ADT untuk merepresentasikan keseluruhan Pohon Upgrade. */
-/* Strukturnya hanya menyimpan pointer ke root. */
+/* Node dibangun sebagai pohon pointer (firstChild/nextSibling), lalu dikompilasi menjadi array
+   pre-order beserta tabel hash tipe -> indeks agar pencarian tidak perlu menelusuri pohon. */
 typedef struct
 {
     UpgradeNode *root;
+    FlatUpgradeNode *nodes;
+    int *childIndices;
+    int nodeCount;
+    int *typeSlots;             // Tabel hash open addressing berisi indeks node, -1 jika kosong
+    int typeSlotCount;          // Selalu pangkat dua
+    int bitsetWords;            // Jumlah word 64-bit yang dibutuhkan bitset upgrade satu tower
 } TowerUpgradeTree;
 
+/* Stat efektif tower untuk satu kombinasi upgrade. */
+typedef struct
+{
+    int damage;
+    float range;
+    float attackSpeed;
+    bool hasChainAttack;
+    int chainJumps;
+    float chainRange;
+    bool hasAreaAttack;
+    float areaAttackRadius;
+    bool hasStunEffect;
+    float stunChance;
+    float stunDuration;
+    float critChance;
+    float critMultiplier;
+    int visualTier;             // 0, 1, atau 2: tekstur tower1/tower2/tower3
+    int upgradeCost;            // Total harga semua upgrade yang dibeli
+} TowerStats;
+
 extern TowerUpgradeTree tower1UpgradeTree;
 extern UpgradeNode* pendingUpgradeNode;
 extern Vector2 pendingUpgradeIconPos;  
@@ -32,13 +74,57 @@ void InitUpgradeTree(TowerUpgradeTree *tree, TowerType type);
 
 // Fungsi ini menambahkan 'child' sebagai anak dari 'parent' dalam struktur pohon.
 // Ini mengatur pointer parent dari anak dan menambahkannya ke daftar anak-anak parent.
+// Setelah selesai menambahkan anak, pohon harus dikompilasi ulang dengan CompileUpgradeTree.
 void AddChild(UpgradeNode* parent, UpgradeNode* child);
 
+/* I.S. : 'tree->root' adalah pohon pointer yang baru dibangun atau baru ditambah node.
+   F.S. : Array pre-order, rentang anak, dan tabel hash tipe -> indeks dibangun ulang dari pohon
+          pointer. Mengembalikan false jika alokasi gagal (pohon pipih dikosongkan). */
+bool CompileUpgradeTree(TowerUpgradeTree *tree);
+
+/* Mengirimkan node bertipe 'type' di 'tree' dalam O(1), atau NULL jika tidak ada. */
+UpgradeNode *FindUpgradeNodeByType(const TowerUpgradeTree *tree, UpgradeType type);
+
 /* I.S : Parameter-parameter seperti type, name, desc, cost, parent, dan exclusiveGroupId telah siap untuk digunakan dalam pembuatan node baru.
    F.S.: 'UpgradeNode' baru telah dialokasikan di memori dan semua propertinya telah diisi sesuai dengan parameter yang diberikan.
          Fungsi mengembalikan pointer ke node baru tersebut. Jika alokasi memori gagal, fungsi akan mengembalikan NULL.*/
 UpgradeNode *CreateUpgradeNode(UpgradeType type, const char *name, const char *desc, int cost, UpgradeNode *parent, int exclusiveGroupId);
 
+/* I.S. : 'startNode' adalah akar dari sebuah (sub)pohon 'tower1UpgradeTree', boleh NULL.
+   F.S. : Mengirimkan pointer ke node bertipe 'type' di dalam subtree 'startNode',
+          atau NULL jika tidak ditemukan. */
+UpgradeNode* FindNodeByType(UpgradeNode* startNode, UpgradeType type);
+
+/* Mengirimkan true jika 'tower' sudah membeli upgrade 'type' di 'tower1UpgradeTree'. */
+bool HasTowerUpgrade(const struct Tower *tower, UpgradeType type);
+
+/* I.S. : Bitset upgrade 'tower' mungkin lebih kecil dari pohon yang sedang dikompilasi.
+   F.S. : Bit node bertipe 'type' di 'tower1UpgradeTree' diset. Mengembalikan false jika
+          tipe tidak ada di pohon atau bitset gagal diperbesar. */
+bool MarkTowerUpgrade(struct Tower *tower, UpgradeType type);
+
+/* I.S. : 'tower' mungkin memiliki bitset upgrade.
+   F.S. : Bitset upgrade 'tower' dibebaskan dan semua upgrade dianggap belum dibeli. */
+void FreeTowerUpgrades(struct Tower *tower);
+
+/* Mengirimkan stat efektif tower dengan bitset upgrade 'bits' ('wordCount' word) di 'tower1UpgradeTree'.
+   Stat dasar diambil dari konstanta TOWER_BASE_*, lalu efek setiap node yang dibeli diterapkan
+   dalam urutan pre-order, sehingga hasilnya tidak bergantung pada urutan pembelian. */
+TowerStats ComputeTowerStats(const uint64_t *bits, int wordCount);
+
+/* Sama seperti ComputeTowerStats, tetapi hasilnya disimpan di cache per kombinasi upgrade.
+   Pointer yang dikirimkan hanya valid sampai pemanggilan berikutnya. */
+const TowerStats *GetTowerStats(const uint64_t *bits, int wordCount);
+
+/* I.S. : Field stat 'tower' mungkin tidak sesuai dengan bitset upgrade-nya.
+   F.S. : Stat, tekstur, dan 'totalCost' 'tower' diisi ulang dari GetTowerStats. */
+void RefreshTowerStats(struct Tower *tower);
+
+/* I.S. : 'tower' dan 'node' valid.
+   F.S. : '*out' berisi stat 'tower' jika 'node' dibeli. 'tower' tidak diubah.
+          Mengembalikan false jika pratinjau tidak bisa dihitung. */
+bool PreviewTowerUpgrade(const struct Tower *tower, const UpgradeNode *node, TowerStats *out);
+
 /* I.S. : Tower yang mungkin sudah memiliki beberapa upgrade telah terinisialisasi.
    F.S. : Mengembalikan pointer ke 'UpgradeNode'. Jika belum ada upgrade yang dibeli, fungsi akan
           mengembalikan pointer ke root dari 'tower1UpgradeTree'.*/
@@ -83,7 +169,7 @@ void NavigateUpgradeOrbit(UpgradeNode *targetNode);
 void ResetUpgradeOrbit(void);
 
 /* I.S. : 'tree' mungkin menunjuk ke sebuah pohon upgrade yang valid.
-   F.S. : Semua memori yang dialokasikan untuk setiap node di dalam 'tree' telah dibebaskan.
+   F.S. : Semua memori yang dialokasikan untuk setiap node dan pohon pipih 'tree' telah dibebaskan.
           'tree->root' diatur menjadi NULL. */
 void FreeUpgradeTree(TowerUpgradeTree *tree);
 
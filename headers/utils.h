@@ -9,16 +9,18 @@
 #ifndef UTILS_H
 #define UTILS_H
 #include "raylib.h"
+#include "memory_tracker.h"
 
 /* I.S. : filePath adalah path ke sebuah file gambar.
    F.S. : Mengembalikan Texture2D yang valid jika file berhasil dimuat. 
           Jika file tidak ada atau gagal dimuat, mengembalikan Texture2D kosong ({0}) 
-          dan mencatat sebuah peringatan (warning). */
-Texture2D LoadTextureSafe(const char *filePath);
+          dan mencatat sebuah peringatan (warning).
+          Tekstur yang berhasil dimuat dicatat di Memory Tracker atas nama 'tag'. */
+Texture2D LoadTextureSafe(MemoryTag tag, const char *filePath);
 
 /* I.S. : texture adalah pointer ke sebuah Texture2D yang mungkin valid atau tidak.
-   F.S. : Jika tekstur valid, memorinya dibebaskan dan pointernya di-reset. 
-          Jika tidak valid, tidak terjadi apa-apa selain mencatat peringatan. */
+   F.S. : Jika tekstur valid, memorinya dibebaskan, catatannya di Memory Tracker dihapus,
+          dan pointernya di-reset. Jika tidak valid, tidak terjadi apa-apa selain mencatat peringatan. */
 void UnloadTextureSafe(Texture2D *texture);
 
 /* I.S. : filePath adalah path ke sebuah file musik.
@@ -0,0 +1,81 @@
+/* File        : wave_script.h
+* Deskripsi   : Deklarasi untuk modul Wave Script.
+*               Setiap peta boleh memiliki skrip wave berupa baris
+*                   wave <nomor> <jenis> <jumlah> <jeda> <pengaliHP> <pengaliKecepatan>
+*               dengan <jenis> nama archetype musuh (misalnya "enemy1") atau "mixed". Skrip dikompilasi
+*               sekali saat level dimulai menjadi satu tabel spawn datar; selama permainan wave
+*               hanya berjalan di tabel itu dengan indeks, tanpa parsing maupun alokasi.
+*               Wave yang tidak memiliki baris di skrip memakai komposisi bawaan.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#ifndef WAVE_SCRIPT_H
+#define WAVE_SCRIPT_H
+
+#include "raylib.h"
+#include <stdio.h>
+
+#define MAX_WAVE_GROUPS 64
+#define WAVE_GROUP_MAX_COUNT 500
+#define WAVE_SCRIPT_ENDLESS_WAVES 100   // Jumlah wave yang dikompilasi untuk peta tanpa batas wave
+#define WAVE_SCRIPT_MAX_WAVES 999       // Nomor wave terbesar yang diterima skrip dan jumlah wave peta
+
+#define WAVE_ENEMY_MIXED -1             // Archetype dipilih acak per musuh, seperti komposisi bawaan
+
+/* Satu baris skrip: 'count' musuh berjenis 'enemyType' pada wave 'wave', berjarak 'spacing' detik. */
+typedef struct {
+    int wave;
+    int enemyType;              // Indeks archetype musuh, atau WAVE_ENEMY_MIXED
+    int count;
+    float spacing;
+    float hpMultiplier;
+    float speedMultiplier;
+} WaveGroup;
+
+/* Skrip wave satu peta, disimpan di state editor dan di file peta. */
+typedef struct {
+    WaveGroup groups[MAX_WAVE_GROUPS];
+    int groupCount;
+} WaveScript;
+
+/* Satu musuh di tabel spawn hasil kompilasi. */
+typedef struct {
+    float delay;                // Jeda sebelum musuh ini di-spawn, dari spawn sebelumnya atau aktivasi wave
+    int archetype;
+    int maxHp;
+    float baseSpeed;
+} WaveSpawnEntry;
+
+/* I.S. : 'script' sembarang.
+   F.S. : 'script' kosong (semua wave memakai komposisi bawaan). */
+void WaveScript_Init(WaveScript *script);
+
+/* I.S. : 'script' berisi baris-baris yang sudah dibaca.
+   F.S. : Jika 'line' adalah baris "wave ...", isinya ditambahkan ke 'script' dan fungsi
+          mengembalikan true (baris yang tidak valid dilewati dengan peringatan). Baris lain
+          tidak mengubah 'script' dan fungsi mengembalikan false. */
+bool WaveScript_ParseLine(WaveScript *script, const char *line);
+
+/* I.S. : 'file' terbuka untuk ditulis.
+   F.S. : Semua baris 'script' ditulis ke 'file' dalam format yang dibaca WaveScript_ParseLine. */
+void WaveScript_Write(const WaveScript *script, FILE *file);
+
+/* Mengirimkan nomor wave terbesar yang disebut di 'script', atau 0 jika kosong. */
+int WaveScript_GetMaxWave(const WaveScript *script);
+
+/* I.S. : Tabel spawn level sebelumnya mungkin masih ada.
+   F.S. : 'script' dikompilasi menjadi tabel spawn untuk wave 1..'waveCount' (diperbesar sampai
+          wave terbesar di skrip, dibatasi WAVE_SCRIPT_MAX_WAVES). 'script' boleh NULL.
+          Mengembalikan false jika tabel terlalu besar atau alokasi gagal. */
+bool WaveScript_Compile(const WaveScript *script, int waveCount);
+
+/* Mengirimkan jumlah musuh wave 'waveNum' dan mengisi '*entries' dengan awal potongan tabelnya.
+   Wave di luar tabel memakai wave terakhir yang dikompilasi (peta tanpa batas wave). */
+int WaveScript_GetWave(int waveNum, const WaveSpawnEntry **entries);
+
+/* I.S. : Tabel spawn mungkin ada.
+   F.S. : Tabel spawn dibebaskan. */
+void WaveScript_Clear(void);
+
+#endif
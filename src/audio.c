@@ -7,6 +7,7 @@
 
 #include "audio.h"
 #include "utils.h"
+#include "memory_tracker.h"
 #include "raylib.h"
 
 Music regularBacksound;
@@ -33,6 +34,10 @@ void InitGameAudio()
     sfxKill1 = LoadSound("assets/audio/kill1.mp3");
     sfxKill2 = LoadSound("assets/audio/kill2.mp3");
     sfxSpendMoney = LoadSound("assets/audio/spendmoney.mp3");
+    // Musik di-stream sehingga tidak dicatat; hanya sound effect yang seluruh sampelnya ada di memori.
+    Memory_TrackSound(MEM_TAG_AUDIO, sfxKill1);
+    Memory_TrackSound(MEM_TAG_AUDIO, sfxKill2);
+    Memory_TrackSound(MEM_TAG_AUDIO, sfxSpendMoney);
 
     if (regularBacksound.stream.buffer != NULL) SetMusicVolume(regularBacksound, 2.0f);
     if (battleBacksound.stream.buffer != NULL) SetMusicVolume(battleBacksound, 2.0f);
@@ -65,6 +70,9 @@ void UnloadGameAudio()
     StopAllMusic();
     UnloadMusicStreamSafe(&regularBacksound);
     UnloadMusicStreamSafe(&battleBacksound);
+    Memory_UntrackSound(sfxKill1);
+    Memory_UntrackSound(sfxKill2);
+    Memory_UntrackSound(sfxSpendMoney);
     UnloadSound(sfxKill1);
     UnloadSound(sfxKill2);
     UnloadSound(sfxSpendMoney);
@@ -0,0 +1,139 @@
+/* File        : camera.c
+* Deskripsi   : Implementasi untuk modul Kamera (Camera) gameplay.
+*               Berisi logika pan/zoom kamera dan fungsi culling untuk menentukan
+*               tile dan objek mana saja yang perlu digambar.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "camera.h"
+#include "map.h"
+
+GameCamera gameCamera = { {0, 0}, 1.0f };
+
+// Mengembalikan skala yang membuat seluruh peta pas di layar (zoom 1).
+static float GetFitScale(void) {
+    float baseMapWidth = GetMapCols() * TILE_SIZE;
+    float baseMapHeight = GetMapRows() * TILE_SIZE;
+    if (baseMapWidth <= 0.0f || baseMapHeight <= 0.0f) return 1.0f;
+    return fmin((float)VIRTUAL_WIDTH / baseMapWidth, (float)VIRTUAL_HEIGHT / baseMapHeight);
+}
+
+// Membatasi target kamera agar tidak menampilkan area di luar peta.
+// Jika peta lebih kecil dari layar pada suatu sumbu, peta diletakkan di tengah.
+static void ClampCameraTarget(void) {
+    float baseMapWidth = GetMapCols() * TILE_SIZE;
+    float baseMapHeight = GetMapRows() * TILE_SIZE;
+    float scale = GetFitScale() * gameCamera.zoom;
+    float halfViewWidth = (VIRTUAL_WIDTH / 2.0f) / scale;
+    float halfViewHeight = (VIRTUAL_HEIGHT / 2.0f) / scale;
+
+    if (baseMapWidth <= halfViewWidth * 2.0f) {
+        gameCamera.target.x = baseMapWidth / 2.0f;
+    } else {
+        gameCamera.target.x = fmaxf(halfViewWidth, fminf(gameCamera.target.x, baseMapWidth - halfViewWidth));
+    }
+    if (baseMapHeight <= halfViewHeight * 2.0f) {
+        gameCamera.target.y = baseMapHeight / 2.0f;
+    } else {
+        gameCamera.target.y = fmaxf(halfViewHeight, fminf(gameCamera.target.y, baseMapHeight - halfViewHeight));
+    }
+}
+
+/* I.S. : Kamera berada pada posisi dan zoom sembarang.
+   F.S. : Kamera berada di tengah peta dengan zoom 1 (seluruh peta terlihat). */
+void ResetGameCamera(void) {
+    gameCamera.zoom = 1.0f;
+    gameCamera.target = (Vector2){ GetMapCols() * TILE_SIZE / 2.0f, GetMapRows() * TILE_SIZE / 2.0f };
+}
+
+/* I.S. : Kamera pada posisi frame sebelumnya.
+   F.S. : Posisi dan zoom kamera diperbarui berdasarkan input pemain
+          (roda mouse untuk zoom, WASD/panah atau drag tombol tengah mouse untuk pan). */
+void UpdateGameCamera(float deltaTime) {
+    float scale = GetFitScale() * gameCamera.zoom;
+
+    float wheel = GetMouseWheelMove();
+    if (wheel != 0.0f) {
+        // Zoom ke arah kursor: titik dunia di bawah kursor tetap di bawah kursor.
+        Vector2 mouse = GetMousePosition();
+        Vector2 screenCenter = { VIRTUAL_WIDTH / 2.0f, VIRTUAL_HEIGHT / 2.0f };
+        Vector2 worldUnderMouse = {
+            gameCamera.target.x + (mouse.x - screenCenter.x) / scale,
+            gameCamera.target.y + (mouse.y - screenCenter.y) / scale
+        };
+        gameCamera.zoom *= 1.0f + wheel * CAMERA_ZOOM_STEP;
+        gameCamera.zoom = fmaxf(CAMERA_MIN_ZOOM, fminf(gameCamera.zoom, CAMERA_MAX_ZOOM));
+        scale = GetFitScale() * gameCamera.zoom;
+        gameCamera.target.x = worldUnderMouse.x - (mouse.x - screenCenter.x) / scale;
+        gameCamera.target.y = worldUnderMouse.y - (mouse.y - screenCenter.y) / scale;
+    }
+
+    float pan = CAMERA_PAN_SPEED * deltaTime / scale;
+    if (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT))  gameCamera.target.x -= pan;
+    if (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT)) gameCamera.target.x += pan;
+    if (IsKeyDown(KEY_W) || IsKeyDown(KEY_UP))    gameCamera.target.y -= pan;
+    if (IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN))  gameCamera.target.y += pan;
+
+    if (IsMouseButtonDown(MOUSE_BUTTON_MIDDLE)) {
+        Vector2 delta = GetMouseDelta();
+        gameCamera.target.x -= delta.x / scale;
+        gameCamera.target.y -= delta.y / scale;
+    }
+
+    ClampCameraTarget();
+}
+
+/* I.S. : 'tileScale', 'offsetX', dan 'offsetY' berisi nilai lama.
+   F.S. : Ketiganya diisi dengan skala dan offset layar peta sesuai state kamera saat ini. */
+void ApplyGameCamera(float *tileScale, float *offsetX, float *offsetY) {
+    if (gameCamera.zoom <= 0.0f) {
+        ResetGameCamera();
+    }
+    ClampCameraTarget();
+    float scale = GetFitScale() * gameCamera.zoom;
+    *tileScale = scale;
+    *offsetX = VIRTUAL_WIDTH / 2.0f - gameCamera.target.x * scale;
+    *offsetY = VIRTUAL_HEIGHT / 2.0f - gameCamera.target.y * scale;
+}
+
+/* Mengirimkan true jika persegi 'worldRect' (koordinat dunia) terlihat di layar
+   untuk skala dan offset yang diberikan. */
+bool IsWorldRectVisible(Rectangle worldRect, float globalScale, float offsetX, float offsetY) {
+    float left = offsetX + worldRect.x * globalScale;
+    float top = offsetY + worldRect.y * globalScale;
+    float right = left + worldRect.width * globalScale;
+    float bottom = top + worldRect.height * globalScale;
+    return right >= 0 && bottom >= 0 && left <= VIRTUAL_WIDTH && top <= VIRTUAL_HEIGHT;
+}
+
+/* Mengirimkan true jika titik 'worldPos' (koordinat dunia) berada di dalam layar,
+   diperluas sebesar 'marginPixels' piksel layar di setiap sisi. */
+bool IsWorldPointVisible(Vector2 worldPos, float marginPixels, float globalScale, float offsetX, float offsetY) {
+    float x = offsetX + worldPos.x * globalScale;
+    float y = offsetY + worldPos.y * globalScale;
+    return x >= -marginPixels && y >= -marginPixels &&
+           x <= VIRTUAL_WIDTH + marginPixels && y <= VIRTUAL_HEIGHT + marginPixels;
+}
+
+/* I.S. : Parameter output berisi nilai sembarang.
+   F.S. : Rentang baris [rowStart, rowEnd) dan kolom [colStart, colEnd) dari tile yang
+          terlihat di layar telah diisi (sudah dibatasi ke ukuran peta). */
+void GetVisibleTileRange(float globalScale, float offsetX, float offsetY, int *rowStart, int *rowEnd, int *colStart, int *colEnd) {
+    float tileScreenSize = TILE_SIZE * globalScale;
+    if (tileScreenSize <= 0.0f) {
+        *rowStart = *rowEnd = *colStart = *colEnd = 0;
+        return;
+    }
+    int c0 = (int)floorf((0.0f - offsetX) / tileScreenSize);
+    int r0 = (int)floorf((0.0f - offsetY) / tileScreenSize);
+    int c1 = (int)ceilf((VIRTUAL_WIDTH - offsetX) / tileScreenSize);
+    int r1 = (int)ceilf((VIRTUAL_HEIGHT - offsetY) / tileScreenSize);
+
+    *colStart = c0 < 0 ? 0 : c0;
+    *rowStart = r0 < 0 ? 0 : r0;
+    *colEnd = c1 > GetMapCols() ? GetMapCols() : c1;
+    *rowEnd = r1 > GetMapRows() ? GetMapRows() : r1;
+    if (*colEnd < *colStart) *colEnd = *colStart;
+    if (*rowEnd < *rowStart) *rowEnd = *rowStart;
+}
@@ -14,16 +14,29 @@
 #include "map.h"
 #include "player_resources.h"
 #include "audio.h"
+#include "camera.h"
+#include "trace.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include "memory_tracker.h"
+#include "enemy_kernel.h"
+#include "flow_field.h"
+#include "event_scheduler.h"
+#include "wave_script.h"
 #include <string.h>
 #include <math.h>
 
-static AnimSprite enemy1_anim_data = {0};
-static AnimSprite enemy2_anim_data = {0};
-
-static int dx_path[] = {0, 1, 0, -1};
-static int dy_path[] = {-1, 0, 1, 0};
+// Tabel archetype musuh. Nilai dasar kedua jenis sama dengan komposisi wave sebelum tabel ini ada.
+static EnemyArchetype enemyArchetypes[ENEMY_ARCHETYPE_COUNT] = {
+    { .name = "enemy1", .spriteFile = "assets/img/gameplay_imgs/enemy1.png",
+      .spriteCols = 7, .spriteSpeed = 10, .spriteFrames = 7, .drawScale = 0.7f,
+      .baseHp = 100, .baseSpeed = 15.0f, .bounty = 15, .resistance = {0.0f, 0.0f, 0.0f} },
+    { .name = "enemy2", .spriteFile = "assets/img/gameplay_imgs/enemy2.png",
+      .spriteCols = 4, .spriteSpeed = 12, .spriteFrames = 4, .drawScale = 0.2f,
+      .baseHp = 100, .baseSpeed = 15.0f, .bounty = 15, .resistance = {0.0f, 0.0f, 0.0f} },
+};
+static EnemyKernelEvents kernelEvents = {0};
+static float animationClock = 0.0f;     // Jam animasi global; maju sekali per update simulasi
 
 EnemyWave *currentWave = NULL;
 WaveQueue incomingWaves; 
@@ -35,28 +48,40 @@ int currentWaveNum = 1;
 // I.S. : Aset-aset untuk musuh belum dimuat.
 // F.S. : Semua aset yang diperlukan oleh modul Enemy telah dimuat ke memori.
 void Enemies_InitAssets() {
-    enemy1_anim_data = LoadAnimSprite("assets/img/gameplay_imgs/enemy1.png",7,10,7);
-    enemy2_anim_data = LoadAnimSprite("assets/img/gameplay_imgs/enemy2.png",4,12,4);
+    for (int i = 0; i < ENEMY_ARCHETYPE_COUNT; i++) {
+        EnemyArchetype *archetype = &enemyArchetypes[i];
+        archetype->sprite = LoadAnimSprite(archetype->spriteFile, archetype->spriteCols, archetype->spriteSpeed, archetype->spriteFrames);
+    }
 
     
-    allActiveEnemies = (Enemy*)calloc(maxTotalActiveEnemies, sizeof(Enemy));
+    allActiveEnemies = (Enemy*)Memory_Calloc(MEM_TAG_ENEMY, maxTotalActiveEnemies, sizeof(Enemy));
     if (allActiveEnemies == NULL) {
         TraceLog(LOG_FATAL, "Failed to allocate allActiveEnemies array.");
     }
+    if (!InitEnemyKinematics(&enemyKinematics, maxTotalActiveEnemies) ||
+        !InitEnemyKernelEvents(&kernelEvents, enemyKinematics.capacity)) {
+        TraceLog(LOG_FATAL, "Failed to allocate enemy kinematics arrays.");
+    }
     totalActiveEnemiesCount = 0;
+    animationClock = 0.0f;
     InitWaveQueue(&incomingWaves); 
-    TraceLog(LOG_INFO, "Enemy assets initialized. Max active enemies: %d", maxTotalActiveEnemies);
+    TraceLog(LOG_INFO, "Enemy assets initialized. Max active enemies: %d, movement kernel: %s",
+             maxTotalActiveEnemies, GetEnemyKernelName());
 }
 
 // I.S. : Aset-aset musuh mungkin sedang digunakan.
 // F.S. : Semua aset yang digunakan oleh modul Enemy telah dihapus dari memori.
 void Enemies_ShutdownAssets() {
-    UnloadAnimSprite(&enemy1_anim_data);
-    UnloadAnimSprite(&enemy2_anim_data);
+    for (int i = 0; i < ENEMY_ARCHETYPE_COUNT; i++) {
+        UnloadAnimSprite(&enemyArchetypes[i].sprite);
+    }
     if (allActiveEnemies) {
-        free(allActiveEnemies);
+        Memory_Free(allActiveEnemies);
         allActiveEnemies = NULL;
     }
+    FreeEnemyKinematics(&enemyKinematics);
+    FreeEnemyKernelEvents(&kernelEvents);
+    totalActiveEnemiesCount = 0;
     ClearWaveQueue(&incomingWaves); 
     TraceLog(LOG_INFO, "Enemy assets shutdown.");
 }
@@ -81,7 +106,7 @@ void InitWaveQueue(WaveQueue *q) {
 // F.S. : Elemen pertama (front) dari q dihapus, nilainya disalin ke 'enemy', dan fungsi mengembalikan true.
 // Jika q kosong, fungsi mengembalikan false.
 void EnqueueEnemy(EnemyQueue *q, Enemy enemy) {
-    EnemyQueueNode *newNode = (EnemyQueueNode*)malloc(sizeof(EnemyQueueNode));
+    EnemyQueueNode *newNode = (EnemyQueueNode*)Memory_Alloc(MEM_TAG_ENEMY, sizeof(EnemyQueueNode));
     if (newNode == NULL) {
         TraceLog(LOG_ERROR, "Failed to allocate new EnemyQueueNode.");
         return;
@@ -102,7 +127,7 @@ void EnqueueEnemy(EnemyQueue *q, Enemy enemy) {
 // I.S. : q terdefinisi, mungkin kosong.
 // F.S. : 'wave' ditambahkan sebagai elemen terakhir (rear) dari antrian q.
 void EnqueueWave(WaveQueue *q, EnemyWave *wave) {
-    WaveQueueNode *newNode = (WaveQueueNode*)malloc(sizeof(WaveQueueNode));
+    WaveQueueNode *newNode = (WaveQueueNode*)Memory_Alloc(MEM_TAG_WAVE, sizeof(WaveQueueNode));
     if (newNode == NULL) {
         TraceLog(LOG_ERROR, "Failed to allocate new WaveQueueNode.");
         return;
@@ -135,7 +160,7 @@ bool DequeueEnemy(EnemyQueue *q, Enemy *enemy) {
     if (q->front == NULL) { 
         q->rear = NULL;
     }
-    free(temp);
+    Memory_Free(temp);
     q->count--;
     return true;
 }
@@ -154,7 +179,7 @@ EnemyWave* DequeueWave(WaveQueue *q) {
     if (q->front == NULL) { 
         q->rear = NULL;
     }
-    free(temp);
+    Memory_Free(temp);
     q->count--;
     TraceLog(LOG_INFO, "Wave %d dequeued. Total waves in queue: %d", dequeuedWave->waveNum, q->count);
     return dequeuedWave;
@@ -178,7 +203,7 @@ void ClearEnemyQueue(EnemyQueue *q) {
     EnemyQueueNode *current = q->front;
     while (current != NULL) {
         EnemyQueueNode *next = current->next;
-        free(current);
+        Memory_Free(current);
         current = next;
     }
     q->front = NULL;
@@ -193,7 +218,7 @@ void ClearWaveQueue(WaveQueue *q) {
     while (current != NULL) {
         WaveQueueNode *next = current->next;
         FreeWave(&current->wave); 
-        free(current);
+        Memory_Free(current);
         current = next;
     }
     q->front = NULL;
@@ -207,7 +232,7 @@ void ClearWaveQueue(WaveQueue *q) {
 // dari 'filename' dan properti animasi yang sesuai.
 AnimSprite LoadAnimSprite(const char *filename, int cols, int speed, int frameCount) {
     AnimSprite sprite = {0};
-    sprite.texture = LoadTextureSafe(filename);
+    sprite.texture = LoadTextureSafe(MEM_TAG_ENEMY, filename);
     if (sprite.texture.id == 0) {
         TraceLog(LOG_ERROR, "ERROR: LoadAnimSprite failed to load texture: %s", filename);
         sprite.frameWidth = 0;
@@ -220,9 +245,6 @@ AnimSprite LoadAnimSprite(const char *filename, int cols, int speed, int frameCo
     sprite.frameSpeed = speed;
     sprite.frameCount = frameCount;
 
-    sprite.currentFrame = 0;
-    sprite.frameCounter = 0.0f;
-
     if (cols > 0) {
         sprite.frameWidth = sprite.texture.width / cols;
     } else {
@@ -230,13 +252,6 @@ AnimSprite LoadAnimSprite(const char *filename, int cols, int speed, int frameCo
         TraceLog(LOG_WARNING, "LoadAnimSprite: 'cols' parameter is 0, assuming 1 column for %s.", filename);
     }
     sprite.frameHeight = sprite.texture.height; 
-        
-    sprite.frameRec = (Rectangle){
-        0.0f,
-        0.0f, 
-        (float)sprite.frameWidth,
-        (float)sprite.frameHeight
-    };
     
     TraceLog(LOG_INFO, "Loaded AnimSprite: %s",
              filename, cols, sprite.frameWidth, sprite.frameHeight, frameCount);
@@ -244,40 +259,24 @@ AnimSprite LoadAnimSprite(const char *filename, int cols, int speed, int frameCo
     return sprite;
 }
 
-// I.S. : 'sprite' berada pada frame animasi tertentu.
-// F.S. : 'sprite->currentFrame' mungkin bertambah berdasarkan 'deltaTime' dan 'frameSpeed'.
-void UpdateAnimSprite(AnimSprite *sprite)
-{
-    if (sprite->texture.id == 0)
-        return;
-
-    sprite->frameCounter += GetFrameTime();
-    float frameDuration = 1.0f / sprite->frameSpeed;
-
-    if (sprite->frameCounter >= frameDuration)
-    {
-        sprite->frameCounter -= frameDuration;
-        sprite->currentFrame++;
-        if (sprite->currentFrame >= sprite->frameCount)
-        {
-            sprite->currentFrame = 0;
-        }
-        sprite->frameRec.x = (float)sprite->currentFrame * sprite->frameWidth;
-    }
-}
-
 // I.S. : 'sprite' terdefinisi.
-// F.S. : Frame animasi saat ini dari 'sprite' digambar ke layar pada 'position' yang ditentukan.
-void DrawAnimSprite(const AnimSprite *sprite, Vector2 position, float scale, Color tint)
+// F.S. : Frame 'sprite' setelah animasi berjalan 'time' detik digambar ke layar pada 'position'.
+void DrawAnimSprite(const AnimSprite *sprite, float time, Vector2 position, float scale, Color tint)
 {
-    if (sprite->texture.id == 0)
+    if (sprite->texture.id == 0 || sprite->frameCount <= 0)
         return;
+    int frame = time > 0.0f ? (int)(time * sprite->frameSpeed) % sprite->frameCount : 0;
+    Rectangle sourceRec = {
+        (float)frame * sprite->frameWidth,
+        0.0f,
+        (float)sprite->frameWidth,
+        (float)sprite->frameHeight};
     Rectangle destRec = {
         position.x - (sprite->frameWidth * scale / 2.0f),
         position.y - (sprite->frameHeight * scale / 2.0f),
         sprite->frameWidth * scale,
         sprite->frameHeight * scale};
-    DrawTexturePro(sprite->texture, sprite->frameRec, destRec, (Vector2){0, 0}, 0.0f, tint);
+    DrawTexturePro(sprite->texture, sourceRec, destRec, (Vector2){0, 0}, 0.0f, tint);
 }
 
 //I.S : Sprite terdefinisi
@@ -291,104 +290,9 @@ void UnloadAnimSprite(AnimSprite *sprite)
     }
 }
 
-//Mengembalikan jalur musuh bergerak
-static bool IsPathTile(int row, int col)
-{
-    if (row >= 0 && row < MAP_ROWS && col >= 0 && col < MAP_COLS)
-    {
-        int tileValue = GetMapTile(row, col);
-        return (tileValue == 1);
-    }
-    return false;
-}
-
-//Mengembalikan pengecekan tile atau bukan
-static void BuildPathDFS_Internal(int x, int y, bool visited[MAP_ROWS][MAP_COLS], Vector2 outPath[], int *count)
-{
-    if (y < 0 || y >= MAP_ROWS || x < 0 || x >= MAP_COLS)
-        return;
-
-    if (visited[y][x] || !IsPathTile(y, x))
-        return;
-
-    if (*count >= MAX_PATH_POINTS)
-    {
-        TraceLog(LOG_WARNING, "MAX_PATH_POINTS reached in BuildPathDFS_Internal. Path may be incomplete.");
-        return;
-    }
-
-    visited[y][x] = true;
-    outPath[*count] = (Vector2){x * (float)TILE_SIZE + TILE_SIZE / 2.0f,
-                                y * (float)TILE_SIZE + TILE_SIZE / 2.0f};
-    (*count)++;
-
-    for (int d = 0; d < 4; d++)
-    {
-        int nx = x + dx_path[d];
-        int ny = y + dy_path[d];
-
-        if (nx >= 0 && nx < MAP_COLS && ny >= 0 && ny < MAP_ROWS &&
-            IsPathTile(ny, nx) && !visited[ny][nx])
-        {
-            BuildPathDFS_Internal(nx, ny, visited, outPath, count);
-        }
-    }
-}
-
-// I.S. : 'waveToBuild->path' kosong.
-// F.S. : 'waveToBuild->path' telah diisi dengan koordinat jalur yang ditemukan dari titik awal.
-// 'waveToBuild->pathCount' diperbarui.
-void Enemies_BuildPath(int startX, int startY, EnemyWave* waveToBuild) {
-    
-    bool visited[MAP_ROWS][MAP_COLS] = {false};
-    waveToBuild->pathCount = 0;
-    
-    if (startX < 0 || startX >= MAP_COLS || startY < 0 || startY >= MAP_ROWS || !IsPathTile(startY, startX)) {
-        TraceLog(LOG_ERROR, "Pathfinding failed: Start point (%d, %d) is not a valid path tile.", startX, startY);
-        return; 
-    }
-
-    int currentX = startX;
-    int currentY = startY;
-
-    while (waveToBuild->pathCount < MAX_PATH_POINTS) {
-        
-        visited[currentY][currentX] = true;
-
-        waveToBuild->path[waveToBuild->pathCount] = (Vector2){
-            currentX * (float)TILE_SIZE + TILE_SIZE / 2.0f,
-            currentY * (float)TILE_SIZE + TILE_SIZE / 2.0f
-        };
-        waveToBuild->pathCount++;
-        bool foundNextStep = false;
-
-        for (int d = 0; d < 4; d++) {
-            int nextX = currentX + dx_path[d];
-            int nextY = currentY + dy_path[d];
-
-            if (IsPathTile(nextY, nextX) && !visited[nextY][nextX]) {
-                
-                currentX = nextX;
-                currentY = nextY;
-                foundNextStep = true;
-                break; 
-            }
-        }
-        if (!foundNextStep) {
-            break; 
-        }
-    }
-    if (waveToBuild->pathCount > 0) {
-         TraceLog(LOG_INFO, "Path built using Smart Tracer. Points: %d. Start: (%d, %d).",
-                 waveToBuild->pathCount, startX, startY);
-    } else {
-        TraceLog(LOG_WARNING, "Pathfinding failed to build any path from start (%d, %d).", startX, startY);
-    }
-}
-
-// I.S. : 'waveToBuild->path' kosong.
-// F.S. : 'waveToBuild->path' telah diisi dengan koordinat jalur yang ditemukan dari titik awal.
-// 'waveToBuild->pathCount' diperbarui.
+// I.S. : Diberikan sebuah target saat ini dan daftar target yang sudah dikecualikan.
+// F.S. : Mengembalikan pointer ke musuh terdekat berikutnya dalam jangkauan 'range' yang belum ada
+// di dalam daftar 'excludedTargets'. Mengembalikan NULL jika tidak ada.
 Enemy* FindNextChainTarget(Enemy* currentTarget, Enemy* excludedTargets[], int excludedCount, float range) {
     Enemy* bestTarget = NULL;
     float minDistance = range;
@@ -414,87 +318,152 @@ Enemy* FindNextChainTarget(Enemy* currentTarget, Enemy* excludedTargets[], int e
     return bestTarget;
 }
 
-void Enemies_Update(float deltaTime) {
-    for (int i = 0; i < maxTotalActiveEnemies; i++) { 
-        Enemy *e = &allActiveEnemies[i];
+// Mengembalikan indeks slot 'enemy' di 'allActiveEnemies'.
+static int GetEnemySlot(const Enemy *enemy) {
+    return (int)(enemy - allActiveEnemies);
+}
 
-        if (!e->active) continue;
-       
-        if (e->isStunned) {
-            e->stunTimer -= deltaTime;
-            if (e->stunTimer <= 0) {
-                e->isStunned = false;
-            } else {
-                UpdateAnimSprite(&e->animData); 
-                continue; 
-            }
+// Menonaktifkan musuh di 'slot' dan mengembalikan state kinematiknya ke keadaan diam.
+static void DeactivateEnemy(int slot) {
+    allActiveEnemies[slot].active = false;
+    ResetEnemyKinematicsSlot(&enemyKinematics, slot);
+    totalActiveEnemiesCount--;
+}
+
+// Mengirimkan pusat tile 'tile' (row * cols + col) dalam koordinat dunia.
+static Vector2 FlowTileCenter(int tile) {
+    int cols = GetMapCols();
+    return (Vector2){ (tile % cols) * (float)TILE_SIZE + TILE_SIZE / 2.0f,
+                      (tile / cols) * (float)TILE_SIZE + TILE_SIZE / 2.0f };
+}
+
+// Menggerakkan 'e' sejauh 'step' menuruni flow field, dari pusat tile ke pusat tile berikutnya.
+// Musuh yang tidak punya jalan keluar menunggu di pusat tile-nya sampai jalan terbuka lagi.
+// Nilai pengembalian: true jika musuh sampai di tile exit.
+static bool AdvanceOnFlowField(Enemy *e, float step) {
+    int cols = GetMapCols();
+    while (step > 0.0f) {
+        int row = e->flowTile / cols;
+        int col = e->flowTile % cols;
+        if (!FlowField_IsWalkable(row, col)) {
+            // Tile tujuan baru saja diblokir tower: kembali ke pusat tile yang sedang ditempati.
+            e->flowTile = (int)(e->position.y / TILE_SIZE) * cols + (int)(e->position.x / TILE_SIZE);
         }
-        UpdateAnimSprite(&e->animData);
-        
-        if (!e->parentWave || e->parentWave->pathCount < 2) {
-            continue; 
+
+        Vector2 target = FlowTileCenter(e->flowTile);
+        float dx = target.x - e->position.x;
+        float dy = target.y - e->position.y;
+        float length = sqrtf(dx * dx + dy * dy);
+        if (length > step) {
+            e->position.x += dx / length * step;
+            e->position.y += dy / length * step;
+            return false;
         }
+        e->position = target;
+        step -= length;
 
-        bool isDefeated = false;
-        bool reachedEnd = false;
+        if (FlowField_GetDistance(e->flowTile / cols, e->flowTile % cols) == 0) return true;
+        int next = FlowField_NextTile(e->flowTile);
+        if (next < 0) return false;
+        e->flowTile = next;
+    }
+    return false;
+}
 
-        int s = e->segment;
-        if (s < e->parentWave->pathCount - 1) {
-            Vector2 startPoint = e->parentWave->path[s];
-            Vector2 endPoint = e->parentWave->path[s + 1];
-            float segmentLength = Vector2Distance(startPoint, endPoint);
+// I.S. : Posisi dan status musuh pada frame sebelumnya.
+// F.S. : Posisi semua musuh yang aktif di 'allActiveEnemies' diperbarui sesuai 'deltaTime' dan jalurnya.
+// Musuh yang HP-nya habis atau mencapai ujung jalur dinonaktifkan.
+void Enemies_Update(float deltaTime) {
+    if (!allActiveEnemies) return;
 
-            if (segmentLength > 0) {
-                e->t += (e->speed * deltaTime) / segmentLength;
-            } else {
-                e->t = 1.0f;
-            }
+    // Animasi tidak diperbarui per musuh; frame dihitung saat menggambar dari jam ini.
+    animationClock += deltaTime;
 
-            if (e->t >= 1.0f) {
-                e->segment++;
-                s = e->segment;
-                e->t = fmod(e->t, 1.0f);
-                if (s >= e->parentWave->pathCount) {
-                    reachedEnd = true;
-                }
-            }
-            
-            if (e->active && s < e->parentWave->pathCount - 1) { 
-                e->position = Vector2Lerp(e->parentWave->path[s], e->parentWave->path[s + 1], e->t);
+    // Stun, jarak tempuh, dan pengecekan mati/sampai ujung dihitung sekaligus oleh kernel SoA.
+    RunEnemyMovementKernel(&enemyKinematics, deltaTime, &kernelEvents);
+
+    for (int i = 0; i < kernelEvents.diedCount; i++) {
+        int slot = kernelEvents.died[i];
+        if (!allActiveEnemies[slot].active) continue;
+        DeactivateEnemy(slot);
+        AddMoney(enemyArchetypes[allActiveEnemies[slot].archetype].bounty);
+        PlayEnemyDefeatedSound();
+    }
+    for (int i = 0; i < kernelEvents.reachedEndCount; i++) {
+        int slot = kernelEvents.reachedEnd[i];
+        if (!allActiveEnemies[slot].active) continue;
+        DeactivateEnemy(slot);
+        DecreaseLife(1);
+    }
+
+    // Bagian per musuh yang tersisa: posisi dari jarak tempuh.
+    bool useFlowField = FlowField_IsActive();
+    for (int i = 0; i < maxTotalActiveEnemies; i++) {
+        Enemy *e = &allActiveEnemies[i];
+        if (!e->active) continue;
+
+        if (useFlowField) {
+            // Kernel tetap menghitung stun dan jarak tempuh; selisihnya diubah menjadi langkah di flow field.
+            float step = enemyKinematics.distance[i] - e->flowConsumed;
+            e->flowConsumed = enemyKinematics.distance[i];
+            if (AdvanceOnFlowField(e, step)) {
+                DeactivateEnemy(i);
+                DecreaseLife(1);
             }
-        } else {
-            reachedEnd = true;
+            continue;
         }
-        
-        
-        if (e->hp <= 0) {
-            e->active = false;
-            totalActiveEnemiesCount--;
-            AddMoney(15); 
-            PlayEnemyDefeatedSound();
-            continue; 
+        const MapPath *path = GetEnemyRoute(e);
+        if (path && path->count >= 2) {
+            e->position = GetMapPathPosition(path, enemyKinematics.distance[i], &e->segment);
         }
+    }
+}
 
-        
-        if (reachedEnd) {
-            e->active = false;
-            totalActiveEnemiesCount--;
-            DecreaseLife(1); 
-            
-            continue; 
+// I.S. : 'enemy' adalah musuh dari antrian wave yang belum di-spawn.
+// F.S. : Salinan 'enemy' menempati slot kosong pertama di 'allActiveEnemies' di awal jalurnya,
+// dengan HP dan kecepatan awal. Mengembalikan false jika tidak ada slot kosong.
+bool SpawnEnemy(const Enemy *enemy) {
+    if (!allActiveEnemies || !enemy) return false;
+    for (int slot = 0; slot < maxTotalActiveEnemies; slot++) {
+        if (allActiveEnemies[slot].active) continue;
+
+        Enemy *e = &allActiveEnemies[slot];
+        *e = *enemy;
+        e->active = true;
+        e->spawned = true;
+        e->segment = 0;
+        e->flowConsumed = 0.0f;
+        e->stunUntilTick = -1;
+        e->animPhase = -animationClock;     // Animasi mulai dari frame pertama saat spawn
+
+        // Musuh tanpa jalur yang valid tetap diam di tempat (panjang jalur tak hingga). Pada mode
+        // flow field posisi awal sudah diisi CreateWave dan exit dideteksi oleh AdvanceOnFlowField.
+        const MapPath *path = GetEnemyRoute(e);
+        ResetEnemyKinematicsSlot(&enemyKinematics, slot);
+        enemyKinematics.hp[slot] = e->maxHp;
+        enemyKinematics.speed[slot] = e->baseSpeed;
+        if (path && path->count > 0) {
+            e->position = path->points[0];
+            if (path->count >= 2) enemyKinematics.pathLength[slot] = path->totalLength;
         }
+        totalActiveEnemiesCount++;
+        return true;
+    }
+    return false;
+}
 
-        if (isDefeated) {
-            e->active = false;
-            totalActiveEnemiesCount--;
-            AddMoney(15);
-            PlayEnemyDefeatedSound();
+// I.S. : Sembarang.
+// F.S. : Semua slot di 'allActiveEnemies' tidak aktif dan 'totalActiveEnemiesCount' bernilai 0.
+void Enemies_DeactivateAll(void) {
+    if (allActiveEnemies) {
+        for (int i = 0; i < maxTotalActiveEnemies; i++) {
+            allActiveEnemies[i].active = false;
+            ResetEnemyKinematicsSlot(&enemyKinematics, i);
         }
     }
+    totalActiveEnemiesCount = 0;
 }
 
-
-
 void Enemies_Draw(float globalScale, float offsetX, float offsetY) {
     if (!allActiveEnemies || totalActiveEnemiesCount == 0) {
         return;
@@ -505,22 +474,30 @@ void Enemies_Draw(float globalScale, float offsetX, float offsetY) {
         if (!e->active) 
             continue;
 
+        const EnemyArchetype *archetype = &enemyArchetypes[e->archetype];
+        const AnimSprite *sprite = &archetype->sprite;
+
+        // Lewati musuh di luar layar; margin mencakup ukuran sprite dan health bar.
+        float spriteExtent = fmaxf((float)sprite->frameWidth, (float)sprite->frameHeight) * archetype->drawScale * globalScale;
+        if (!IsWorldPointVisible(e->position, spriteExtent + CULL_MARGIN_PIXELS, globalScale, offsetX, offsetY))
+            continue;
+
         Vector2 screenPos = {
             offsetX + e->position.x * globalScale,
             offsetY + e->position.y * globalScale};
 
-        DrawAnimSprite(&e->animData, screenPos, e->drawScale * globalScale, WHITE);
+        DrawAnimSprite(sprite, animationClock + e->animPhase, screenPos, archetype->drawScale * globalScale, WHITE);
 
         
         float healthBarWidth = TILE_SIZE * globalScale * 0.8f;
         float healthBarHeight = 5.0f * globalScale;
-        float healthBarOffsetY = -((float)e->animData.frameHeight * e->drawScale * globalScale / 2.0f) - (healthBarHeight / 2.0f) - (5.0f * globalScale);
+        float healthBarOffsetY = -((float)sprite->frameHeight * archetype->drawScale * globalScale / 2.0f) - (healthBarHeight / 2.0f) - (5.0f * globalScale);
 
         DrawRectangle(screenPos.x - (healthBarWidth / 2.0f),
                       screenPos.y + healthBarOffsetY,
                       healthBarWidth, healthBarHeight, BLACK);
 
-        float currentHealthWidth = (float)e->hp / (100.0f + ((float)e->waveNum -1) * 10.0f) * healthBarWidth;
+        float currentHealthWidth = e->maxHp > 0 ? (float)GetEnemyHP(e) / e->maxHp * healthBarWidth : 0.0f;
         if (currentHealthWidth < 0) currentHealthWidth = 0;
 
         DrawRectangle(screenPos.x - (healthBarWidth / 2.0f),
@@ -531,50 +508,29 @@ void Enemies_Draw(float globalScale, float offsetX, float offsetY) {
 
 // I.S. : EnemyWave belum dibuat
 // F.S. : Sebuah 'EnemyWave' dibuat, dialokasikan di memori, dan dikembalikan.
-EnemyWave* CreateWave(int startRow, int startCol) { 
-    EnemyWave* newWave = (EnemyWave*)malloc(sizeof(EnemyWave)); 
+EnemyWave* CreateWave(const SpawnPoint *spawns, int spawnCount) { 
+    TRACE_BEGIN("CreateWave");
+    EnemyWave* newWave = (EnemyWave*)Memory_Alloc(MEM_TAG_WAVE, sizeof(EnemyWave)); 
     if (newWave == NULL) {
         TraceLog(LOG_ERROR, "Failed to allocate memory for new EnemyWave. Returning NULL.");
+        TRACE_END("CreateWave");
         return NULL;
     }
     *newWave = (EnemyWave){0}; 
+    bool useFlowField = FlowField_IsActive();
+    newWave->routes = useFlowField ? NULL : PathCache_Acquire(spawns, spawnCount);
 
     newWave->waveNum = currentWaveNum; 
-    newWave->enemiesToSpawnInThisWave = 5 + (newWave->waveNum - 1); 
-    InitEnemyQueue(&newWave->enemyQueue);
-    
-    for (int i = 0; i < newWave->enemiesToSpawnInThisWave; i++) {
-        Enemy tempEnemy = {0}; 
-        tempEnemy.waveNum = newWave->waveNum; 
-        tempEnemy.parentWave = newWave;
-        tempEnemy.t = 0.0f;
-        tempEnemy.speed = 15.0f + (newWave->waveNum * 3.0f) + (rand() % 20); 
-        tempEnemy.active = false; 
-        tempEnemy.spawned = false;
-        tempEnemy.segment = 0;
-        tempEnemy.position = (Vector2){0, 0};
-        tempEnemy.hp = 100 + ((newWave->waveNum - 1) * 10); 
-        tempEnemy.spriteType = rand() % 2;
-
-        if (tempEnemy.spriteType == 0) {
-            tempEnemy.animData = enemy1_anim_data;
-            tempEnemy.drawScale = 0.7f;
-        } else {
-            tempEnemy.animData = enemy2_anim_data;
-            tempEnemy.drawScale = 0.2f;   
-        }
-        tempEnemy.animData.currentFrame = 0;
-        tempEnemy.animData.frameCounter = 0.0f;
-        EnqueueEnemy(&newWave->enemyQueue, tempEnemy);
-    }
-    TraceLog(LOG_INFO, "Wave %d initialized with %d enemies in queue.", newWave->waveNum, newWave->enemyQueue.count);
+    newWave->enemiesToSpawnInThisWave = WaveScript_GetWave(newWave->waveNum, &newWave->spawnTable);
+    newWave->spawnCount = spawnCount < MAX_SPAWN_POINTS ? spawnCount : MAX_SPAWN_POINTS;
+    for (int i = 0; i < newWave->spawnCount; i++) newWave->spawns[i] = spawns[i];
+    TraceLog(LOG_INFO, "Wave %d initialized with %d enemies in its spawn table.", newWave->waveNum, newWave->enemiesToSpawnInThisWave);
 
     newWave->spawnedCount = 0; 
     newWave->nextSpawnIndex = 0; 
-    newWave->spawnTimer = 0.0f; 
                                                             
-    newWave->timerCurrentTime = 0.0f; 
     SetWaveTimerDuration(newWave, WAVE_TIMER_DURATION); 
+    newWave->activationTick = Scheduler_GetTick() + Scheduler_SecondsToTicks(WAVE_TIMER_DURATION);
     newWave->timerVisible = false; 
     newWave->active = false; 
     newWave->lastWaveSpawnTime = 0.0f; 
@@ -582,61 +538,58 @@ EnemyWave* CreateWave(int startRow, int startCol) {
     newWave->timerVisible = true;
     TraceLog(LOG_INFO, "Wave %d created: Timer is set to be visible upon dequeue.", newWave->waveNum);
     
-    SetTimerMapRow(newWave, startRow);
-    SetTimerMapCol(newWave, startCol); 
+    SetTimerMapRow(newWave, spawnCount > 0 ? spawns[0].row : 0);
+    SetTimerMapCol(newWave, spawnCount > 0 ? spawns[0].col : 0); 
 
-    newWave->timerTexture = LoadTextureSafe("assets/img/gameplay_imgs/timer.png");
+    newWave->timerTexture = LoadTextureSafe(MEM_TAG_WAVE, "assets/img/gameplay_imgs/timer.png");
     if (newWave->timerTexture.id == 0) {
         TraceLog(LOG_WARNING, "Failed to load assets/timer.png for wave timer.");
     }
 
-    Enemies_BuildPath(startCol, startRow, newWave);
+    TRACE_END("CreateWave");
     return newWave;
 }
 
+// Mengirimkan musuh ke-'index' dari tabel spawn 'wave', siap diberikan ke SpawnEnemy.
+// Titik awal dan rute dipilih saat ini; HP, kecepatan, dan sprite diambil dari tabel.
+Enemy BuildWaveEnemy(EnemyWave *wave, int index) {
+    const WaveSpawnEntry *entry = &wave->spawnTable[index];
+    int spawnIndex = index % (wave->spawnCount > 0 ? wave->spawnCount : 1);
+    Enemy enemy = {0};
+    enemy.waveNum = wave->waveNum;
+    enemy.parentWave = wave;
+    enemy.baseSpeed = entry->baseSpeed;
+    enemy.maxHp = entry->maxHp;
+    enemy.routeId = GetSpawnRouteId(wave->routes, spawnIndex, rand());
+    if (FlowField_IsActive() && wave->spawnCount > 0) {
+        // Tanpa rute, musuh mulai di pusat tile titik awalnya dan mengikuti flow field dari sana.
+        const SpawnPoint *spawn = &wave->spawns[spawnIndex];
+        enemy.flowTile = spawn->row * GetMapCols() + spawn->col;
+        enemy.position = (Vector2){ spawn->col * (float)TILE_SIZE + TILE_SIZE / 2.0f,
+                                    spawn->row * (float)TILE_SIZE + TILE_SIZE / 2.0f };
+    }
+    enemy.archetype = entry->archetype;
+    return enemy;
+}
+
 // I.S. : 'wave' menunjuk ke sebuah EnemyWave yang valid.
 // F.S. : Semua memori yang dialokasikan untuk 'wave' dan antrian di dalamnya telah dibebaskan.
 // Pointer 'wave' diatur menjadi NULL.
 void FreeWave(EnemyWave **wave) { 
     if (wave && *wave) { 
-        ClearEnemyQueue(&(*wave)->enemyQueue);
+        Scheduler_CancelTarget(*wave);
+        PathCache_Release((*wave)->routes);
                 
         if ((*wave)->timerTexture.id != 0) {
             UnloadTextureSafe(&(*wave)->timerTexture);
             (*wave)->timerTexture = (Texture2D){0};
         }
-        free(*wave); 
+        Memory_Free(*wave); 
         *wave = NULL; 
         TraceLog(LOG_INFO, "Wave freed.");
     }
 }
 
-// I.S. : 'wave' memiliki timer yang sedang berjalan atau tidak aktif.
-// F.S. : 'timerCurrentTime' dari 'wave' diperbarui. Jika timer selesai, 'wave->active' menjadi true
-// dan fungsi mengembalikan 'true'. Jika tidak, mengembalikan 'false'.
-bool UpdateWaveTimer(EnemyWave *wave, float deltaTime) { 
-    if (!wave) {
-        TraceLog(LOG_WARNING, "UpdateWaveTimer: Wave is NULL.");
-        return false; 
-    }
-    if (!wave->active && wave->timerVisible) {
-        float timer = wave->timerCurrentTime + deltaTime;
-        wave->timerCurrentTime = timer;
-        
-        if (timer >= wave->timerDuration) {
-            wave->timerCurrentTime = 0.0f;
-            wave->timerVisible = false;    
-            wave->active = true; 
-            wave->lastWaveSpawnTime = GetTime(); 
-
-            TraceLog(LOG_INFO, "[W%d (num %d)] Timer finished. Wave ACTIVATED (enemies will spawn)! Last wave spawn time: %.2f",
-                     wave->waveNum, currentWaveNum, wave->lastWaveSpawnTime);
-            return true; 
-        }
-    }
-    return false; 
-}
-
 // I.S. : 'wave' adalah gelombang yang sedang atau telah berjalan.
 // F.S. : Mengembalikan 'true' jika semua musuh dari 'wave' ini sudah di-spawn DAN sudah tidak ada lagi
 // yang aktif di layar. Mengembalikan 'false' jika sebaliknya.
@@ -691,10 +644,26 @@ void DrawGameTimer(const EnemyWave *wave, float globalScale, float offsetX, floa
 Vector2 GetEnemyPosition(const Enemy *enemy) { return enemy ? enemy->position : (Vector2){0, 0}; }
 
 // Mengembalikan nilai HP dari 'enemy'.
-int GetEnemyHP(const Enemy *enemy) { return enemy ? enemy->hp : 0; }
+int GetEnemyHP(const Enemy *enemy) { return enemy ? enemyKinematics.hp[GetEnemySlot(enemy)] : 0; }
+
+// Mengirimkan jarak yang sudah ditempuh 'enemy' sepanjang jalurnya.
+float GetEnemyDistance(const Enemy *enemy) { return enemy ? enemyKinematics.distance[GetEnemySlot(enemy)] : 0.0f; }
 
-// Mengirimkan nilai waktu saat ini (progress) dari timer 'wave'.
-float GetWaveTimerCurrentTime(const EnemyWave *wave) { return wave ? wave->timerCurrentTime : 0.0f; }
+// Mengirimkan rute yang diikuti 'enemy', atau NULL jika wave-nya tidak memiliki tabel rute.
+const MapPath *GetEnemyRoute(const Enemy *enemy) {
+    return enemy && enemy->parentWave ? GetRoute(enemy->parentWave->routes, enemy->routeId) : NULL;
+}
+
+// Mengirimkan true jika 'enemy' sedang terkena stun.
+bool IsEnemyStunned(const Enemy *enemy) { return enemy ? enemyKinematics.stunned[GetEnemySlot(enemy)] != 0.0f : false; }
+
+// Mengirimkan nilai waktu saat ini (progress) dari timer 'wave', dihitung dari selisih tick
+// scheduler saat ini dengan 'wave->activationTick'.
+float GetWaveTimerCurrentTime(const EnemyWave *wave) {
+    if (!wave) return 0.0f;
+    float time = wave->timerDuration - Scheduler_TicksToSeconds(wave->activationTick - Scheduler_GetTick());
+    return Clamp(time, 0.0f, wave->timerDuration);
+}
 
 // Mengirimkan total durasi timer dari 'wave'.
 float GetWaveTimerDuration(const EnemyWave *wave) { return wave ? wave->timerDuration : 0.0f; }
@@ -702,26 +671,79 @@ float GetWaveTimerDuration(const EnemyWave *wave) { return wave ? wave->timerDur
 // Mengirimkan true jika visual timer untuk 'wave' sedang ditampilkan.
 bool GetWaveTimerVisible(const EnemyWave *wave) { return wave ? wave->timerVisible : false; }
 
+// Mengirimkan true jika 'wave' sedang dalam fase aktif (men-spawn musuh).
+bool GetWaveActive(const EnemyWave *wave) { return wave ? wave->active : false; }
+
 // Mengirimkan posisi baris di peta untuk timer 'wave'.
 int GetTimerMapRow(const EnemyWave *wave) { return wave ? wave->timerMapRow : 0; }
 
 // Mengirimkan posisi kolom di peta untuk timer 'wave'.
 int GetTimerMapCol(const EnemyWave *wave) { return wave ? wave->timerMapCol : 0; }
 
+// Mengirimkan archetype musuh ke-'index', atau archetype pertama jika indeks tidak valid.
+const EnemyArchetype *GetEnemyArchetype(int index) {
+    return &enemyArchetypes[index >= 0 && index < ENEMY_ARCHETYPE_COUNT ? index : 0];
+}
+
+// Mengirimkan indeks archetype bernama 'name', atau -1 jika tidak ada.
+int FindEnemyArchetype(const char *name) {
+    for (int i = 0; i < ENEMY_ARCHETYPE_COUNT; i++) {
+        if (strcmp(enemyArchetypes[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
 // I.S. : HP 'enemy' memiliki nilai lama.
 // F.S. : HP 'enemy' diatur menjadi nilai 'hp' yang baru.
 void SetEnemyHP(Enemy *enemy, int hp)
 {
     if (enemy)
-        enemy->hp = hp;
+        enemyKinematics.hp[GetEnemySlot(enemy)] = hp;
+}
+
+// I.S. : 'enemy' aktif dengan HP sembarang.
+// F.S. : HP 'enemy' berkurang sebesar 'damage' setelah dikurangi resistansi archetype-nya
+// terhadap 'type'.
+void DamageEnemy(Enemy *enemy, int damage, DamageType type)
+{
+    if (!enemy)
+        return;
+    float resistance = enemyArchetypes[enemy->archetype].resistance[type];
+    if (resistance != 0.0f)
+        damage = (int)(damage * (1.0f - resistance) + 0.5f);
+    enemyKinematics.hp[GetEnemySlot(enemy)] -= damage;
+}
+
+// Handler event scheduler: mencabut stun 'target' jika stun yang berakhir pada tick 'untilTick'
+// masih berlaku. Stun yang sudah diperpanjang atau slot yang sudah dipakai musuh lain diabaikan.
+static void OnStunExpired(void *target, int untilTick)
+{
+    Enemy *enemy = (Enemy *)target;
+    if (!enemy->active || enemy->stunUntilTick != untilTick) return;
+    enemyKinematics.stunned[GetEnemySlot(enemy)] = 0.0f;
+    enemy->stunUntilTick = -1;
+}
+
+// I.S. : 'enemy' aktif, mungkin sedang terkena stun.
+// F.S. : 'enemy' tidak bergerak selama 'duration' detik ke depan. Berakhirnya stun dijadwalkan
+// sebagai event, sehingga musuh yang tidak terkena stun tidak diperiksa setiap frame.
+void StunEnemy(Enemy *enemy, float duration)
+{
+    if (!enemy || duration <= 0.0f) return;
+    int delay = Scheduler_SecondsToTicks(duration);
+    int untilTick = Scheduler_GetTick() + delay;
+    if (!Scheduler_Schedule(delay, OnStunExpired, enemy, untilTick)) return;
+    enemyKinematics.stunned[GetEnemySlot(enemy)] = 1.0f;
+    enemy->stunUntilTick = untilTick;
 }
 
 // I.S. : Waktu progress timer 'wave' sembarang.
-// F.S. : Properti 'wave->timerCurrentTime' diatur menjadi nilai 'time' yang baru.
+// F.S. : 'wave->activationTick' digeser sehingga progress timer bernilai 'time'. Event aktivasi
+// yang sudah dijadwalkan tidak ikut bergeser; pemanggil menjadwalkan ulang jika perlu.
 void SetWaveTimerCurrentTime(EnemyWave *wave, float time)
 {
     if (wave)
-        wave->timerCurrentTime = time;
+        wave->activationTick = Scheduler_GetTick() + Scheduler_SecondsToTicks(wave->timerDuration - time);
 }
 
 // I.S. : Durasi timer 'wave' sembarang.
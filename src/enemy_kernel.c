@@ -0,0 +1,229 @@
+/* File        : enemy_kernel.c
+* Deskripsi   : Implementasi untuk modul Enemy Kernel.
+*               Kelima array SoA berada dalam satu blok heap agar salin dan bebas cukup sekali.
+*               Implementasi SIMD dipilih saat runtime dengan __builtin_cpu_supports sehingga
+*               binary yang sama tetap berjalan di CPU tanpa AVX2.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "enemy_kernel.h"
+#include "memory_tracker.h"
+#include <float.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ENEMY_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+#define ENEMY_KINEMATICS_FIELDS 5
+
+EnemyKinematics enemyKinematics = {0};
+
+static EnemyKernelMode requestedMode = ENEMY_KERNEL_AUTO;
+static EnemyKernelMode activeMode = ENEMY_KERNEL_AUTO;  // AUTO berarti belum ditentukan
+
+/* I.S. : 'kinematics' sembarang.
+   F.S. : 'kinematics' memiliki 'count' slot dalam keadaan diam.
+          Mengembalikan false jika alokasi gagal. */
+bool InitEnemyKinematics(EnemyKinematics *kinematics, int count) {
+    FreeEnemyKinematics(kinematics);
+    if (count < 0) count = 0;
+    int capacity = (count + ENEMY_KERNEL_LANES - 1) / ENEMY_KERNEL_LANES * ENEMY_KERNEL_LANES;
+    if (capacity == 0) capacity = ENEMY_KERNEL_LANES;
+
+    // float dan int32_t berukuran sama sehingga setiap field menempati 'capacity' elemen 4 byte.
+    unsigned char *block = (unsigned char *)Memory_Alloc(MEM_TAG_ENEMY, (size_t)capacity * 4 * ENEMY_KINEMATICS_FIELDS);
+    if (block == NULL) {
+        TraceLog(LOG_ERROR, "ENEMY_KERNEL: Failed to allocate kinematics for %d enemies.", count);
+        return false;
+    }
+    kinematics->distance = (float *)block;
+    kinematics->speed = kinematics->distance + capacity;
+    kinematics->stunned = kinematics->speed + capacity;
+    kinematics->pathLength = kinematics->stunned + capacity;
+    kinematics->hp = (int32_t *)(kinematics->pathLength + capacity);
+    kinematics->count = count;
+    kinematics->capacity = capacity;
+    for (int i = 0; i < capacity; i++) {
+        ResetEnemyKinematicsSlot(kinematics, i);
+    }
+    return true;
+}
+
+/* I.S. : 'kinematics' mungkin memiliki array yang dialokasikan.
+   F.S. : Semua array dibebaskan dan 'kinematics' kosong. */
+void FreeEnemyKinematics(EnemyKinematics *kinematics) {
+    Memory_Free(kinematics->distance);
+    *kinematics = (EnemyKinematics){0};
+}
+
+/* I.S. : 'dest' dan 'src' memiliki kapasitas yang sama.
+   F.S. : Isi semua array 'src' disalin ke 'dest'. */
+void CopyEnemyKinematics(EnemyKinematics *dest, const EnemyKinematics *src) {
+    if (dest->capacity != src->capacity) {
+        TraceLog(LOG_WARNING, "ENEMY_KERNEL: Copy between kinematics of different capacity (%d vs %d).",
+                 dest->capacity, src->capacity);
+        return;
+    }
+    memcpy(dest->distance, src->distance, (size_t)src->capacity * 4 * ENEMY_KINEMATICS_FIELDS);
+}
+
+/* I.S. : 'slot' valid.
+   F.S. : Slot 'slot' berada dalam keadaan diam. */
+void ResetEnemyKinematicsSlot(EnemyKinematics *kinematics, int slot) {
+    kinematics->distance[slot] = 0.0f;
+    kinematics->speed[slot] = 0.0f;
+    kinematics->stunned[slot] = 0.0f;
+    kinematics->pathLength[slot] = FLT_MAX;
+    kinematics->hp[slot] = 1;
+}
+
+/* I.S. : 'events' sembarang.
+   F.S. : 'events' memiliki buffer untuk 'capacity' indeks per daftar.
+          Mengembalikan false jika alokasi gagal. */
+bool InitEnemyKernelEvents(EnemyKernelEvents *events, int capacity) {
+    FreeEnemyKernelEvents(events);
+    int *buffer = (int *)Memory_Alloc(MEM_TAG_ENEMY, sizeof(int) * (size_t)capacity * 2);
+    if (buffer == NULL) {
+        TraceLog(LOG_ERROR, "ENEMY_KERNEL: Failed to allocate event lists for %d enemies.", capacity);
+        return false;
+    }
+    events->died = buffer;
+    events->reachedEnd = buffer + capacity;
+    events->capacity = capacity;
+    return true;
+}
+
+/* I.S. : 'events' mungkin memiliki buffer yang dialokasikan.
+   F.S. : Buffer dibebaskan dan 'events' kosong. */
+void FreeEnemyKernelEvents(EnemyKernelEvents *events) {
+    Memory_Free(events->died);
+    *events = (EnemyKernelEvents){0};
+}
+
+// Kernel skalar: acuan perilaku untuk kernel SIMD.
+static void RunKernelScalar(EnemyKinematics *k, float deltaTime, EnemyKernelEvents *events) {
+    for (int i = 0; i < k->capacity; i++) {
+        if (k->stunned[i] == 0.0f) k->distance[i] += k->speed[i] * deltaTime;
+
+        if (k->hp[i] <= 0) {
+            events->died[events->diedCount++] = i;
+        } else if (k->distance[i] >= k->pathLength[i]) {
+            events->reachedEnd[events->reachedEndCount++] = i;
+        }
+    }
+}
+
+#ifdef ENEMY_KERNEL_X86
+
+// Menambahkan indeks 'base + bit' untuk setiap bit yang menyala di 'mask' ke 'list'.
+static inline int EmitMaskIndices(int mask, int base, int *list, int count) {
+    while (mask != 0) {
+        list[count++] = base + __builtin_ctz((unsigned int)mask);
+        mask &= mask - 1;
+    }
+    return count;
+}
+
+__attribute__((target("sse2")))
+static void RunKernelSSE2(EnemyKinematics *k, float deltaTime, EnemyKernelEvents *events) {
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128i one = _mm_set1_epi32(1);
+    for (int i = 0; i < k->capacity; i += 4) {
+        __m128 moving = _mm_cmpeq_ps(_mm_loadu_ps(k->stunned + i), zero);
+        __m128 step = _mm_and_ps(moving, _mm_mul_ps(_mm_loadu_ps(k->speed + i), dt));
+        __m128 distance = _mm_add_ps(_mm_loadu_ps(k->distance + i), step);
+        _mm_storeu_ps(k->distance + i, distance);
+
+        __m128i died = _mm_cmplt_epi32(_mm_loadu_si128((const __m128i *)(k->hp + i)), one);
+        __m128 atEnd = _mm_cmpge_ps(distance, _mm_loadu_ps(k->pathLength + i));
+        int diedMask = _mm_movemask_ps(_mm_castsi128_ps(died));
+        int endMask = _mm_movemask_ps(atEnd) & ~diedMask;
+
+        if (diedMask) events->diedCount = EmitMaskIndices(diedMask, i, events->died, events->diedCount);
+        if (endMask) events->reachedEndCount = EmitMaskIndices(endMask, i, events->reachedEnd, events->reachedEndCount);
+    }
+}
+
+__attribute__((target("avx2")))
+static void RunKernelAVX2(EnemyKinematics *k, float deltaTime, EnemyKernelEvents *events) {
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256i one = _mm256_set1_epi32(1);
+    for (int i = 0; i < k->capacity; i += 8) {
+        __m256 moving = _mm256_cmp_ps(_mm256_loadu_ps(k->stunned + i), zero, _CMP_EQ_OQ);
+        __m256 step = _mm256_and_ps(moving, _mm256_mul_ps(_mm256_loadu_ps(k->speed + i), dt));
+        __m256 distance = _mm256_add_ps(_mm256_loadu_ps(k->distance + i), step);
+        _mm256_storeu_ps(k->distance + i, distance);
+
+        __m256i died = _mm256_cmpgt_epi32(one, _mm256_loadu_si256((const __m256i *)(k->hp + i)));
+        __m256 atEnd = _mm256_cmp_ps(distance, _mm256_loadu_ps(k->pathLength + i), _CMP_GE_OQ);
+        int diedMask = _mm256_movemask_ps(_mm256_castsi256_ps(died));
+        int endMask = _mm256_movemask_ps(atEnd) & ~diedMask;
+
+        if (diedMask) events->diedCount = EmitMaskIndices(diedMask, i, events->died, events->diedCount);
+        if (endMask) events->reachedEndCount = EmitMaskIndices(endMask, i, events->reachedEnd, events->reachedEndCount);
+    }
+}
+
+#endif
+
+// Mengembalikan mode terbaik yang didukung CPU, tidak lebih tinggi dari 'mode'.
+static EnemyKernelMode ResolveMode(EnemyKernelMode mode) {
+#ifdef ENEMY_KERNEL_X86
+    __builtin_cpu_init();
+    bool hasAVX2 = __builtin_cpu_supports("avx2");
+    bool hasSSE2 = __builtin_cpu_supports("sse2");
+    if (mode == ENEMY_KERNEL_AUTO) mode = ENEMY_KERNEL_AVX2;
+    if (mode == ENEMY_KERNEL_AVX2 && !hasAVX2) mode = ENEMY_KERNEL_SSE2;
+    if (mode == ENEMY_KERNEL_SSE2 && !hasSSE2) mode = ENEMY_KERNEL_SCALAR;
+    return mode;
+#else
+    (void)mode;
+    return ENEMY_KERNEL_SCALAR;
+#endif
+}
+
+/* I.S. : 'kinematics' berisi state frame sebelumnya; kapasitas 'events' >= kapasitas 'kinematics'.
+   F.S. : Slot yang tidak sedang di-stun maju sejauh speed * deltaTime. Slot dengan HP <= 0
+          masuk ke 'died', slot lain yang jaraknya >= panjang jalur masuk ke 'reachedEnd'. Keduanya terurut naik. */
+void RunEnemyMovementKernel(EnemyKinematics *kinematics, float deltaTime, EnemyKernelEvents *events) {
+    events->diedCount = 0;
+    events->reachedEndCount = 0;
+    if (kinematics->capacity == 0) return;
+    if (events->capacity < kinematics->capacity) {
+        TraceLog(LOG_ERROR, "ENEMY_KERNEL: Event lists (%d) smaller than kinematics (%d).",
+                 events->capacity, kinematics->capacity);
+        return;
+    }
+    if (activeMode == ENEMY_KERNEL_AUTO) activeMode = ResolveMode(requestedMode);
+
+    switch (activeMode) {
+#ifdef ENEMY_KERNEL_X86
+        case ENEMY_KERNEL_AVX2: RunKernelAVX2(kinematics, deltaTime, events); break;
+        case ENEMY_KERNEL_SSE2: RunKernelSSE2(kinematics, deltaTime, events); break;
+#endif
+        default: RunKernelScalar(kinematics, deltaTime, events); break;
+    }
+}
+
+/* I.S. : Sembarang.
+   F.S. : Kernel berikutnya memakai 'mode'. Mode yang tidak didukung CPU diturunkan ke
+          mode terbaik yang didukung. */
+void SetEnemyKernelMode(EnemyKernelMode mode) {
+    requestedMode = mode;
+    activeMode = ResolveMode(mode);
+}
+
+/* Mengirimkan nama implementasi kernel yang sedang dipakai ("avx2", "sse2", atau "scalar"). */
+const char *GetEnemyKernelName(void) {
+    if (activeMode == ENEMY_KERNEL_AUTO) activeMode = ResolveMode(requestedMode);
+    switch (activeMode) {
+        case ENEMY_KERNEL_AVX2: return "avx2";
+        case ENEMY_KERNEL_SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
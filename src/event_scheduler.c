@@ -0,0 +1,156 @@
+/* File        : event_scheduler.c
+* Deskripsi   : Implementasi untuk modul Event Scheduler.
+*               Heap minimum diurutkan berdasarkan (tick, nomor urut). Nomor urut membuat event
+*               dengan tick yang sama dijalankan sesuai urutan penjadwalannya, sehingga hasil
+*               simulasi deterministik untuk rangkaian delta time yang sama.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "event_scheduler.h"
+#include "memory_tracker.h"
+
+#define SCHEDULER_TICK_SECONDS (1.0f / SCHEDULER_TICK_RATE)
+
+/* Satu event yang menunggu di heap. */
+typedef struct {
+    int tick;
+    unsigned int sequence;
+    ScheduledEventFn fn;
+    void *target;
+    int arg;
+} ScheduledEvent;
+
+static struct {
+    ScheduledEvent *heap;
+    int count;
+    int capacity;
+    int tick;
+    float accumulator;
+    unsigned int nextSequence;
+} scheduler;
+
+// Mengirimkan true jika event 'a' harus dijalankan sebelum event 'b'.
+static bool EventBefore(const ScheduledEvent *a, const ScheduledEvent *b) {
+    return a->tick < b->tick || (a->tick == b->tick && a->sequence < b->sequence);
+}
+
+// Menggeser entri di posisi 'i' ke atas sampai sifat heap terpenuhi.
+static void SiftUp(int i) {
+    ScheduledEvent event = scheduler.heap[i];
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!EventBefore(&event, &scheduler.heap[parent])) break;
+        scheduler.heap[i] = scheduler.heap[parent];
+        i = parent;
+    }
+    scheduler.heap[i] = event;
+}
+
+// Menggeser entri di posisi 'i' ke bawah sampai sifat heap terpenuhi.
+static void SiftDown(int i) {
+    ScheduledEvent event = scheduler.heap[i];
+    while (true) {
+        int child = i * 2 + 1;
+        if (child >= scheduler.count) break;
+        if (child + 1 < scheduler.count && EventBefore(&scheduler.heap[child + 1], &scheduler.heap[child])) child++;
+        if (!EventBefore(&scheduler.heap[child], &event)) break;
+        scheduler.heap[i] = scheduler.heap[child];
+        i = child;
+    }
+    scheduler.heap[i] = event;
+}
+
+/* I.S. : Scheduler mungkin berisi event dari sesi sebelumnya.
+   F.S. : Semua event dibuang dan tick kembali ke 0. Buffer heap tetap dipakai ulang. */
+void Scheduler_Reset(void) {
+    scheduler.count = 0;
+    scheduler.tick = 0;
+    scheduler.accumulator = 0.0f;
+    scheduler.nextSequence = 0;
+}
+
+/* I.S. : Scheduler mungkin memiliki buffer heap.
+   F.S. : Buffer dibebaskan dan scheduler kosong. */
+void Scheduler_Shutdown(void) {
+    Memory_Free(scheduler.heap);
+    scheduler.heap = NULL;
+    scheduler.capacity = 0;
+    Scheduler_Reset();
+}
+
+/* I.S. : Scheduler berisi event sembarang.
+   F.S. : 'fn(target, arg)' dijadwalkan pada tick saat ini + 'delayTicks' (minimal tick saat ini).
+          Event dengan tick yang sama dijalankan sesuai urutan penjadwalan.
+          Mengembalikan false jika heap tidak bisa diperbesar. */
+bool Scheduler_Schedule(int delayTicks, ScheduledEventFn fn, void *target, int arg) {
+    if (fn == NULL) return false;
+    if (scheduler.count >= scheduler.capacity) {
+        int newCapacity = scheduler.capacity > 0 ? scheduler.capacity * 2 : 64;
+        ScheduledEvent *newHeap = (ScheduledEvent *)Memory_Realloc(MEM_TAG_WAVE, scheduler.heap, sizeof(ScheduledEvent) * newCapacity);
+        if (newHeap == NULL) {
+            TraceLog(LOG_ERROR, "SCHEDULER: Failed to grow event heap to %d entries.", newCapacity);
+            return false;
+        }
+        scheduler.heap = newHeap;
+        scheduler.capacity = newCapacity;
+    }
+    int i = scheduler.count++;
+    scheduler.heap[i] = (ScheduledEvent){
+        scheduler.tick + (delayTicks > 0 ? delayTicks : 0), scheduler.nextSequence++, fn, target, arg
+    };
+    SiftUp(i);
+    return true;
+}
+
+/* I.S. : Scheduler mungkin berisi event untuk 'target'.
+   F.S. : Semua event dengan 'target' tersebut dibuang. Dipanggil sebelum objek target dibebaskan. */
+void Scheduler_CancelTarget(const void *target) {
+    int kept = 0;
+    for (int i = 0; i < scheduler.count; i++) {
+        if (scheduler.heap[i].target != target) scheduler.heap[kept++] = scheduler.heap[i];
+    }
+    if (kept == scheduler.count) return;
+    scheduler.count = kept;
+    for (int i = scheduler.count / 2 - 1; i >= 0; i--) SiftDown(i);
+}
+
+/* I.S. : Tick dan sisa waktu dari frame sebelumnya.
+   F.S. : 'deltaTime' ditambahkan ke akumulator, tick maju sebanyak tick penuh yang terkumpul,
+          lalu semua event dengan tick <= tick saat ini dijalankan berurutan. Event yang
+          dijadwalkan oleh handler dengan tick yang sudah lewat ikut dijalankan pada frame ini. */
+void Scheduler_Advance(float deltaTime) {
+    if (deltaTime > 0.0f) scheduler.accumulator += deltaTime;
+    int elapsed = (int)(scheduler.accumulator / SCHEDULER_TICK_SECONDS);
+    scheduler.accumulator -= elapsed * SCHEDULER_TICK_SECONDS;
+    scheduler.tick += elapsed;
+
+    while (scheduler.count > 0 && scheduler.heap[0].tick <= scheduler.tick) {
+        ScheduledEvent event = scheduler.heap[0];
+        scheduler.heap[0] = scheduler.heap[--scheduler.count];
+        if (scheduler.count > 0) SiftDown(0);
+        event.fn(event.target, event.arg);
+    }
+}
+
+/* Mengirimkan tick saat ini. */
+int Scheduler_GetTick(void) {
+    return scheduler.tick;
+}
+
+/* Mengirimkan jumlah event yang masih menunggu. */
+int Scheduler_GetPendingCount(void) {
+    return scheduler.count;
+}
+
+/* Mengirimkan 'seconds' yang dibulatkan ke tick terdekat. Durasi positif minimal satu tick. */
+int Scheduler_SecondsToTicks(float seconds) {
+    if (seconds <= 0.0f) return 0;
+    int ticks = (int)(seconds * SCHEDULER_TICK_RATE + 0.5f);
+    return ticks > 0 ? ticks : 1;
+}
+
+/* Mengirimkan lama 'ticks' dalam detik. */
+float Scheduler_TicksToSeconds(int ticks) {
+    return ticks * SCHEDULER_TICK_SECONDS;
+}
@@ -0,0 +1,334 @@
+/* File        : flow_field.c
+* Deskripsi   : Implementasi untuk modul Flow Field.
+*               Jarak dibangun dengan BFS multi-sumber dari semua tile exit. Saat sebuah tile
+*               diblokir, tile yang kehilangan satu-satunya tetangga penopang (tetangga dengan
+*               jarak tepat satu lebih kecil) ditandai tidak valid secara berantai, lalu daerah
+*               itu diisi ulang dengan Dijkstra dari tetangga yang masih valid. Saat sebuah tile
+*               dibuka, jarak yang lebih pendek disebarkan dengan Dijkstra yang sama.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "flow_field.h"
+#include "memory_tracker.h"
+#include "trace.h"
+
+static const int dxFlow[] = {0, 1, 0, -1};
+static const int dyFlow[] = {-1, 0, 1, 0};
+
+/* Entri heap untuk perbaikan inkremental. Entri yang jaraknya sudah tidak sama dengan
+   distance[tile] dilewati saat diambil (lazy deletion). */
+typedef struct {
+    int distance;
+    int tile;
+} FlowHeapEntry;
+
+/* Entri stack invalidasi: tile dan jaraknya sebelum ditandai tidak valid. */
+typedef struct {
+    int tile;
+    int oldDistance;
+} FlowInvalidEntry;
+
+static struct {
+    int *distance;
+    int rows;
+    int cols;
+    SpawnPoint spawns[MAX_SPAWN_POINTS];
+    int spawnCount;
+    FlowHeapEntry *heap;
+    int heapCount;
+    int heapCapacity;
+    FlowInvalidEntry *invalid;      // Stack penelusuran sekaligus daftar tile yang diinvalidasi
+    bool active;
+} field;
+
+// Mengirimkan true jika (row, col) berada di dalam peta flow field.
+static bool InsideField(int row, int col) {
+    return row >= 0 && col >= 0 && row < field.rows && col < field.cols;
+}
+
+/* Mengirimkan true jika musuh bisa melewati tile (row, col) pada mode flow field. */
+bool FlowField_IsWalkable(int row, int col) {
+    int tile = GetMapTile(row, col);
+    return tile == 1 || tile == 4;
+}
+
+/* Mengirimkan true jika (row, col) adalah tile exit flow field saat ini: tile jalan (1) di tepi
+   peta yang bukan titik awal. */
+bool FlowField_IsExit(int row, int col) {
+    return IsGridExitTile(&gameMap, field.spawns, field.spawnCount, row, col);
+}
+
+// Mengirimkan jarak terbaik untuk 'tile' dari tetangganya yang valid (atau 0 untuk exit).
+static int BestDistanceFromNeighbours(int tile) {
+    int row = tile / field.cols;
+    int col = tile % field.cols;
+    if (!FlowField_IsWalkable(row, col)) return FLOW_FIELD_UNREACHABLE;
+    if (FlowField_IsExit(row, col)) return 0;
+
+    int best = FLOW_FIELD_UNREACHABLE;
+    for (int d = 0; d < 4; d++) {
+        int nextRow = row + dyFlow[d];
+        int nextCol = col + dxFlow[d];
+        if (!InsideField(nextRow, nextCol)) continue;
+        int neighbour = field.distance[nextRow * field.cols + nextCol];
+        if (neighbour != FLOW_FIELD_UNREACHABLE && neighbour + 1 < best) best = neighbour + 1;
+    }
+    return best;
+}
+
+// Memasukkan (distance, tile) ke heap minimum.
+static void HeapPush(int distance, int tile) {
+    if (field.heapCount >= field.heapCapacity) {
+        int newCapacity = field.heapCapacity > 0 ? field.heapCapacity * 2 : 256;
+        FlowHeapEntry *newHeap = (FlowHeapEntry *)Memory_Realloc(MEM_TAG_MAP, field.heap, sizeof(FlowHeapEntry) * newCapacity);
+        if (newHeap == NULL) {
+            TraceLog(LOG_ERROR, "FLOW_FIELD: Failed to grow repair heap to %d entries.", newCapacity);
+            return;
+        }
+        field.heap = newHeap;
+        field.heapCapacity = newCapacity;
+    }
+    int i = field.heapCount++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (field.heap[parent].distance <= distance) break;
+        field.heap[i] = field.heap[parent];
+        i = parent;
+    }
+    field.heap[i] = (FlowHeapEntry){ distance, tile };
+}
+
+// Mengambil entri dengan jarak terkecil dari heap. Heap tidak boleh kosong.
+static FlowHeapEntry HeapPop(void) {
+    FlowHeapEntry top = field.heap[0];
+    FlowHeapEntry last = field.heap[--field.heapCount];
+    int i = 0;
+    while (true) {
+        int child = i * 2 + 1;
+        if (child >= field.heapCount) break;
+        if (child + 1 < field.heapCount && field.heap[child + 1].distance < field.heap[child].distance) child++;
+        if (field.heap[child].distance >= last.distance) break;
+        field.heap[i] = field.heap[child];
+        i = child;
+    }
+    if (field.heapCount > 0) field.heap[i] = last;
+    return top;
+}
+
+// Menyebarkan jarak dari semua entri heap sampai heap kosong (Dijkstra dengan bobot 1).
+static void PropagateFromHeap(void) {
+    while (field.heapCount > 0) {
+        FlowHeapEntry entry = HeapPop();
+        if (entry.distance != field.distance[entry.tile]) continue;
+
+        int row = entry.tile / field.cols;
+        int col = entry.tile % field.cols;
+        for (int d = 0; d < 4; d++) {
+            int nextRow = row + dyFlow[d];
+            int nextCol = col + dxFlow[d];
+            if (!InsideField(nextRow, nextCol) || !FlowField_IsWalkable(nextRow, nextCol)) continue;
+            int next = nextRow * field.cols + nextCol;
+            if (field.distance[next] > entry.distance + 1) {
+                field.distance[next] = entry.distance + 1;
+                HeapPush(entry.distance + 1, next);
+            }
+        }
+    }
+}
+
+// Mengirimkan true jika 'tile' masih memiliki tetangga dengan jarak tepat satu lebih kecil.
+static bool HasSupport(int tile) {
+    int row = tile / field.cols;
+    int col = tile % field.cols;
+    int wanted = field.distance[tile] - 1;
+    for (int d = 0; d < 4; d++) {
+        int nextRow = row + dyFlow[d];
+        int nextCol = col + dxFlow[d];
+        if (InsideField(nextRow, nextCol) && field.distance[nextRow * field.cols + nextCol] == wanted) return true;
+    }
+    return false;
+}
+
+// Menandai 'tile' dan semua tile yang hanya ditopang olehnya sebagai tidak valid, lalu
+// mengisi ulang daerah tersebut dari tetangga yang masih valid.
+static void RaiseFrom(int tile) {
+    int invalidCount = 0;
+    field.invalid[invalidCount++] = (FlowInvalidEntry){ tile, field.distance[tile] };
+    field.distance[tile] = FLOW_FIELD_UNREACHABLE;
+
+    // Stack dan daftar memakai array yang sama: 'scan' menunjuk entri berikutnya yang diperiksa.
+    for (int scan = 0; scan < invalidCount; scan++) {
+        FlowInvalidEntry entry = field.invalid[scan];
+        int row = entry.tile / field.cols;
+        int col = entry.tile % field.cols;
+        for (int d = 0; d < 4; d++) {
+            int nextRow = row + dyFlow[d];
+            int nextCol = col + dxFlow[d];
+            if (!InsideField(nextRow, nextCol)) continue;
+            int next = nextRow * field.cols + nextCol;
+            int nextDistance = field.distance[next];
+            if (nextDistance == FLOW_FIELD_UNREACHABLE || nextDistance == 0) continue;
+            if (nextDistance != entry.oldDistance + 1 || HasSupport(next)) continue;
+            field.invalid[invalidCount++] = (FlowInvalidEntry){ next, nextDistance };
+            field.distance[next] = FLOW_FIELD_UNREACHABLE;
+        }
+    }
+
+    for (int i = 0; i < invalidCount; i++) {
+        int invalidTile = field.invalid[i].tile;
+        int best = BestDistanceFromNeighbours(invalidTile);
+        if (best != FLOW_FIELD_UNREACHABLE) {
+            field.distance[invalidTile] = best;
+            HeapPush(best, invalidTile);
+        }
+    }
+    PropagateFromHeap();
+}
+
+/* I.S. : Flow field mungkin aktif untuk peta sebelumnya.
+   F.S. : Flow field aktif untuk gameMap saat ini. Tile exit adalah tile jalan (1) di tepi peta
+          yang bukan salah satu 'spawns'. Mengembalikan false jika alokasi gagal atau tidak ada
+          titik awal yang bisa mencapai exit; flow field tidak aktif dalam kasus itu. */
+bool FlowField_Build(const SpawnPoint *spawns, int spawnCount) {
+    TRACE_BEGIN("FlowField_Build");
+    FlowField_Clear();
+    field.rows = GetMapRows();
+    field.cols = GetMapCols();
+    field.spawnCount = spawnCount < MAX_SPAWN_POINTS ? spawnCount : MAX_SPAWN_POINTS;
+    for (int i = 0; i < field.spawnCount; i++) field.spawns[i] = spawns[i];
+
+    size_t cells = (size_t)field.rows * field.cols;
+    field.distance = (int *)Memory_Alloc(MEM_TAG_MAP, sizeof(int) * cells);
+    field.invalid = (FlowInvalidEntry *)Memory_Alloc(MEM_TAG_MAP, sizeof(FlowInvalidEntry) * cells);
+    int *queue = (int *)Memory_Alloc(MEM_TAG_MAP, sizeof(int) * cells);
+    if (field.distance == NULL || field.invalid == NULL || queue == NULL) {
+        TraceLog(LOG_ERROR, "FLOW_FIELD: Failed to allocate buffers for %d x %d map.", field.rows, field.cols);
+        Memory_Free(queue);
+        FlowField_Clear();
+        TRACE_END("FlowField_Build");
+        return false;
+    }
+
+    // BFS multi-sumber: semua exit masuk antrian dengan jarak 0.
+    int head = 0;
+    int tail = 0;
+    for (int row = 0; row < field.rows; row++) {
+        for (int col = 0; col < field.cols; col++) {
+            int tile = row * field.cols + col;
+            field.distance[tile] = FLOW_FIELD_UNREACHABLE;
+            if (FlowField_IsExit(row, col)) {
+                field.distance[tile] = 0;
+                queue[tail++] = tile;
+            }
+        }
+    }
+    int exitCount = tail;
+    while (head < tail) {
+        int tile = queue[head++];
+        int row = tile / field.cols;
+        int col = tile % field.cols;
+        for (int d = 0; d < 4; d++) {
+            int nextRow = row + dyFlow[d];
+            int nextCol = col + dxFlow[d];
+            if (!InsideField(nextRow, nextCol) || !FlowField_IsWalkable(nextRow, nextCol)) continue;
+            int next = nextRow * field.cols + nextCol;
+            if (field.distance[next] != FLOW_FIELD_UNREACHABLE) continue;
+            field.distance[next] = field.distance[tile] + 1;
+            queue[tail++] = next;
+        }
+    }
+    Memory_Free(queue);
+
+    int reachableSpawns = 0;
+    for (int i = 0; i < field.spawnCount; i++) {
+        int distance = FlowField_GetDistance(field.spawns[i].row, field.spawns[i].col);
+        if (distance == FLOW_FIELD_UNREACHABLE) {
+            TraceLog(LOG_WARNING, "FLOW_FIELD: Spawn (%d, %d) cannot reach any exit.", field.spawns[i].col, field.spawns[i].row);
+        } else {
+            reachableSpawns++;
+        }
+    }
+    field.active = reachableSpawns > 0;
+    if (!field.active) {
+        TraceLog(LOG_ERROR, "FLOW_FIELD: No spawn point can reach an exit (%d exit tiles).", exitCount);
+        FlowField_Clear();
+        TRACE_END("FlowField_Build");
+        return false;
+    }
+
+    TraceLog(LOG_INFO, "FLOW_FIELD: Built for %d x %d map with %d exit tiles and %d reachable tiles.",
+             field.rows, field.cols, exitCount, tail);
+    TRACE_END("FlowField_Build");
+    return true;
+}
+
+/* I.S. : Flow field mungkin aktif.
+   F.S. : Buffer flow field dibebaskan dan flow field tidak aktif. */
+void FlowField_Clear(void) {
+    Memory_Free(field.distance);
+    Memory_Free(field.invalid);
+    Memory_Free(field.heap);
+    field.distance = NULL;
+    field.invalid = NULL;
+    field.heap = NULL;
+    field.heapCount = 0;
+    field.heapCapacity = 0;
+    field.active = false;
+}
+
+/* Mengirimkan true jika peta saat ini memakai flow field. */
+bool FlowField_IsActive(void) {
+    return field.active;
+}
+
+/* I.S. : Tile (row, col) pada gameMap baru saja berubah nilai.
+   F.S. : Jika flow field aktif, jarak semua tile yang bergantung pada tile tersebut sudah
+          diperbarui. Tile yang diblokir membuat daerah di belakangnya dihitung ulang dari
+          tepi daerah itu; tile yang dibuka hanya menyebarkan jarak yang lebih pendek. */
+void FlowField_OnTileChanged(int row, int col) {
+    if (!field.active || !InsideField(row, col)) return;
+    TRACE_BEGIN("FlowField_OnTileChanged");
+    int tile = row * field.cols + col;
+    int best = BestDistanceFromNeighbours(tile);
+    int current = field.distance[tile];
+
+    if (best < current) {
+        // Tile dibuka (atau menjadi exit): hanya jarak yang lebih pendek yang perlu disebarkan.
+        field.distance[tile] = best;
+        HeapPush(best, tile);
+        PropagateFromHeap();
+    } else if (best > current) {
+        // Tile diblokir (atau berhenti menjadi exit): tile yang bergantung padanya dihitung ulang.
+        RaiseFrom(tile);
+    }
+    TRACE_END("FlowField_OnTileChanged");
+}
+
+/* Mengirimkan jumlah langkah dari tile (row, col) ke exit terdekat, 0 untuk tile exit, atau
+   FLOW_FIELD_UNREACHABLE jika tile diblokir, tidak terhubung ke exit, atau flow field tidak aktif. */
+int FlowField_GetDistance(int row, int col) {
+    if (field.distance == NULL || !InsideField(row, col)) return FLOW_FIELD_UNREACHABLE;
+    return field.distance[row * field.cols + col];
+}
+
+/* Mengirimkan indeks tile (row * cols + col) tetangga 'tile' yang jaraknya paling kecil dan lebih
+   kecil dari jarak 'tile', atau -1 jika tidak ada (tile exit atau terkurung). */
+int FlowField_NextTile(int tile) {
+    if (field.distance == NULL || tile < 0 || tile >= field.rows * field.cols) return -1;
+    int row = tile / field.cols;
+    int col = tile % field.cols;
+    int best = -1;
+    int bestDistance = field.distance[tile];
+    for (int d = 0; d < 4; d++) {
+        int nextRow = row + dyFlow[d];
+        int nextCol = col + dxFlow[d];
+        if (!InsideField(nextRow, nextCol)) continue;
+        int next = nextRow * field.cols + nextCol;
+        if (field.distance[next] < bestDistance) {
+            bestDistance = field.distance[next];
+            best = next;
+        }
+    }
+    return best;
+}
@@ -19,13 +19,20 @@
 #include "transition.h" 
 #include "audio.h"
 #include "utils.h"
+#include "camera.h"
+#include "profiler.h"
+#include "path_cache.h"
+#include "flow_field.h"
+#include "maze.h"
+#include "event_scheduler.h"
+#include "wave_script.h"
 
 char currentMapName[256]; 
 bool gameplayInitialized = false;
 GameState previousGameState;
 static EnemyWave* activeWaves[MAX_ACTIVE_WAVES] = {0};
 static int activeWavesCount = 0;
-static float timeToNextWave = -1.0f;
+static bool nextWavePending = false;   // Event OnNextWave sudah dijadwalkan
 
 float currentTileScale = 1.0f;
 float mapScreenOffsetX = 0.0f;
@@ -49,15 +56,109 @@ void InitGameplay(void) {
     InitTowerAssets(); 
     InitUpgradeTree(&tower1UpgradeTree, TOWER_TYPE_1);
 
-    moneyIconTex = LoadTexture("assets/img/gameplay_imgs/coin.png");
-    lifeIconTex = LoadTexture("assets/img/gameplay_imgs/heart.png");
-    pauseButtonTex = LoadTexture("assets/img/gameplay_imgs/pause_button.png"); 
+    moneyIconTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/gameplay_imgs/coin.png");
+    lifeIconTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/gameplay_imgs/heart.png");
+    pauseButtonTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/gameplay_imgs/pause_button.png"); 
 
     gameplayInitialized = true;
 
     TraceLog(LOG_INFO, "Gameplay initialized. First wave created.");
 }
 
+// Mengisi 'spawns' dengan titik awal level dari editor, atau titik awal cadangan (0, 4)
+// untuk peta bawaan yang tidak memiliki titik awal. Mengembalikan jumlah titik awal.
+static int GetLevelSpawnPoints(SpawnPoint spawns[MAX_SPAWN_POINTS]) {
+    int count = GetEditorStartPointCount();
+    const SpawnPoint *editorSpawns = GetEditorStartPoints();
+    for (int i = 0; i < count; i++) spawns[i] = editorSpawns[i];
+    if (count == 0) spawns[count++] = (SpawnPoint){0, 4};
+    return count;
+}
+
+static void OnWaveSpawn(void *target, int arg);
+static void OnNextWave(void *target, int arg);
+
+// Mengirimkan jeda (dalam tick) sebelum musuh berikutnya dari 'wave' di-spawn.
+static int NextSpawnDelayTicks(const EnemyWave *wave) {
+    return Scheduler_SecondsToTicks(wave->spawnTable[wave->nextSpawnIndex].delay);
+}
+
+// Handler event scheduler: hitung mundur 'target' selesai dan wave mulai men-spawn musuh.
+// Event yang sudah usang (wave sudah aktif, atau timer digeser mundur) diabaikan.
+static void OnWaveActivate(void *target, int arg) {
+    (void)arg;
+    EnemyWave *wave = (EnemyWave *)target;
+    if (GetWaveActive(wave) || Scheduler_GetTick() < wave->activationTick) return;
+
+    SetWaveTimerVisible(wave, false);
+    SetWaveActive(wave, true);
+    wave->lastWaveSpawnTime = GetTime();
+    TraceLog(LOG_INFO, "[W%d (num %d)] Timer finished. Wave ACTIVATED (enemies will spawn)! Last wave spawn time: %.2f",
+             wave->waveNum, currentWaveNum, wave->lastWaveSpawnTime);
+
+    if (!nextWavePending) {
+        nextWavePending = Scheduler_Schedule(Scheduler_SecondsToTicks(WAVE_INTERVAL), OnNextWave, NULL, 0);
+    }
+    if (wave->enemiesToSpawnInThisWave > 0) {
+        Scheduler_Schedule(NextSpawnDelayTicks(wave), OnWaveSpawn, wave, 0);
+    }
+}
+
+// Handler event scheduler: men-spawn musuh berikutnya dari tabel spawn 'target' lalu menjadwalkan
+// spawn selanjutnya sesuai jeda di tabel sampai semua musuh wave sudah di-spawn. Jika semua slot
+// musuh penuh, musuh yang sama dicoba lagi satu jeda (minimal satu tick) kemudian.
+static void OnWaveSpawn(void *target, int arg) {
+    (void)arg;
+    EnemyWave *wave = (EnemyWave *)target;
+    if (wave->nextSpawnIndex >= wave->enemiesToSpawnInThisWave) return;
+    bool spawned = false;
+    if ((wave->routes && wave->routes->routeCount > 0) || FlowField_IsActive()) {
+        Enemy newEnemy = BuildWaveEnemy(wave, wave->nextSpawnIndex);
+        if (SpawnEnemy(&newEnemy)) {
+            wave->spawnedCount++;
+            wave->nextSpawnIndex++;
+            spawned = true;
+        }
+    }
+    if (wave->nextSpawnIndex < wave->enemiesToSpawnInThisWave) {
+        int delay = NextSpawnDelayTicks(wave);
+        if (!spawned && delay < 1) delay = 1;
+        Scheduler_Schedule(delay, OnWaveSpawn, wave, 0);
+    }
+}
+
+// I.S. : 'wave' baru dibuat oleh CreateWave.
+// F.S. : 'wave' masuk ke daftar gelombang aktif dan aktivasinya dijadwalkan pada akhir hitung mundur.
+static void StartWave(EnemyWave *wave) {
+    activeWaves[activeWavesCount++] = wave;
+    Scheduler_Schedule(wave->activationTick - Scheduler_GetTick(), OnWaveActivate, wave, 0);
+}
+
+// Handler event scheduler: WAVE_INTERVAL setelah sebuah wave aktif, gelombang berikutnya dibuat
+// atau permainan diakhiri jika semua gelombang peta kustom sudah selesai.
+static void OnNextWave(void *target, int arg) {
+    (void)target;
+    (void)arg;
+    nextWavePending = false;
+
+    bool isCustomGame = (selectedCustomMapIndex != -1) || (strcmp(GetEditorMapFileName(), "maps/map.txt") != 0);
+    if (!isCustomGame || (isCustomGame && currentWaveNum < customWaveCount)) {
+        if (activeWavesCount < MAX_ACTIVE_WAVES) {
+            currentWaveNum++;
+            TraceLog(LOG_INFO, "WAVE_INTERVAL finished. Creating Wave %d.", currentWaveNum);
+
+            SpawnPoint spawns[MAX_SPAWN_POINTS];
+            int spawnCount = GetLevelSpawnPoints(spawns);
+            EnemyWave* nextWave = CreateWave(spawns, spawnCount);
+            if (nextWave) StartWave(nextWave);
+        }
+    }
+    if (isCustomGame && currentWaveNum >= customWaveCount && activeWavesCount == 0 && totalActiveEnemiesCount == 0) {
+        TraceLog(LOG_INFO, "All custom waves completed! Triggering LEVEL_COMPLETE state.");
+        currentGameState = LEVEL_COMPLETE;
+    }
+}
+
 // I.S. : Permainan mungkin sedang berjalan atau belum dimulai.
 // F.S. : Semua state (uang, nyawa, tower, musuh) di-reset ke kondisi awal,
 // dan permainan dimulai pada state GAMEPLAY.
@@ -66,6 +167,8 @@ void RestartGameplay(void) {
     InitGameplay();
 
     // Bersihkan semua gelombang yang mungkin masih aktif atau ada di antrian
+    Scheduler_Reset();
+    InitShots();
     for (int i = 0; i < activeWavesCount; ++i) {
         FreeWave(&activeWaves[i]);
     }
@@ -80,12 +183,7 @@ void RestartGameplay(void) {
     }
     towersListHead = NULL; 
     
-    if (allActiveEnemies != NULL) {
-        for (int i = 0; i < maxTotalActiveEnemies; i++) {
-            allActiveEnemies[i].active = false; 
-        }
-    }
-    totalActiveEnemiesCount = 0;
+    Enemies_DeactivateAll();
 
     HideTowerSelectionUI();
     ResetUpgradeOrbit();
@@ -94,20 +192,22 @@ void RestartGameplay(void) {
     SetLife(10);
 
     currentWaveNum = 1;
-    timeToNextWave = -1.0f;
+    nextWavePending = false;
     maxWavesForCurrentLevel = -1;
 
     //Menentukan peta yang akan digunakan setelah restart
+    bool useFlowField = false;
+    bool useMaze = false;
+    const WaveScript *waveScript = NULL;
     if (selectedCustomMapIndex != -1) {
         TraceLog(LOG_ERROR, "DEBUG_TRACE (Restart): Mengambil jalur 'Custom Map'.");
         const char* mapToLoad = customMaps[selectedCustomMapIndex].filePath;
         if (LoadLevelFromFile(mapToLoad)) {
-            for (int r = 0; r < MAP_ROWS; r++) {
-                for (int c = 0; c < MAP_COLS; c++) {
-                    SetMapTile(r, c, GetEditorMapTile(r, c));
-                }
-            }
+            LoadGameMapFromGrid(GetEditorMap());
             maxWavesForCurrentLevel = GetEditorWaveCount();
+            waveScript = GetEditorWaveScript();
+            useFlowField = GetEditorFlowFieldMode();
+            useMaze = GetEditorMazeMode();
             StrCopySafe(currentMapName, GetFileNameWithoutExt(mapToLoad), sizeof(currentMapName));
             TraceLog(LOG_INFO, "RestartGameplay: Loaded Custom Map '%s'", currentMapName);
         } else {
@@ -118,12 +218,11 @@ void RestartGameplay(void) {
     } else {
         const char* editorFile = GetEditorMapFileName();
         if (editorFile && strcmp(editorFile, "maps/map.txt") != 0) {
-            for (int r = 0; r < MAP_ROWS; r++) {
-                for (int c = 0; c < MAP_COLS; c++) {
-                    SetMapTile(r, c, GetEditorMapTile(r, c));
-                }
-            }
+            LoadGameMapFromGrid(GetEditorMap());
             maxWavesForCurrentLevel = GetEditorWaveCount();
+            waveScript = GetEditorWaveScript();
+            useFlowField = GetEditorFlowFieldMode();
+            useMaze = GetEditorMazeMode();
             StrCopySafe(currentMapName, GetFileNameWithoutExt(editorFile), sizeof(currentMapName));
         } else {
             ResetMapToDefault();
@@ -131,23 +230,35 @@ void RestartGameplay(void) {
         }
     }
     TraceLog(LOG_INFO, "RestartGameplay: Map name set to '%s'", currentMapName);
+    ResetGameCamera();
+
+    // Komposisi semua wave dikompilasi sekali di sini; selama permainan wave hanya membaca tabelnya.
+    if (!WaveScript_Compile(waveScript, maxWavesForCurrentLevel > 0 ? maxWavesForCurrentLevel : WAVE_SCRIPT_ENDLESS_WAVES)) {
+        Push(&statusStack, "Error: Failed to build the wave table!");
+        TraceLog(LOG_ERROR, "GAMEPLAY: Failed to start. Wave table could not be compiled.");
+        currentGameState = MAIN_MENU;
+        return;
+    }
     
-    int startRow = GetEditorStartRow();
-    int startCol = GetEditorStartCol();
-    if (startRow == -1 || startCol == -1) { startRow = 0; startCol = 4; } 
+    SpawnPoint spawns[MAX_SPAWN_POINTS];
+    int spawnCount = GetLevelSpawnPoints(spawns);
+    // Mode labirin selalu memakai flow field karena rute musuh berubah setiap tower dipasang di jalan.
+    Maze_Configure(useFlowField && useMaze, spawns, spawnCount);
     
+    // Semua rute dienumerasi sekali per peta; semua wave berikutnya memakai tabel rute yang sama dari cache.
+    // Peta bermode flow field memakai satu medan jarak bersama yang diperbarui saat tower dipasang atau dijual.
+    bool pathReady = useFlowField ? FlowField_Build(spawns, spawnCount) : PathCache_Prepare(spawns, spawnCount) > 0;
+    if (!pathReady) {
+        Push(&statusStack, "Error: Map has no valid path from start point!"); 
+        TraceLog(LOG_ERROR, "GAMEPLAY: Failed to start. Map has no valid path.");
+        currentGameState = MAIN_MENU; 
+        return;               
+    }
+
     // Membuat objek gelombang musuh pertama dan menambahkannya ke daftar gelombang aktif.
-    EnemyWave* firstWave = CreateWave(startRow, startCol);
+    EnemyWave* firstWave = CreateWave(spawns, spawnCount);
     if (firstWave) {
-
-        if (firstWave->pathCount == 0) {
-            Push(&statusStack, "Error: Map has no valid path from start point!"); 
-            TraceLog(LOG_ERROR, "GAMEPLAY: Failed to start. Map has no valid path.");
-            FreeWave(&firstWave);     
-            currentGameState = MAIN_MENU; 
-            return;               
-        }
-        activeWaves[activeWavesCount++] = firstWave;
+        StartWave(firstWave);
     }
     
     currentGameState = GAMEPLAY;
@@ -162,79 +273,25 @@ void UpdateGameplay(float deltaTime) {
     if (!gameplayInitialized) InitGameplay();
     if (currentGameState == MAIN_MENU) return;
     
-    float screenWidth = (float)VIRTUAL_WIDTH;
-    float screenHeight = (float)VIRTUAL_HEIGHT;
-    float baseMapWidth = MAP_COLS * TILE_SIZE;
-    float baseMapHeight = MAP_ROWS * TILE_SIZE;
-    currentTileScale = fmin((float)VIRTUAL_WIDTH / baseMapWidth, (float)VIRTUAL_HEIGHT / baseMapHeight);
-    mapScreenOffsetX = (screenWidth - baseMapWidth * currentTileScale) / 2.0f;
-    mapScreenOffsetY = (screenHeight - baseMapHeight * currentTileScale) / 2.0f;
+    UpdateGameCamera(deltaTime);
+    ApplyGameCamera(&currentTileScale, &mapScreenOffsetX, &mapScreenOffsetY);
+    PROFILE_BEGIN(PROF_UPDATE_STATUS);
     UpdateStatus(&statusStack, deltaTime);
+    PROFILE_END(PROF_UPDATE_STATUS);
     
-    // Memperbarui timer gelombang memicu spawning musuh jika gelombang aktif dan siap.
-    for (int i = 0; i < activeWavesCount; i++) {
-        EnemyWave* wave = activeWaves[i];
-        if (!wave) continue;
-        bool waveJustActivated = UpdateWaveTimer(wave, deltaTime);
-        if (waveJustActivated) {
-            if(timeToNextWave < 0) {
-                timeToNextWave = WAVE_INTERVAL;
-            }
-        }
-        if (wave->active && wave->nextSpawnIndex < wave->enemiesToSpawnInThisWave) {
-            wave->spawnTimer += deltaTime;
-            if (wave->spawnTimer >= SPAWN_DELAY) {
-                wave->spawnTimer = 0.0f;
-                Enemy newEnemy;
-                if (!IsEnemyQueueEmpty(&wave->enemyQueue)) {
-                    DequeueEnemy(&wave->enemyQueue, &newEnemy);
-                    int slot = -1;
-                    for(int k=0; k<maxTotalActiveEnemies; ++k) { if(!allActiveEnemies[k].active) { slot = k; break; } }
-                    if(slot != -1) {
-                        allActiveEnemies[slot] = newEnemy;
-                        allActiveEnemies[slot].active = true;
-                        allActiveEnemies[slot].spawned = true;
-                        allActiveEnemies[slot].position = wave->path[0];
-                        totalActiveEnemiesCount++;
-                        wave->spawnedCount++;
-                    } else {
-                        EnqueueEnemy(&wave->enemyQueue, newEnemy);
-                    }
-                }
-                wave->nextSpawnIndex++;
-            }
-        }
-    }
+    // Menjalankan event yang jatuh tempo: aktivasi gelombang, spawn musuh, gelombang berikutnya,
+    // berakhirnya stun, dan berakhirnya pesan status.
+    Scheduler_Advance(deltaTime);
+    PROFILE_BEGIN(PROF_ENEMIES_UPDATE);
     Enemies_Update(deltaTime);
+    PROFILE_END(PROF_ENEMIES_UPDATE);
+    PROFILE_BEGIN(PROF_TOWER_ATTACKS);
     UpdateTowerAttacks(NULL, deltaTime);
+    PROFILE_END(PROF_TOWER_ATTACKS);
+    PROFILE_BEGIN(PROF_UPDATE_SHOTS);
     UpdateShots(deltaTime);
+    PROFILE_END(PROF_UPDATE_SHOTS);
 
-    //Menangani hitung mundur antar gelombang dan memicu gelombang berikutnya atau 
-    //mengakhiri permainan jika semua gelombang selesai atau nyawa pemain habis
-    if (timeToNextWave > 0) {
-        timeToNextWave -= deltaTime;
-        if (timeToNextWave <= 0) {
-        
-            bool isCustomGame = (selectedCustomMapIndex != -1) || (strcmp(GetEditorMapFileName(), "maps/map.txt") != 0);
-            if (!isCustomGame || (isCustomGame && currentWaveNum < customWaveCount)) {
-                if (activeWavesCount < MAX_ACTIVE_WAVES) {
-                    currentWaveNum++;
-                    TraceLog(LOG_INFO, "WAVE_INTERVAL finished. Creating Wave %d.", currentWaveNum);
-                    
-                    int startRow = GetEditorStartRow();
-                    int startCol = GetEditorStartCol();
-                    if (startRow == -1 || startCol == -1) { startRow = 0; startCol = 4; }
-                    EnemyWave* nextWave = CreateWave(startRow, startCol);
-                    if (nextWave) activeWaves[activeWavesCount++] = nextWave;
-                }
-            } 
-            if (isCustomGame && currentWaveNum >= customWaveCount && activeWavesCount == 0 && totalActiveEnemiesCount == 0) {
-                TraceLog(LOG_INFO, "All custom waves completed! Triggering LEVEL_COMPLETE state.");
-                currentGameState = LEVEL_COMPLETE;
-            }
-            timeToNextWave = -1.0f;
-        }
-    }
     for (int i = activeWavesCount - 1; i >= 0; i--) {
         if (AllEnemiesInWaveFinished(activeWaves[i])) {
             FreeWave(&activeWaves[i]);
@@ -277,6 +334,7 @@ void HandleGameplayInput(Vector2 mousePos)
                 if (CheckCollisionPointRec(mousePos, timerAreaRect)) {
                     
                     SetWaveTimerCurrentTime(wave, GetWaveTimerDuration(wave));
+                    Scheduler_Schedule(0, OnWaveActivate, wave, 0);
                     Push(&statusStack, "Wave accelerated!");
                     PlayBattleMusic();
                     return; 
@@ -335,7 +393,7 @@ void HandleGameplayInput(Vector2 mousePos)
         if (!clickHandled) {
             int col = (int)((mousePos.x - mapScreenOffsetX) / (TILE_SIZE * currentTileScale));
             int row = (int)((mousePos.y - mapScreenOffsetY) / (TILE_SIZE * currentTileScale));
-            if (row >= 0 && row < MAP_ROWS && col >= 0 && col < MAP_COLS && GetMapTile(row, col) == 4 && GetTowerAtMapCoord(row, col) == NULL) {
+            if (IsInsideGrid(&gameMap, row, col) && Maze_IsBuildableTile(GetMapTile(row, col)) && GetTowerAtMapCoord(row, col) == NULL) {
                 PlaceTower(row, col, TOWER_TYPE_1);
             }
         }
@@ -462,18 +520,26 @@ void DrawHUD(const char* mapName, int money, int life, Vector2 mousePos) {
 // F.S. : Peta, musuh, tower, proyektil, dan HUD telah digambar.
 void DrawGameplay(void) {
     if (!gameplayInitialized) return;
+    PROFILE_BEGIN(PROF_DRAW_MAP);
     DrawMap(currentTileScale, mapScreenOffsetX, mapScreenOffsetY);
+    PROFILE_END(PROF_DRAW_MAP);
     if (totalActiveEnemiesCount > 0)
     {
+        PROFILE_BEGIN(PROF_ENEMIES_DRAW);
         Enemies_Draw(currentTileScale, mapScreenOffsetX, mapScreenOffsetY);
+        PROFILE_END(PROF_ENEMIES_DRAW);
     }
+    PROFILE_BEGIN(PROF_DRAW_TOWERS);
     DrawTowers(currentTileScale, mapScreenOffsetX, mapScreenOffsetY);
+    PROFILE_END(PROF_DRAW_TOWERS);
     DrawUpgradeOrbitMenu(currentTileScale, mapScreenOffsetX, mapScreenOffsetY);
     for (int i = 0; i < activeWavesCount; i++) {
         EnemyWave* wave = activeWaves[i];
         DrawGameTimer(wave, currentTileScale, mapScreenOffsetX, mapScreenOffsetY, GetTimerMapRow(wave), GetTimerMapCol(wave));
     }
+    PROFILE_BEGIN(PROF_DRAW_SHOTS);
     DrawShots(currentTileScale, mapScreenOffsetX, mapScreenOffsetY); 
+    PROFILE_END(PROF_DRAW_SHOTS);
     DrawHUD(currentMapName, GetMoney(), GetLife(), GetMousePosition());
     DrawStatus(statusStack);
 }
@@ -487,22 +553,31 @@ float GetMapScreenOffsetX(void) { return mapScreenOffsetX; }
 //Mengirimkan nilai offset Y layar peta saat ini.
 float GetMapScreenOffsetY(void) { return mapScreenOffsetY; }
 
+//Mengirimkan jumlah gelombang yang sedang aktif (sedang hitung mundur atau masih memiliki musuh).
+int GetActiveWaveCount(void) { return activeWavesCount; }
+
 // I.S. : Aset-aset gameplay sedang berada di memori.
 // F.S. : Semua aset gameplay telah dibebaskan dari memori.
 void UnloadGameplay(){
+    Scheduler_Shutdown();
     FreeWave(&currentWave);
     Enemies_ShutdownAssets();
     ShutdownTowerAssets();
     ShutdownShots();
     ShutdownMapAssets();
     FreeUpgradeTree(&tower1UpgradeTree); 
-    UnloadTexture(moneyIconTex);
-    UnloadTexture(lifeIconTex); 
-    UnloadTexture(pauseButtonTex);
+    UnloadTextureSafe(&moneyIconTex);
+    UnloadTextureSafe(&lifeIconTex); 
+    UnloadTextureSafe(&pauseButtonTex);
     for (int i = 0; i < activeWavesCount; ++i) {
         FreeWave(&activeWaves[i]);
     }
     activeWavesCount = 0;
+    PathCache_Clear();
+    FlowField_Clear();
+    Maze_Clear();
+    WaveScript_Clear();
     gameplayInitialized = false;
     TraceLog(LOG_INFO, "GAMEPLAY: Shutdown complete.");
+    Memory_LogReport("UnloadGameplay");
 }
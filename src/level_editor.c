@@ -16,47 +16,62 @@
 #include "main_menu.h"
 #include "transition.h"
 #include "audio.h"
+#include "path_validator.h"
 
 int customWaveCount = 0; 
 bool editorInitialized = false;
-LevelEditorState editorState = {.startRow = -1, .startCol = -1, .waveCount = 1}; 
+LevelEditorState editorState = {.startPointCount = 0, .waveCount = 1}; 
+static bool pathValidationActive = false;     // Validator hanya hidup selama editor terbuka
 
-/* I.S. : State level editor belum terinisialisasi.
-   F.S. : Seluruh state editor, termasuk salinan peta, tool yang dipilih, dan aset UI,
-          telah diinisialisasi dan siap digunakan. */
-void InitializeLevelEditor(const int current_game_map[MAP_ROWS][MAP_COLS])
+/* I.S. : Peta, titik awal, atau mode pergerakan editor baru saja berubah.
+   F.S. : Jika editor terbuka, validator rute dibangun ulang untuk state editor saat ini. */
+static void RefreshEditorPathValidation(void)
 {
+    if (!pathValidationActive) return;
+    PathValidator_Rebuild(&editorState.map, editorState.startPoints, editorState.startPointCount, editorState.flowFieldMode);
+}
 
-    memcpy(editorState.map, current_game_map, sizeof(int) * MAP_ROWS * MAP_COLS);
-    memcpy(editorState.baseGameMap, current_game_map, sizeof(int) * MAP_ROWS * MAP_COLS);
-
-    for (int row = 0; row < MAP_ROWS; row++)
+/* I.S. : State level editor belum terinisialisasi.
+   F.S. : Seluruh state editor, termasuk peta kosong seukuran 'currentGameMap', tool yang
+          dipilih, dan aset UI, telah diinisialisasi dan siap digunakan. Jika peta seukuran itu
+          gagal dibuat, editor memakai ukuran bawaan DEFAULT_MAP_ROWS x DEFAULT_MAP_COLS. */
+void InitializeLevelEditor(const TileGrid *currentGameMap)
+{
+    int rows = currentGameMap->rows > 0 ? currentGameMap->rows : DEFAULT_MAP_ROWS;
+    int cols = currentGameMap->cols > 0 ? currentGameMap->cols : DEFAULT_MAP_COLS;
+    if (!CreateTileGrid(&editorState.map, rows, cols))
     {
-        for (int col = 0; col < MAP_COLS; col++)
+        TraceLog(LOG_WARNING, "InitializeLevelEditor: Failed to create %d x %d editor map, falling back to %d x %d.",
+                 rows, cols, DEFAULT_MAP_ROWS, DEFAULT_MAP_COLS);
+        if (!CreateTileGrid(&editorState.map, DEFAULT_MAP_ROWS, DEFAULT_MAP_COLS))
         {
-            editorState.map[row][col] = 0;
+            TraceLog(LOG_ERROR, "InitializeLevelEditor: Failed to create default editor map; the editor map stays as it was.");
         }
     }
 
-    editorState.pathButtonTex = LoadTextureSafe("assets/img/level_editor_imgs/path_tool.png");
-    editorState.towerButtonTex = LoadTextureSafe("assets/img/level_editor_imgs/tower_tool.png");
-    editorState.waveButtonTex = LoadTextureSafe("assets/img/level_editor_imgs/waves_tool.png");
-    editorState.startPointButtonTex = LoadTextureSafe("assets/img/level_editor_imgs/start_tool.png"); 
-    editorState.minusButtonTex = LoadTextureSafe("assets/img/level_editor_imgs/minus_button.png");
-    editorState.plusButtonTex = LoadTextureSafe("assets/img/level_editor_imgs/plus_button.png");
-    editorState.okButtonTex = LoadTextureSafe("assets/img/level_editor_imgs/ok_button.png");
-    editorState.saveButtonTex = LoadTextureSafe("assets/img/level_editor_imgs/save_button.png");
+    editorState.pathButtonTex = LoadTextureSafe(MEM_TAG_EDITOR, "assets/img/level_editor_imgs/path_tool.png");
+    editorState.towerButtonTex = LoadTextureSafe(MEM_TAG_EDITOR, "assets/img/level_editor_imgs/tower_tool.png");
+    editorState.waveButtonTex = LoadTextureSafe(MEM_TAG_EDITOR, "assets/img/level_editor_imgs/waves_tool.png");
+    editorState.startPointButtonTex = LoadTextureSafe(MEM_TAG_EDITOR, "assets/img/level_editor_imgs/start_tool.png"); 
+    editorState.minusButtonTex = LoadTextureSafe(MEM_TAG_EDITOR, "assets/img/level_editor_imgs/minus_button.png");
+    editorState.plusButtonTex = LoadTextureSafe(MEM_TAG_EDITOR, "assets/img/level_editor_imgs/plus_button.png");
+    editorState.okButtonTex = LoadTextureSafe(MEM_TAG_EDITOR, "assets/img/level_editor_imgs/ok_button.png");
+    editorState.saveButtonTex = LoadTextureSafe(MEM_TAG_EDITOR, "assets/img/level_editor_imgs/save_button.png");
 
     editorState.selectedTool = TOOL_PATH;
     editorState.wavePanelActive = false;
-    editorState.startRow = -1; 
-    editorState.startCol = -1; 
+    editorState.startPointCount = 0;
     editorState.waveCount = 1;
+    WaveScript_Init(&editorState.waveScript);
+    editorState.flowFieldMode = false;
+    editorState.mazeMode = false;
     editorState.isDraggingPath = false;
     editorState.requestSaveAndPlay = false;
     StrCopySafe(editorState.mapFileName, "maps/map.txt", sizeof(editorState.mapFileName));
     editorState.textInputBuffer[0] = '\0';
     editorState.letterCount = 0;
+    pathValidationActive = true;
+    RefreshEditorPathValidation();
     TraceLog(LOG_INFO, "Level editor initialized.");
 }
 
@@ -73,6 +88,8 @@ void UnloadLevelEditor()
     UnloadTextureSafe(&editorState.plusButtonTex);
     UnloadTextureSafe(&editorState.okButtonTex);
     UnloadTextureSafe(&editorState.saveButtonTex);
+    pathValidationActive = false;
+    PathValidator_Free();
     TraceLog(LOG_INFO, "Level editor unloaded.");
 }
 
@@ -86,8 +103,8 @@ void HandleLevelEditorInput(float globalScale, float offsetX, float offsetY)
     float screenHeight = (float)VIRTUAL_HEIGHT;
     float availableWidth = screenWidth * (1.0f - 2 * EDITOR_VIEW_PADDING_SIDE_FACTOR);
     float availableHeight = screenHeight * (1.0f - EDITOR_VIEW_PADDING_TOP_FACTOR - EDITOR_VIEW_PADDING_BOTTOM_FACTOR);
-    float baseMapWidth = MAP_COLS * TILE_SIZE;
-    float baseMapHeight = MAP_ROWS * TILE_SIZE;
+    float baseMapWidth = editorState.map.cols * TILE_SIZE;
+    float baseMapHeight = editorState.map.rows * TILE_SIZE;
     float editorMapScale = fmin(availableWidth / baseMapWidth, availableHeight / baseMapHeight);
     float editorMapDisplayWidth = baseMapWidth * editorMapScale;
     float editorMapDisplayHeight = baseMapHeight * editorMapScale;
@@ -137,6 +154,19 @@ void HandleLevelEditorInput(float globalScale, float offsetX, float offsetY)
         saveButtonDrawWidth,
         saveButtonDrawHeight};
 
+    // Tombol F mengganti mode pergerakan musuh antara rute tetap dan flow field (peta labirin).
+    if (IsKeyPressed(KEY_F) && !editorState.wavePanelActive)
+    {
+        SetEditorFlowFieldMode(!editorState.flowFieldMode);
+        TraceLog(LOG_INFO, "Editor: Enemy movement set to %s.", editorState.flowFieldMode ? "flow field" : "fixed routes");
+    }
+    // Tombol M mengganti mode labirin: tower boleh dipasang di tile jalan (selalu memakai flow field).
+    if (IsKeyPressed(KEY_M) && !editorState.wavePanelActive)
+    {
+        SetEditorMazeMode(!editorState.mazeMode);
+        TraceLog(LOG_INFO, "Editor: Maze mode %s.", editorState.mazeMode ? "enabled" : "disabled");
+    }
+
     if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
     {
 
@@ -167,7 +197,8 @@ void HandleLevelEditorInput(float globalScale, float offsetX, float offsetY)
             }
             else if (CheckCollisionPointRec(mousePos, plusButtonRect))
             {
-                editorState.waveCount++;
+                if (editorState.waveCount < WAVE_SCRIPT_MAX_WAVES)
+                    editorState.waveCount++;
                 return;
             }
 
@@ -219,7 +250,7 @@ void HandleLevelEditorInput(float globalScale, float offsetX, float offsetY)
         int col = (int)((mousePos.x - editorMapOffsetX) / tileScreenSize);
         int row = (int)((mousePos.y - editorMapOffsetY) / tileScreenSize);
 
-        if (row >= 0 && row < MAP_ROWS && col >= 0 && col < MAP_COLS)
+        if (IsInsideGrid(&editorState.map, row, col))
         {
             int currentTileValue = GetEditorMapTile(row, col);
 
@@ -247,12 +278,22 @@ void HandleLevelEditorInput(float globalScale, float offsetX, float offsetY)
             }
             else if (editorState.selectedTool == TOOL_START_POINT)
             { 
-                if (row == 0 || row == MAP_ROWS - 1 || col == 0 || col == MAP_COLS - 1)
+                if (row == 0 || row == editorState.map.rows - 1 || col == 0 || col == editorState.map.cols - 1)
                 {
-                    SetEditorMapTile(row, col, 1);
-                    editorState.startRow = row;
-                    editorState.startCol = col;
-                    TraceLog(LOG_INFO, "Editor: Start point set at (%d, %d).", row, col);
+                    // Klik pada titik awal yang sudah ada menghapusnya; klik di tempat lain menambah titik awal baru.
+                    if (RemoveEditorStartPoint(row, col))
+                    {
+                        TraceLog(LOG_INFO, "Editor: Start point removed at (%d, %d).", row, col);
+                    }
+                    else if (AddEditorStartPoint(row, col))
+                    {
+                        SetEditorMapTile(row, col, 1);
+                        TraceLog(LOG_INFO, "Editor: Start point added at (%d, %d).", row, col);
+                    }
+                    else
+                    {
+                        TraceLog(LOG_WARNING, "Editor: A map can have at most %d start points.", MAX_SPAWN_POINTS);
+                    }
                 }
                 else
                 {
@@ -267,7 +308,7 @@ void HandleLevelEditorInput(float globalScale, float offsetX, float offsetY)
     {
         int col = (int)((mousePos.x - editorMapOffsetX) / tileScreenSize);
         int row = (int)((mousePos.y - editorMapOffsetY) / tileScreenSize);
-        if (row >= 0 && row < MAP_ROWS && col >= 0 && col < MAP_COLS)
+        if (IsInsideGrid(&editorState.map, row, col))
         {
             int targetTileValue = GetEditorMapTile(row, col);
             if (targetTileValue != 4 && targetTileValue != 5 && targetTileValue != 6)
@@ -291,8 +332,8 @@ void DrawLevelEditor(float globalScale, float offsetX, float offsetY)
     float screenHeight = (float)VIRTUAL_HEIGHT;
     float availableWidth = screenWidth * (1.0f - 2 * EDITOR_VIEW_PADDING_SIDE_FACTOR);
     float availableHeight = screenHeight * (1.0f - EDITOR_VIEW_PADDING_TOP_FACTOR - EDITOR_VIEW_PADDING_BOTTOM_FACTOR);
-    float baseMapWidth = MAP_COLS * TILE_SIZE;
-    float baseMapHeight = MAP_ROWS * TILE_SIZE;
+    float baseMapWidth = editorState.map.cols * TILE_SIZE;
+    float baseMapHeight = editorState.map.rows * TILE_SIZE;
     float editorMapScale = fmin(availableWidth / baseMapWidth, availableHeight / baseMapHeight);
     float editorMapDisplayWidth = baseMapWidth * editorMapScale;
     float editorMapDisplayHeight = baseMapHeight * editorMapScale;
@@ -300,11 +341,11 @@ void DrawLevelEditor(float globalScale, float offsetX, float offsetY)
     float editorMapOffsetY = screenHeight * EDITOR_VIEW_PADDING_TOP_FACTOR + (availableHeight - editorMapDisplayHeight) / 2.0f;
     float tileScreenSize = TILE_SIZE * editorMapScale;
 
-    for (int r = 0; r < MAP_ROWS; r++)
+    for (int r = 0; r < editorState.map.rows; r++)
     {
-        for (int c = 0; c < MAP_COLS; c++)
+        for (int c = 0; c < editorState.map.cols; c++)
         {
-            int tileIndex = editorState.map[r][c];
+            int tileIndex = GRID_AT(&editorState.map, r, c);
             Rectangle sourceRect = GetTileSourceRect(tileIndex);
             Rectangle destRect = {
                 editorMapOffsetX + c * tileScreenSize,
@@ -329,12 +370,35 @@ void DrawLevelEditor(float globalScale, float offsetX, float offsetY)
         }
     }
 
-    if (editorState.startRow != -1 && editorState.startCol != -1)
+    for (int i = 0; i < editorState.startPointCount; i++)
     { 
-        Rectangle startMarkerRect = {editorMapOffsetX + editorState.startCol * tileScreenSize, editorMapOffsetY + editorState.startRow * tileScreenSize, tileScreenSize, tileScreenSize};
+        const SpawnPoint *start = &editorState.startPoints[i];
+        Rectangle startMarkerRect = {editorMapOffsetX + start->col * tileScreenSize, editorMapOffsetY + start->row * tileScreenSize, tileScreenSize, tileScreenSize};
         DrawRectangleLinesEx(startMarkerRect, 4, GREEN);
     }
 
+    // Rute terpendek setiap titik awal ke exit, mengikuti validator yang diperbarui setiap tile berubah.
+    static int routeTiles[MAX_MAP_ROWS * MAX_MAP_COLS];
+    for (int i = 0; i < editorState.startPointCount; i++)
+    {
+        int routeLength = PathValidator_GetRoute(i, routeTiles, MAX_MAP_ROWS * MAX_MAP_COLS);
+        for (int t = 0; t + 1 < routeLength; t++)
+        {
+            Vector2 from = {editorMapOffsetX + (routeTiles[t] % editorState.map.cols + 0.5f) * tileScreenSize,
+                            editorMapOffsetY + (routeTiles[t] / editorState.map.cols + 0.5f) * tileScreenSize};
+            Vector2 to = {editorMapOffsetX + (routeTiles[t + 1] % editorState.map.cols + 0.5f) * tileScreenSize,
+                          editorMapOffsetY + (routeTiles[t + 1] / editorState.map.cols + 0.5f) * tileScreenSize};
+            DrawLineEx(from, to, 3.0f, Fade(YELLOW, 0.8f));
+        }
+    }
+
+    const char *movementText = editorState.mazeMode ? "Movement: maze [F/M]" :
+                               (editorState.flowFieldMode ? "Movement: flow field [F/M]" : "Movement: fixed routes [F/M]");
+    DrawText(movementText, (int)editorMapOffsetX, (int)(editorMapOffsetY - 30.0f), 20, RAYWHITE);
+    bool routeValid = PathValidator_IsValid();
+    const char *routeText = routeValid ? "Route: OK" : (editorState.startPointCount > 0 ? "Route: blocked" : "Route: no start point");
+    DrawText(routeText, (int)editorMapOffsetX + MeasureText(movementText, 20) + 30, (int)(editorMapOffsetY - 30.0f), 20, routeValid ? GREEN : RED);
+
     
     
     float buttonWidth = TILE_SIZE * editorMapScale * EDITOR_BUTTON_WIDTH_FACTOR;
@@ -437,7 +501,7 @@ void UpdateEditor(void) {
     if (!editorInitialized)
     {
         PlayTransitionAnimation(LEVEL_EDITOR);
-        InitializeLevelEditor(gameMap);
+        InitializeLevelEditor(&gameMap);
         editorInitialized = true;
         TraceLog(LOG_INFO, "Level editor initialized after transition.");
     }
@@ -504,7 +568,12 @@ void UpdateSaveMapEditor(){
 
                 SaveLevelToFile(finalPath);
                 SetEditorMapFileName(finalPath);
-                SetEditorRequestSaveAndPlay(true);
+                // Peta tanpa rute ke exit tetap disimpan sebagai draf, tetapi tidak langsung dimainkan.
+                if (PathValidator_IsValid()) {
+                    SetEditorRequestSaveAndPlay(true);
+                } else {
+                    TraceLog(LOG_WARNING, "Editor: Saved %s without playing; not every start point reaches an exit.", finalPath);
+                }
                 currentGameState = LEVEL_EDITOR; 
             }
         } else if (CheckCollisionPointRec(mousePos, cancelBtnRect)) {
@@ -524,6 +593,9 @@ void DrawSaveMapEditor(){
     DrawRectangleRec((Rectangle){panelX, panelY, panelWidth, panelHeight}, RAYWHITE);
     DrawRectangleLinesEx((Rectangle){panelX, panelY, panelWidth, panelHeight}, 2, BLACK);
     DrawText("Save Map As...", panelX + 20, panelY + 20, 20, BLACK);
+    if (!PathValidator_IsValid()) {
+        DrawText("Route blocked: map will be saved but not played.", panelX + 20, panelY + 45, 10, MAROON);
+    }
 
     Rectangle textBoxRect = { panelX + 20, panelY + 60, panelWidth - 40, 40 };
     DrawRectangleRec(textBoxRect, LIGHTGRAY);
@@ -552,24 +624,32 @@ bool GetEditorRequestSaveAndPlay() { return editorState.requestSaveAndPlay; }
 /* Mengirimkan ID tile pada posisi (row, col) dari peta yang ada di editor. */
 int GetEditorMapTile(int row, int col)
 {
-    if (row >= 0 && row < MAP_ROWS && col >= 0 && col < MAP_COLS)
-    {
-        return editorState.map[row][col];
-    }
-    return 0;
+    return GetGridTile(&editorState.map, row, col);
 }
 
+/* Mengirimkan pointer ke grid peta yang ada di editor (beserta ukurannya). */
+const TileGrid *GetEditorMap(void) { return &editorState.map; }
+
 /* Mengirimkan path file dari peta yang sedang dikerjakan. */
 const char *GetEditorMapFileName() { return editorState.mapFileName; }
 
 /* Mengirimkan jumlah gelombang yang telah diatur di editor. */
 int GetEditorWaveCount() { return editorState.waveCount; }
 
-/* Mengirimkan posisi baris titik awal musuh yang telah diatur. */
-int GetEditorStartRow() { return editorState.startRow; } 
+/* Mengirimkan skrip wave peta di editor (kosong jika peta memakai komposisi bawaan). */
+const WaveScript *GetEditorWaveScript(void) { return &editorState.waveScript; }
+
+/* Mengirimkan array titik awal musuh yang telah diatur (sebanyak GetEditorStartPointCount()). */
+const SpawnPoint *GetEditorStartPoints(void) { return editorState.startPoints; }
+
+/* Mengirimkan jumlah titik awal musuh yang telah diatur. */
+int GetEditorStartPointCount(void) { return editorState.startPointCount; }
+
+/* Mengirimkan true jika peta di editor memakai mode flow field. */
+bool GetEditorFlowFieldMode(void) { return editorState.flowFieldMode; }
 
-/* Mengirimkan posisi kolom titik awal musuh yang telah diatur. */
-int GetEditorStartCol() { return editorState.startCol; } 
+/* Mengirimkan true jika peta di editor memakai mode labirin. */
+bool GetEditorMazeMode(void) { return editorState.mazeMode; }
 
 /* I.S. : Tool yang aktif adalah tool sebelumnya.
    F.S. : State tool yang aktif diubah menjadi 'tool'. */
@@ -584,13 +664,12 @@ void SetEditorWavePanelActive(bool active) { editorState.wavePanelActive = activ
 void SetEditorRequestSaveAndPlay(bool value) { editorState.requestSaveAndPlay = value; }
 
 /* I.S. : Tile di posisi (row, col) pada peta editor memiliki nilai lama.
-   F.S. : Nilai tile di posisi (row, col) diubah menjadi 'value'. */
+   F.S. : Nilai tile di posisi (row, col) diubah menjadi 'value'. Jika editor terbuka, validasi
+          rute diperbaiki secara inkremental untuk tile tersebut. */
 void SetEditorMapTile(int row, int col, int value)
 {
-    if (row >= 0 && row < MAP_ROWS && col >= 0 && col < MAP_COLS)
-    {
-        editorState.map[row][col] = value;
-    }
+    SetGridTile(&editorState.map, row, col, value);
+    if (pathValidationActive) PathValidator_OnTileChanged(row, col);
 }
 
 /* I.S. : State editor menyimpan path file yang lama.
@@ -604,15 +683,71 @@ void SetEditorMapFileName(const char *fileName)
 
 /* I.S. : Jumlah gelombang memiliki nilai lama.
    F.S. : Jumlah gelombang di state editor diatur menjadi 'count' (dengan validasi minimal 1). */
-void SetEditorWaveCount(int count) { editorState.waveCount = count >= 1 ? count : 1; }
+void SetEditorWaveCount(int count) {
+    if (count < 1) count = 1;
+    if (count > WAVE_SCRIPT_MAX_WAVES) count = WAVE_SCRIPT_MAX_WAVES;
+    editorState.waveCount = count;
+}
 
-/* I.S. : Posisi baris titik awal memiliki nilai lama.
-   F.S. : Posisi baris titik awal di state editor diatur menjadi 'row'. */
-void SetEditorStartRow(int row) { editorState.startRow = row; } 
+/* I.S. : Mode pergerakan musuh di editor memiliki nilai lama.
+   F.S. : Peta di editor memakai flow field jika 'enabled' bernilai true, atau rute tetap (dan mode
+          labirin dimatikan) jika false. */
+void SetEditorFlowFieldMode(bool enabled)
+{
+    editorState.flowFieldMode = enabled;
+    if (!enabled) editorState.mazeMode = false;
+    RefreshEditorPathValidation();
+}
 
-/* I.S. : Posisi kolom titik awal memiliki nilai lama.
-   F.S. : Posisi kolom titik awal di state editor diatur menjadi 'col'. */
-void SetEditorStartCol(int col) { editorState.startCol = col; } 
+/* I.S. : Mode labirin di editor memiliki nilai lama.
+   F.S. : Mode labirin diatur menjadi 'enabled'. Mengaktifkan mode labirin juga mengaktifkan flow field. */
+void SetEditorMazeMode(bool enabled)
+{
+    editorState.mazeMode = enabled;
+    if (enabled) SetEditorFlowFieldMode(true);
+}
+
+/* I.S. : State editor berisi titik awal sembarang.
+   F.S. : State editor tidak memiliki titik awal. */
+void ClearEditorStartPoints(void)
+{
+    editorState.startPointCount = 0;
+    RefreshEditorPathValidation();
+}
+
+/* I.S. : State editor berisi titik awal sembarang.
+   F.S. : (row, col) ditambahkan ke daftar titik awal jika belum ada. Mengembalikan false
+          jika daftar sudah berisi MAX_SPAWN_POINTS titik awal. */
+bool AddEditorStartPoint(int row, int col)
+{
+    for (int i = 0; i < editorState.startPointCount; i++)
+    {
+        if (editorState.startPoints[i].row == row && editorState.startPoints[i].col == col) return true;
+    }
+    if (editorState.startPointCount >= MAX_SPAWN_POINTS) return false;
+    editorState.startPoints[editorState.startPointCount++] = (SpawnPoint){row, col};
+    RefreshEditorPathValidation();
+    return true;
+}
+
+/* I.S. : State editor berisi titik awal sembarang.
+   F.S. : (row, col) dihapus dari daftar titik awal. Mengembalikan false jika tidak ada. */
+bool RemoveEditorStartPoint(int row, int col)
+{
+    for (int i = 0; i < editorState.startPointCount; i++)
+    {
+        if (editorState.startPoints[i].row == row && editorState.startPoints[i].col == col)
+        {
+            // Urutan dipertahankan karena titik awal pertama menentukan posisi timer wave.
+            for (int j = i; j < editorState.startPointCount - 1; j++)
+                editorState.startPoints[j] = editorState.startPoints[j + 1];
+            editorState.startPointCount--;
+            RefreshEditorPathValidation();
+            return true;
+        }
+    }
+    return false;
+}
 
 /* I.S. : State editor berisi data peta lama atau kosong.
    F.S. : State editor (peta, wave count, start point) telah diisi dengan data yang dibaca
@@ -632,10 +767,27 @@ bool LoadLevelFromFile(const char *fileName)
         return false;
     }
 
-    
-    for (int r = 0; r < MAP_ROWS; r++) 
+    // Baris pertama opsional "size <rows> <cols>". File lama tidak memilikinya
+    // dan selalu berukuran DEFAULT_MAP_ROWS x DEFAULT_MAP_COLS.
+    int rows = DEFAULT_MAP_ROWS;
+    int cols = DEFAULT_MAP_COLS;
+    char header[256];
+    if (fgets(header, sizeof(header), file) == NULL || sscanf(header, "size %d %d", &rows, &cols) != 2)
+    {
+        rows = DEFAULT_MAP_ROWS;
+        cols = DEFAULT_MAP_COLS;
+        rewind(file);
+    }
+    if (!CreateTileGrid(&editorState.map, rows, cols))
+    {
+        TraceLog(LOG_ERROR, "LoadLevelFromFile: Invalid map size %d x %d in %s.", rows, cols, fileName);
+        fclose(file);
+        return false;
+    }
+
+    for (int r = 0; r < rows; r++) 
     {
-        for (int c = 0; c < MAP_COLS; c++) 
+        for (int c = 0; c < cols; c++) 
         {
             int value;
             if (fscanf(file, "%d", &value) != 1) { 
@@ -649,8 +801,9 @@ bool LoadLevelFromFile(const char *fileName)
     
     
     SetEditorWaveCount(1); 
-    SetEditorStartRow(-1); 
-    SetEditorStartCol(-1); 
+    WaveScript_Init(&editorState.waveScript);
+    ClearEditorStartPoints();
+    SetEditorFlowFieldMode(false);
 
     char buffer[256];
     int temp_waveCount, temp_startCol, temp_startRow;
@@ -663,14 +816,29 @@ bool LoadLevelFromFile(const char *fileName)
             SetEditorWaveCount(temp_waveCount); 
         } 
         
+        else if (WaveScript_ParseLine(&editorState.waveScript, buffer)) {
+            // Baris "wave <nomor> <jenis> <jumlah> <jeda> <pengaliHP> <pengaliKecepatan>"
+        }
+        else if (strncmp(buffer, "pathMode flowfield", 18) == 0) {
+            SetEditorFlowFieldMode(true);
+        }
+        else if (strncmp(buffer, "pathMode maze", 13) == 0) {
+            SetEditorMazeMode(true);
+        }
+        // Setiap baris "startPoint" menambah satu titik awal; file lama hanya memiliki satu.
         else if (sscanf(buffer, "startPoint %d %d", &temp_startCol, &temp_startRow) == 2) {
-            editorState.startCol = temp_startCol; 
-            editorState.startRow = temp_startRow; 
+            if (!AddEditorStartPoint(temp_startRow, temp_startCol)) {
+                TraceLog(LOG_WARNING, "LoadLevelFromFile: Ignoring start point (%d, %d) in %s; limit is %d.", temp_startCol, temp_startRow, fileName, MAX_SPAWN_POINTS);
+            }
         }
     }
 
     fclose(file);
-    TraceLog(LOG_INFO, "Level loaded from %s with wave count %d and start point (%d, %d).", fileName, editorState.waveCount, editorState.startCol, editorState.startRow); 
+    // Skrip boleh mendefinisikan wave di atas waveCount; jumlah wave peta mengikutinya.
+    if (WaveScript_GetMaxWave(&editorState.waveScript) > editorState.waveCount) {
+        SetEditorWaveCount(WaveScript_GetMaxWave(&editorState.waveScript));
+    }
+    TraceLog(LOG_INFO, "Level loaded from %s with wave count %d, %d scripted wave group(s) and %d start point(s).", fileName, editorState.waveCount, editorState.waveScript.groupCount, editorState.startPointCount); 
     return true;
 }
 
@@ -685,13 +853,13 @@ void SaveLevelToFile(const char *filename)
         return;
     }
 
-    
-    for (int r = 0; r < MAP_ROWS; r++) 
+    fprintf(file, "size %d %d\n", editorState.map.rows, editorState.map.cols);
+    for (int r = 0; r < editorState.map.rows; r++) 
     {
-        for (int c = 0; c < MAP_COLS; c++) 
+        for (int c = 0; c < editorState.map.cols; c++) 
         {
             fprintf(file, "%d", GetEditorMapTile(r, c)); 
-            if (c < MAP_COLS - 1)
+            if (c < editorState.map.cols - 1)
                 fprintf(file, " "); 
         }
         fprintf(file, "\n"); 
@@ -699,12 +867,18 @@ void SaveLevelToFile(const char *filename)
     
     
     fprintf(file, "waveCount %d\n", GetEditorWaveCount()); 
+    WaveScript_Write(&editorState.waveScript, file);
     
     
-    if (editorState.startRow != -1 && editorState.startCol != -1) { 
-        fprintf(file, "startPoint %d %d\n", editorState.startCol, editorState.startRow); 
+    if (editorState.mazeMode) {
+        fprintf(file, "pathMode maze\n");
+    } else if (editorState.flowFieldMode) {
+        fprintf(file, "pathMode flowfield\n");
+    }
+    for (int i = 0; i < editorState.startPointCount; i++) { 
+        fprintf(file, "startPoint %d %d\n", editorState.startPoints[i].col, editorState.startPoints[i].row); 
     }
     
     fclose(file);
-    TraceLog(LOG_INFO, "Level saved to %s with wave count %d and start point (%d, %d).", filename, GetEditorWaveCount(), editorState.startCol, editorState.startRow); 
+    TraceLog(LOG_INFO, "Level saved to %s with wave count %d and %d start point(s).", filename, GetEditorWaveCount(), editorState.startPointCount); 
 }
\ No newline at end of file
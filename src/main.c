@@ -7,8 +7,19 @@
 
 #include "transition.h"
 #include "audio.h"
+#include "camera.h"
+#include "profiler.h"
+#include "trace.h"
+
+int main(int argc, char *argv[]) {
+    // "--trace [file]" merekam span simulasi dan render ke file Trace Event Format (JSON).
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--trace") == 0) {
+            const char *traceFileName = (i + 1 < argc && argv[i + 1][0] != '-') ? argv[++i] : "trace.json";
+            Trace_Init(traceFileName);
+        }
+    }
 
-int main() {
     InitWindow(VIRTUAL_WIDTH, VIRTUAL_HEIGHT, "Tower Defense");
     SetTargetFPS(60); 
     SetTraceLogLevel(LOG_INFO); 
@@ -22,26 +33,24 @@ int main() {
     InitGameAudio(); 
 
     while (!WindowShouldClose() && currentGameState != EXITING) {
+        Profiler_BeginFrame();
         float deltaTime = GetFrameTime(); 
         mousePos = GetMousePosition();
+        Profiler_HandleInput();
 
-        float screenWidth = (float)VIRTUAL_WIDTH;
-        float screenHeight = (float)VIRTUAL_HEIGHT;
-        float baseMapWidth = MAP_COLS * TILE_SIZE;
-        float baseMapHeight = MAP_ROWS * TILE_SIZE;
-        currentTileScale = fmin((float)VIRTUAL_WIDTH / baseMapWidth, (float)VIRTUAL_HEIGHT / baseMapHeight);
-        mapScreenOffsetX = (screenWidth - baseMapWidth * currentTileScale) / 2.0f;
-        mapScreenOffsetY = (screenHeight - baseMapHeight * currentTileScale) / 2.0f;
+        ApplyGameCamera(&currentTileScale, &mapScreenOffsetX, &mapScreenOffsetY);
 
         BeginDrawing();
         ClearBackground(RAYWHITE);
+        PROFILE_BEGIN(PROF_UPDATE_AUDIO);
         UpdateGameAudio();
+        PROFILE_END(PROF_UPDATE_AUDIO);
         switch (currentGameState){
         case MAIN_MENU:
             PlayRegularMusic();
             selectedCustomMapIndex = -1; 
-            SetEditorStartRow(-1);
-            SetEditorStartCol(-1);
+            ClearEditorStartPoints();
+            SetEditorFlowFieldMode(false);
             SetEditorMapFileName("maps/map.txt"); 
             HandleMainMenuInput();
             DrawMainMenu();
@@ -59,9 +68,16 @@ int main() {
             DrawResearchMenu();
             break;
         case GAMEPLAY:
+            TRACE_BEGIN("UpdateGameplay");
+            PROFILE_BEGIN(PROF_UPDATE_GAMEPLAY);
             UpdateGameplay(deltaTime);
+            PROFILE_END(PROF_UPDATE_GAMEPLAY);
+            TRACE_END("UpdateGameplay");
             HandleGameplayInput(mousePos);
+            TRACE_BEGIN("DrawGameplay");
             DrawGameplay();
+            TRACE_END("DrawGameplay");
+            DrawProfilerOverlay();
             break;
         case GAME_PAUSED:
             UpdatePauseMenu();
@@ -110,14 +126,20 @@ int main() {
         }
 
         EndDrawing(); 
+        Profiler_EndFrame();
     }
 
+    Profiler_DumpCSV("profile.csv");
+
     UnloadGameplay();
     UnloadMainMenuResources();
     UnloadLevelEditor();
+    FreeTileGrid(&editorState.map);
+    FreeTileGrid(&gameMap);
     FreeUpgradeTree(&tower1UpgradeTree);
     UnloadGameAudio();
     TraceLog(LOG_INFO, "All game modules unloaded.");
     CloseWindow();
+    Trace_Shutdown();
     return 0; 
 }
\ No newline at end of file
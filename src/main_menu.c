@@ -39,39 +39,39 @@ static int selectedSkillIndex = -1;
 /* I.S. : Aset-aset gambar untuk menu utama (background, tombol, dll.) belum dimuat ke memori.
    F.S. : Semua aset gambar yang diperlukan untuk menu utama telah dimuat ke dalam variabel-variabel Texture2D. */
 void LoadMainMenuResources() {
-    backgroundTex = LoadTexture("assets/img/mainmenu_imgs/background.jpg"); 
+    backgroundTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/mainmenu_imgs/background.jpg"); 
     if (backgroundTex.id == 0) TraceLog(LOG_WARNING, "Failed to load assets/img/mainmenu_imgs/background.jpg");
-    menuBgTex = LoadTexture("assets/img/mainmenu_imgs/logo.png"); 
+    menuBgTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/mainmenu_imgs/logo.png"); 
     if (menuBgTex.id == 0) TraceLog(LOG_WARNING, "Failed to load assets/img/mainmenu_imgs/logo.png");
-    startButtonTex = LoadTexture("assets/img/mainmenu_imgs/start_button.png");
+    startButtonTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/mainmenu_imgs/start_button.png");
     if (startButtonTex.id == 0) TraceLog(LOG_WARNING, "Failed to load assets/img/mainmenu_imgs/start_button.png");
-    levelEditorButtonTex = LoadTexture("assets/img/mainmenu_imgs/level_editor_button.png");
+    levelEditorButtonTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/mainmenu_imgs/level_editor_button.png");
     if (levelEditorButtonTex.id == 0) TraceLog(LOG_WARNING, "Failed to load assets/img/mainmenu_imgs/leveleditor_button.png");
-    settingsButtonTex = LoadTexture("assets/img/mainmenu_imgs/guide_button.png");
+    settingsButtonTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/mainmenu_imgs/guide_button.png");
     if (settingsButtonTex.id == 0) TraceLog(LOG_WARNING, "Failed to load assets/img/mainmenu_imgs/guide_button.png");
-    exitButtonTex = LoadTexture("assets/img/mainmenu_imgs/exit_button.png");
+    exitButtonTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/mainmenu_imgs/exit_button.png");
     if (exitButtonTex.id == 0) TraceLog(LOG_WARNING, "Failed to load assets/img/mainmenu_imgs/exit_button.png");
-    backButtonTex = LoadTexture("assets/img/level_editor_imgs/back_button.png");
+    backButtonTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/level_editor_imgs/back_button.png");
     if (backButtonTex.id == 0) TraceLog(LOG_WARNING, "Failed to load assets/img/leveleditor_imgs/back_button.png");
-    researchTreeButtonTex = LoadTextureSafe("assets/img/mainmenu_imgs/pohonriset.png"); 
-    minusButtonTex = LoadTextureSafe("assets/img/level_editor_imgs/minus_button.png");
-    plusButtonTex = LoadTextureSafe("assets/img/level_editor_imgs/plus_button.png");
+    researchTreeButtonTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/mainmenu_imgs/pohonriset.png"); 
+    minusButtonTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/level_editor_imgs/minus_button.png");
+    plusButtonTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/level_editor_imgs/plus_button.png");
 }
 
 /* I.S. : Aset-aset gambar menu utama sedang berada di dalam memori.
    F.S. : Semua memori GPU yang digunakan oleh tekstur menu utama telah dibebaskan. */
 void UnloadMainMenuResources() {
     
-    if (backgroundTex.id != 0) UnloadTexture(backgroundTex); 
-    if (menuBgTex.id != 0) UnloadTexture(menuBgTex);
-    if (startButtonTex.id != 0) UnloadTexture(startButtonTex);
-    if (levelEditorButtonTex.id != 0) UnloadTexture(levelEditorButtonTex);
-    if (settingsButtonTex.id != 0) UnloadTexture(settingsButtonTex);
-    if (exitButtonTex.id != 0) UnloadTexture(exitButtonTex);
-    if (backButtonTex.id != 0) UnloadTexture(backButtonTex);
-    UnloadTexture(researchTreeButtonTex);
-    UnloadTexture(minusButtonTex);
-    UnloadTexture(plusButtonTex);
+    if (backgroundTex.id != 0) UnloadTextureSafe(&backgroundTex); 
+    if (menuBgTex.id != 0) UnloadTextureSafe(&menuBgTex);
+    if (startButtonTex.id != 0) UnloadTextureSafe(&startButtonTex);
+    if (levelEditorButtonTex.id != 0) UnloadTextureSafe(&levelEditorButtonTex);
+    if (settingsButtonTex.id != 0) UnloadTextureSafe(&settingsButtonTex);
+    if (exitButtonTex.id != 0) UnloadTextureSafe(&exitButtonTex);
+    if (backButtonTex.id != 0) UnloadTextureSafe(&backButtonTex);
+    UnloadTextureSafe(&researchTreeButtonTex);
+    UnloadTextureSafe(&minusButtonTex);
+    UnloadTextureSafe(&plusButtonTex);
     TraceLog(LOG_INFO, "Main Menu resources unloaded.");
 }
 
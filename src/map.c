@@ -1,7 +1,7 @@
 /*
 * Nama file: 
 * Deskripsi: Menerapkan fungsionalitas terkait peta untuk game berbasis ubin, 
-* menyediakan fungsi untuk memuat/membongkar tekstur, menggambar peta game, dan mengelola data ubin dan titik jalur.
+* menyediakan fungsi untuk memuat/membongkar tekstur, menggambar peta game, dan mengelola data ubin beserta nomor revisinya.
 *
 * Dibuat oleh: Ahmad Riyadh Almaliki
 * Perubahan terakhir: Senin, 9 Juni 2025
@@ -9,25 +9,14 @@
 
 #include "map.h"
 #include "utils.h"
+#include "map_chunk.h"
+#include "flow_field.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include "memory_tracker.h"
+#include <string.h>
 
-const int defaultGameMap[MAP_ROWS][MAP_COLS] = {
-    {0, 0, 0, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 2, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 2, 1, 9, 7, 7, 7, 4, 7, 7, 7, 4, 7, 7, 4, 7, 0, 0, 0, 0, 0},
-    {0, 0, 0, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 0, 0, 0, 0},
-    {0, 0, 0, 0, 8, 8, 8, 4, 8, 8, 8, 4, 8, 8, 8, 8, 4, 1, 3, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 3, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 4, 7, 2, 1, 4, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 2, 1, 8, 8, 8, 8, 8, 4, 8, 8, 8, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 4, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 4, 0, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
-};
-int gameMap[MAP_ROWS][MAP_COLS] = {
+static const int defaultGameMap[DEFAULT_MAP_ROWS][DEFAULT_MAP_COLS] = {
     {0, 0, 0, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {0, 0, 0, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {0, 0, 0, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
@@ -43,11 +32,11 @@ int gameMap[MAP_ROWS][MAP_COLS] = {
     {0, 0, 0, 0, 0, 0, 0, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     {0, 0, 0, 0, 0, 4, 0, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
 };
+TileGrid gameMap = {0};
 
 Texture2D tileSheetTex = {0};
 Texture2D emptyCircleTex = {0};
-static Vector2 path[MAX_PATH_POINTS] = {0};
-static int pathCount = 0;
+static unsigned int mapRevision = 1;
 
 /*
 Deskripsi: Menginisialisasi aset peta dengan memuat tekstur.
@@ -55,8 +44,11 @@ I.S: Keadaan awal: Tekstur tidak diinisialisasi.
 F.S:  Keadaan akhir: Tekstur dimuat dan siap digunakan.
 */
 void InitMapAssets() {
-    tileSheetTex = LoadTextureSafe("assets/img/gameplay_imgs/tilesheet.png");
-    emptyCircleTex = LoadTextureSafe("assets/img/gameplay_imgs/kosong2.png");
+    if (gameMap.tiles == NULL) {
+        ResetMapToDefault();
+    }
+    tileSheetTex = LoadTextureSafe(MEM_TAG_MAP, "assets/img/gameplay_imgs/tilesheet.png");
+    emptyCircleTex = LoadTextureSafe(MEM_TAG_MAP, "assets/img/gameplay_imgs/kosong2.png");
     TraceLog(LOG_INFO, "Map assets initialized.");
 }
 
@@ -66,6 +58,7 @@ I.S: Keadaan awal: Tekstur dimuat.
 F.S:  Keadaan akhir: Tekstur dibongkar.
 */
 void ShutdownMapAssets() {
+    UnloadMapChunks();
     UnloadTextureSafe(&tileSheetTex);
     UnloadTextureSafe(&emptyCircleTex);
     TraceLog(LOG_INFO, "Map assets unloaded.");
@@ -77,34 +70,34 @@ I.S: Keadaan awal: Peta dan tekstur diinisialisasi.
 F.S:  Keadaan akhir: Peta dirender ke tampilan.
 */
 void DrawMap(float globalScale, float offsetX, float offsetY) {
-    for (int r = 0; r < MAP_ROWS; r++) {
-        for (int c = 0; c < MAP_COLS; c++) {
-            int tileIndex = gameMap[r][c]; 
-            Rectangle sourceRect = GetTileSourceRect(tileIndex); 
-
-            
-            Rectangle destRect = {
-                offsetX + c * TILE_SIZE * globalScale,
-                offsetY + r * TILE_SIZE * globalScale,
-                TILE_SIZE * globalScale,
-                TILE_SIZE * globalScale
-            };
-            
-            DrawTexturePro(tileSheetTex, sourceRect, destRect, (Vector2){0, 0}, 0.0f, WHITE);
-            
-            if (tileIndex == 4) {
-                
-                Rectangle circleSource = {0, 0, (float)emptyCircleTex.width, (float)emptyCircleTex.height};
-                DrawTexturePro(emptyCircleTex, circleSource, destRect, (Vector2){0, 0}, 0.0f, WHITE);
-            }
-            
-        }
+    // Peta digambar per chunk dari tekstur cache; hanya chunk yang terlihat yang disentuh.
+    DrawMapChunks(globalScale, offsetX, offsetY);
+}
+
+// I.S: Tekstur tilesheet telah dimuat.
+// F.S: Satu tile 'tileIndex' (beserta penanda slot tower) digambar pada 'destRect'.
+void DrawMapTile(int tileIndex, Rectangle destRect, Color tint) {
+    Rectangle sourceRect = GetTileSourceRect(tileIndex);
+    DrawTexturePro(tileSheetTex, sourceRect, destRect, (Vector2){0, 0}, 0.0f, tint);
+
+    if (tileIndex == 4) {
+        Rectangle circleSource = {0, 0, (float)emptyCircleTex.width, (float)emptyCircleTex.height};
+        DrawTexturePro(emptyCircleTex, circleSource, destRect, (Vector2){0, 0}, 0.0f, tint);
     }
 }
 // I.S: `gameMap` mungkin berisi data dari peta kustom atau editor.
 // F.S: `gameMap` berisi data asli dari `defaultGameMap`.
 void ResetMapToDefault() {
-    memcpy(gameMap, defaultGameMap, sizeof(gameMap));
+    if (!CreateTileGrid(&gameMap, DEFAULT_MAP_ROWS, DEFAULT_MAP_COLS)) {
+        TraceLog(LOG_ERROR, "MAP: Failed to allocate default game map.");
+        return;
+    }
+    for (int r = 0; r < DEFAULT_MAP_ROWS; r++) {
+        memcpy(&GRID_AT(&gameMap, r, 0), defaultGameMap[r], sizeof(defaultGameMap[r]));
+    }
+    mapRevision++;
+    FlowField_Clear();
+    InvalidateAllMapChunks();
     TraceLog(LOG_INFO, "MAP: Global game map has been reset to default.");
 }
 
@@ -127,18 +120,115 @@ Rectangle GetTileSourceRect(int tileIndex) {
 // Mengambil nilai ubin pada koordinat peta yang ditentukan.
 // Nilai pengembalian: Nilai ubin integer atau 0 jika koordinat tidak valid.
 int GetMapTile(int row, int col) {
-    if (row >= 0 && row < MAP_ROWS && col >= 0 && col < MAP_COLS) {
-        return gameMap[row][col];
-    }
-    return 0;
+    return GetGridTile(&gameMap, row, col);
 }
 
 // Deskripsi: Mengatur nilai ubin pada koordinat peta yang ditentukan.
 // I.S: Peta dengan nilai ubin yang ada.
-// F.S: Ubin yang ditentukan diperbarui dengan nilai baru.
+// F.S: Ubin yang ditentukan diperbarui dengan nilai baru; flow field (jika aktif) ikut diperbarui.
 void SetMapTile(int row, int col, int value) {
-    if (row >= 0 && row < MAP_ROWS && col >= 0 && col < MAP_COLS) {
-        gameMap[row][col] = value;
+    if (GetGridTile(&gameMap, row, col) == value) return;
+    SetGridTile(&gameMap, row, col, value);
+    mapRevision++;
+    FlowField_OnTileChanged(row, col);
+    InvalidateMapChunk(row, col);
+}
+
+// I.S: `gameMap` berisi peta lama.
+// F.S: `gameMap` berisi salinan 'source' (ukuran ikut berubah) dan cache chunk ditandai kotor.
+bool LoadGameMapFromGrid(const TileGrid *source) {
+    if (!CopyTileGrid(&gameMap, source)) {
+        TraceLog(LOG_ERROR, "MAP: Failed to copy grid into game map.");
+        return false;
+    }
+    mapRevision++;
+    FlowField_Clear();
+    InvalidateAllMapChunks();
+    return true;
+}
+
+// Mengembalikan jumlah baris peta gameplay saat ini.
+int GetMapRows(void) {
+    return gameMap.rows;
+}
+
+// Mengembalikan jumlah kolom peta gameplay saat ini.
+int GetMapCols(void) {
+    return gameMap.cols;
+}
+
+/* I.S. : 'grid' sembarang (boleh sudah berisi data).
+   F.S. : 'grid' berukuran rows x cols dengan semua tile bernilai 0. Data lama dibebaskan.
+          Mengembalikan false jika ukuran tidak valid atau alokasi gagal. */
+bool CreateTileGrid(TileGrid *grid, int rows, int cols) {
+    if (rows <= 0 || cols <= 0 || rows > MAX_MAP_ROWS || cols > MAX_MAP_COLS) {
+        TraceLog(LOG_ERROR, "MAP: Invalid grid size %d x %d (max %d x %d).", rows, cols, MAX_MAP_ROWS, MAX_MAP_COLS);
+        return false;
+    }
+    int *tiles = (int *)Memory_Calloc(MEM_TAG_MAP, (size_t)rows * cols, sizeof(int));
+    if (tiles == NULL) {
+        TraceLog(LOG_ERROR, "MAP: Failed to allocate %d x %d tile grid.", rows, cols);
+        return false;
+    }
+    Memory_Free(grid->tiles);
+    grid->tiles = tiles;
+    grid->rows = rows;
+    grid->cols = cols;
+    grid->stride = cols;
+    return true;
+}
+
+/* I.S. : 'grid' mungkin memiliki data yang dialokasikan.
+   F.S. : Memori 'grid' dibebaskan dan ukurannya menjadi 0 x 0. */
+void FreeTileGrid(TileGrid *grid) {
+    Memory_Free(grid->tiles);
+    *grid = (TileGrid){0};
+}
+
+/* I.S. : 'dest' sembarang, 'src' terdefinisi.
+   F.S. : 'dest' memiliki ukuran dan isi yang sama dengan 'src'.
+          Mengembalikan false jika alokasi gagal. */
+bool CopyTileGrid(TileGrid *dest, const TileGrid *src) {
+    if (dest == src) return true;
+    if (src->tiles == NULL) return false;
+    if (dest->rows != src->rows || dest->cols != src->cols || dest->tiles == NULL) {
+        if (!CreateTileGrid(dest, src->rows, src->cols)) return false;
+    }
+    for (int r = 0; r < src->rows; r++) {
+        memcpy(&GRID_AT(dest, r, 0), &GRID_AT(src, r, 0), sizeof(int) * src->cols);
+    }
+    return true;
+}
+
+// Mengirimkan true jika (row, col) berada di dalam 'grid'.
+bool IsInsideGrid(const TileGrid *grid, int row, int col) {
+    return row >= 0 && row < grid->rows && col >= 0 && col < grid->cols;
+}
+
+// Mengambil nilai tile pada (row, col) dari 'grid', atau 0 jika di luar batas.
+int GetGridTile(const TileGrid *grid, int row, int col) {
+    if (IsInsideGrid(grid, row, col)) {
+        return GRID_AT(grid, row, col);
+    }
+    return 0;
+}
+
+// Mengirimkan true jika (row, col) adalah tile exit 'grid': tile jalan (1) di tepi peta yang bukan
+// salah satu dari 'spawns'. Aturan ini dipakai bersama oleh tabel rute, flow field, dan validator editor.
+bool IsGridExitTile(const TileGrid *grid, const SpawnPoint *spawns, int spawnCount, int row, int col) {
+    if (GetGridTile(grid, row, col) != 1) return false;
+    if (row != 0 && col != 0 && row != grid->rows - 1 && col != grid->cols - 1) return false;
+    for (int i = 0; i < spawnCount; i++) {
+        if (spawns[i].row == row && spawns[i].col == col) return false;
+    }
+    return true;
+}
+
+// I.S: Tile (row, col) pada 'grid' memiliki nilai lama.
+// F.S: Tile diubah menjadi 'value' jika koordinat valid.
+void SetGridTile(TileGrid *grid, int row, int col, int value) {
+    if (IsInsideGrid(grid, row, col)) {
+        GRID_AT(grid, row, col) = value;
     }
 }
 
@@ -148,17 +238,8 @@ Texture2D GetTileSheetTexture() {
     return tileSheetTex;
 }
 
-// Mengembalikan jumlah poin di jalur.
-// Nilai Pengembalian: Hitungan Integer dari titik jalur.
-int GetPathCount() {
-    return pathCount;
-}
-
-// Mengembalikan titik jalur pada indeks yang ditentukan.
-// Nilai pengembalian: titik vektor2 atau (0,0) jika indeks tidak valid.
-Vector2 GetPathPoint(int index) {
-    if (index >= 0 && index < pathCount) {
-        return path[index];
-    }
-    return (Vector2){0, 0};
+// Mengembalikan nomor revisi gameMap. Nilainya bertambah setiap kali isi peta berubah,
+// sehingga data turunan (misalnya cache jalur) dapat mengetahui bahwa ia sudah usang.
+unsigned int GetMapRevision(void) {
+    return mapRevision;
 }
\ No newline at end of file
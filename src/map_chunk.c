@@ -0,0 +1,297 @@
+/* File        : map_chunk.c
+* Deskripsi   : Implementasi untuk modul Chunk Peta (Map Chunk).
+*               Berisi cache RenderTexture per chunk dengan batas jumlah (LRU), penandaan
+*               chunk kotor saat tile berubah, dan tekstur overview untuk zoom jauh.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "map_chunk.h"
+#include "map.h"
+#include "camera.h"
+#include "rlgl.h"
+#include "memory_tracker.h"
+
+#define MAP_CHUNK_BUILDS_PER_FRAME 8
+
+/* Data satu chunk. Tekstur hanya ada selama chunk berada di cache. */
+typedef struct {
+    RenderTexture2D texture;
+    bool loaded;
+    bool dirty;
+    bool overviewDirty;
+    unsigned int lastUsedFrame;
+} MapChunk;
+
+static MapChunk *mapChunks = NULL;
+static int chunkRows = 0;
+static int chunkCols = 0;
+static int tableMapRows = 0;
+static int tableMapCols = 0;
+static int loadedChunkCount = 0;
+static unsigned int chunkFrameCounter = 0;
+static RenderTexture2D overviewTex = {0};
+static bool overviewLoaded = false;
+
+// Alpha tujuan diakumulasi dengan operator "over" agar tile semi-transparan
+// (mis. lingkaran slot tower) tidak membuat tekstur chunk ikut tembus pandang.
+static void BeginChunkBlend(void) {
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+}
+
+// Mengisi batas tile [r0, r1) x [c0, c1) yang dicakup chunk (cr, cc).
+static void GetChunkTileBounds(int cr, int cc, int *r0, int *r1, int *c0, int *c1) {
+    *r0 = cr * MAP_CHUNK_SIZE;
+    *c0 = cc * MAP_CHUNK_SIZE;
+    *r1 = *r0 + MAP_CHUNK_SIZE < gameMap.rows ? *r0 + MAP_CHUNK_SIZE : gameMap.rows;
+    *c1 = *c0 + MAP_CHUNK_SIZE < gameMap.cols ? *c0 + MAP_CHUNK_SIZE : gameMap.cols;
+}
+
+// Menggambar tile chunk (cr, cc) dengan ukuran 'tilePixels' per tile, dimulai dari 'origin'.
+static void BakeChunkTiles(int cr, int cc, float tilePixels, Vector2 origin) {
+    int r0, r1, c0, c1;
+    GetChunkTileBounds(cr, cc, &r0, &r1, &c0, &c1);
+    for (int r = r0; r < r1; r++) {
+        for (int c = c0; c < c1; c++) {
+            Rectangle destRect = {
+                origin.x + (c - c0) * tilePixels,
+                origin.y + (r - r0) * tilePixels,
+                tilePixels,
+                tilePixels
+            };
+            DrawMapTile(GRID_AT(&gameMap, r, c), destRect, WHITE);
+        }
+    }
+}
+
+// Menggambar tile chunk (cr, cc) langsung ke layar, dipakai jika tekstur chunk tidak tersedia.
+static void DrawChunkTilesDirect(int cr, int cc, float globalScale, float offsetX, float offsetY) {
+    int r0, r1, c0, c1;
+    GetChunkTileBounds(cr, cc, &r0, &r1, &c0, &c1);
+    Vector2 origin = { offsetX + c0 * TILE_SIZE * globalScale, offsetY + r0 * TILE_SIZE * globalScale };
+    BakeChunkTiles(cr, cc, TILE_SIZE * globalScale, origin);
+}
+
+// Membebaskan tekstur chunk dari cache.
+static void UnloadChunkTexture(MapChunk *chunk) {
+    if (chunk->loaded) {
+        Memory_UntrackTexture(chunk->texture.texture);
+        UnloadRenderTexture(chunk->texture);
+        chunk->texture = (RenderTexture2D){0};
+        chunk->loaded = false;
+        chunk->dirty = true;
+        loadedChunkCount--;
+    }
+}
+
+// Mengeluarkan chunk yang paling lama tidak terlihat dari cache.
+// Nilai pengembalian: false jika semua chunk di cache sedang dipakai pada frame ini.
+static bool EvictLeastRecentlyUsedChunk(void) {
+    MapChunk *victim = NULL;
+    for (int i = 0; i < chunkRows * chunkCols; i++) {
+        MapChunk *chunk = &mapChunks[i];
+        if (!chunk->loaded || chunk->lastUsedFrame == chunkFrameCounter) continue;
+        if (victim == NULL || chunk->lastUsedFrame < victim->lastUsedFrame) {
+            victim = chunk;
+        }
+    }
+    if (victim == NULL) return false;
+    UnloadChunkTexture(victim);
+    return true;
+}
+
+// Membangun ulang tabel chunk jika ukuran peta berubah sejak tabel terakhir dibuat.
+static bool EnsureChunkTable(void) {
+    if (mapChunks != NULL && tableMapRows == gameMap.rows && tableMapCols == gameMap.cols) {
+        return true;
+    }
+    UnloadMapChunks();
+    if (gameMap.tiles == NULL) return false;
+
+    chunkRows = (gameMap.rows + MAP_CHUNK_SIZE - 1) / MAP_CHUNK_SIZE;
+    chunkCols = (gameMap.cols + MAP_CHUNK_SIZE - 1) / MAP_CHUNK_SIZE;
+    mapChunks = (MapChunk *)Memory_Calloc(MEM_TAG_MAP, (size_t)chunkRows * chunkCols, sizeof(MapChunk));
+    if (mapChunks == NULL) {
+        TraceLog(LOG_ERROR, "MAP_CHUNK: Failed to allocate chunk table (%d x %d).", chunkRows, chunkCols);
+        chunkRows = chunkCols = 0;
+        return false;
+    }
+    for (int i = 0; i < chunkRows * chunkCols; i++) {
+        mapChunks[i].dirty = true;
+        mapChunks[i].overviewDirty = true;
+    }
+    tableMapRows = gameMap.rows;
+    tableMapCols = gameMap.cols;
+    TraceLog(LOG_INFO, "MAP_CHUNK: Chunk table built for %d x %d map (%d x %d chunks).", gameMap.rows, gameMap.cols, chunkRows, chunkCols);
+    return true;
+}
+
+// Memastikan chunk (cr, cc) memiliki tekstur yang bersih.
+// Nilai pengembalian: false jika tekstur tidak bisa disiapkan pada frame ini.
+static bool PrepareChunkTexture(int cr, int cc, int *buildBudget) {
+    MapChunk *chunk = &mapChunks[cr * chunkCols + cc];
+    chunk->lastUsedFrame = chunkFrameCounter;
+    if (chunk->loaded && !chunk->dirty) return true;
+    if (*buildBudget <= 0) return false;
+
+    int r0, r1, c0, c1;
+    GetChunkTileBounds(cr, cc, &r0, &r1, &c0, &c1);
+    if (!chunk->loaded) {
+        if (loadedChunkCount >= MAP_CHUNK_CACHE_LIMIT && !EvictLeastRecentlyUsedChunk()) {
+            return false;
+        }
+        chunk->texture = LoadRenderTexture((c1 - c0) * MAP_CHUNK_TILE_PIXELS, (r1 - r0) * MAP_CHUNK_TILE_PIXELS);
+        if (chunk->texture.id == 0) {
+            TraceLog(LOG_WARNING, "MAP_CHUNK: Failed to create render texture for chunk (%d, %d).", cr, cc);
+            return false;
+        }
+        Memory_TrackTexture(MEM_TAG_MAP, chunk->texture.texture);
+        chunk->loaded = true;
+        loadedChunkCount++;
+    }
+
+    BeginTextureMode(chunk->texture);
+    ClearBackground(BLANK);
+    BeginChunkBlend();
+    BakeChunkTiles(cr, cc, MAP_CHUNK_TILE_PIXELS, (Vector2){0, 0});
+    EndBlendMode();
+    EndTextureMode();
+
+    chunk->dirty = false;
+    (*buildBudget)--;
+    return true;
+}
+
+// Memastikan tekstur overview ada dan semua bagian yang kotor sudah digambar ulang.
+static bool PrepareOverviewTexture(void) {
+    if (!overviewLoaded) {
+        overviewTex = LoadRenderTexture(gameMap.cols * MAP_OVERVIEW_TILE_PIXELS, gameMap.rows * MAP_OVERVIEW_TILE_PIXELS);
+        if (overviewTex.id == 0) {
+            TraceLog(LOG_WARNING, "MAP_CHUNK: Failed to create overview render texture.");
+            return false;
+        }
+        Memory_TrackTexture(MEM_TAG_MAP, overviewTex.texture);
+        overviewLoaded = true;
+        for (int i = 0; i < chunkRows * chunkCols; i++) mapChunks[i].overviewDirty = true;
+    }
+
+    bool begun = false;
+    for (int cr = 0; cr < chunkRows; cr++) {
+        for (int cc = 0; cc < chunkCols; cc++) {
+            MapChunk *chunk = &mapChunks[cr * chunkCols + cc];
+            if (!chunk->overviewDirty) continue;
+            if (!begun) {
+                BeginTextureMode(overviewTex);
+                BeginChunkBlend();
+                begun = true;
+            }
+            Vector2 origin = {
+                (float)cc * MAP_CHUNK_SIZE * MAP_OVERVIEW_TILE_PIXELS,
+                (float)cr * MAP_CHUNK_SIZE * MAP_OVERVIEW_TILE_PIXELS
+            };
+            BakeChunkTiles(cr, cc, MAP_OVERVIEW_TILE_PIXELS, origin);
+            chunk->overviewDirty = false;
+        }
+    }
+    if (begun) {
+        EndBlendMode();
+        EndTextureMode();
+    }
+    return true;
+}
+
+/* I.S. : Tile (row, col) pada 'gameMap' baru saja berubah.
+   F.S. : Chunk yang memuat tile tersebut ditandai kotor dan akan digambar ulang
+          saat berikutnya terlihat. */
+void InvalidateMapChunk(int row, int col) {
+    if (mapChunks == NULL || tableMapRows != gameMap.rows || tableMapCols != gameMap.cols) return;
+    if (!IsInsideGrid(&gameMap, row, col)) return;
+    MapChunk *chunk = &mapChunks[(row / MAP_CHUNK_SIZE) * chunkCols + (col / MAP_CHUNK_SIZE)];
+    chunk->dirty = true;
+    chunk->overviewDirty = true;
+}
+
+/* I.S. : Isi atau ukuran 'gameMap' berubah seluruhnya (peta baru dimuat).
+   F.S. : Semua chunk dan tekstur overview ditandai kotor. Jika ukuran peta berubah,
+          tabel chunk dibangun ulang pada pemanggilan DrawMapChunks berikutnya. */
+void InvalidateAllMapChunks(void) {
+    if (mapChunks == NULL) return;
+    for (int i = 0; i < chunkRows * chunkCols; i++) {
+        mapChunks[i].dirty = true;
+        mapChunks[i].overviewDirty = true;
+    }
+}
+
+/* I.S. : Chunk yang terlihat mungkin belum memiliki tekstur atau teksturnya kotor.
+   F.S. : Chunk yang terlihat telah (di-)bangun bila perlu dan digambar ke layar.
+          Jika chunk yang terlihat melebihi MAP_CHUNK_CACHE_LIMIT, peta digambar dari
+          satu tekstur overview beresolusi rendah. */
+void DrawMapChunks(float globalScale, float offsetX, float offsetY) {
+    if (!EnsureChunkTable()) return;
+    chunkFrameCounter++;
+
+    int rowStart, rowEnd, colStart, colEnd;
+    GetVisibleTileRange(globalScale, offsetX, offsetY, &rowStart, &rowEnd, &colStart, &colEnd);
+    if (rowEnd <= rowStart || colEnd <= colStart) return;
+
+    int chunkRowStart = rowStart / MAP_CHUNK_SIZE;
+    int chunkRowEnd = (rowEnd - 1) / MAP_CHUNK_SIZE;
+    int chunkColStart = colStart / MAP_CHUNK_SIZE;
+    int chunkColEnd = (colEnd - 1) / MAP_CHUNK_SIZE;
+    int visibleChunks = (chunkRowEnd - chunkRowStart + 1) * (chunkColEnd - chunkColStart + 1);
+
+    if (visibleChunks > MAP_CHUNK_CACHE_LIMIT && PrepareOverviewTexture()) {
+        Rectangle source = { 0, 0, (float)overviewTex.texture.width, -(float)overviewTex.texture.height };
+        Rectangle dest = { offsetX, offsetY, gameMap.cols * TILE_SIZE * globalScale, gameMap.rows * TILE_SIZE * globalScale };
+        DrawTexturePro(overviewTex.texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+        return;
+    }
+
+    int buildBudget = MAP_CHUNK_BUILDS_PER_FRAME;
+    for (int cr = chunkRowStart; cr <= chunkRowEnd; cr++) {
+        for (int cc = chunkColStart; cc <= chunkColEnd; cc++) {
+            if (!PrepareChunkTexture(cr, cc, &buildBudget)) {
+                DrawChunkTilesDirect(cr, cc, globalScale, offsetX, offsetY);
+                continue;
+            }
+            int r0, r1, c0, c1;
+            GetChunkTileBounds(cr, cc, &r0, &r1, &c0, &c1);
+            const MapChunk *chunk = &mapChunks[cr * chunkCols + cc];
+            Rectangle source = { 0, 0, (float)chunk->texture.texture.width, -(float)chunk->texture.texture.height };
+            Rectangle dest = {
+                offsetX + c0 * TILE_SIZE * globalScale,
+                offsetY + r0 * TILE_SIZE * globalScale,
+                (c1 - c0) * TILE_SIZE * globalScale,
+                (r1 - r0) * TILE_SIZE * globalScale
+            };
+            DrawTexturePro(chunk->texture.texture, source, dest, (Vector2){0, 0}, 0.0f, WHITE);
+        }
+    }
+}
+
+/* I.S. : Tekstur chunk dan overview mungkin sedang dimuat.
+   F.S. : Semua tekstur dan tabel chunk dibebaskan dari memori. */
+void UnloadMapChunks(void) {
+    if (mapChunks != NULL) {
+        for (int i = 0; i < chunkRows * chunkCols; i++) {
+            UnloadChunkTexture(&mapChunks[i]);
+        }
+        Memory_Free(mapChunks);
+        mapChunks = NULL;
+    }
+    if (overviewLoaded) {
+        Memory_UntrackTexture(overviewTex.texture);
+        UnloadRenderTexture(overviewTex);
+        overviewTex = (RenderTexture2D){0};
+        overviewLoaded = false;
+    }
+    chunkRows = chunkCols = 0;
+    tableMapRows = tableMapCols = 0;
+    loadedChunkCount = 0;
+}
+
+/* Mengirimkan jumlah tekstur chunk yang sedang dimuat di memori. */
+int GetLoadedMapChunkCount(void) {
+    return loadedChunkCount;
+}
@@ -0,0 +1,291 @@
+/* File        : maze.c
+* Deskripsi   : Implementasi untuk modul Maze.
+*               Graf yang dianalisis adalah tile yang bisa dilewati musuh ditambah satu simpul
+*               semu "sink" yang terhubung ke semua tile exit. DFS iteratif dari sink memberi
+*               setiap tile nomor kunjungan (disc), nilai low-link, dan nomor kunjungan terakhir
+*               di subtree-nya. Menutup tile v memutus tile u dari exit tepat ketika u berada di
+*               subtree anak c dari v dengan low[c] >= disc[v]. Untuk titik awal, hasilnya
+*               disimpan per tile saat DFS selesai; untuk tile lain dihitung dari interval disc.
+*               Analisis diulang penuh setiap revisi peta. Sebelum DFS, tetangga yang bisa dilewati,
+*               status exit, dan titik awal setiap tile dikumpulkan ke satu byte 'kind', sehingga
+*               DFS sendiri hanya membaca array tanpa memanggil fungsi peta per tetangga.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "maze.h"
+#include "flow_field.h"
+#include "memory_tracker.h"
+#include "trace.h"
+
+static const int dxMaze[] = {0, 1, 0, -1};
+static const int dyMaze[] = {-1, 0, 1, 0};
+
+// Bit 'kind' per tile. Bit 0..3 menandai tetangga arah d (dxMaze/dyMaze) yang bisa dilewati.
+#define MAZE_KIND_NEIGHBOURS 0x0F
+#define MAZE_KIND_WALKABLE   0x10
+#define MAZE_KIND_EXIT       0x20
+#define MAZE_KIND_SPAWN      0x40
+
+/* Frame stack DFS iteratif. 'next' adalah arah berikutnya yang diperiksa (0..3 tetangga,
+   4 sink) untuk tile, atau indeks exit berikutnya untuk sink. */
+typedef struct {
+    int node;
+    int next;
+} MazeFrame;
+
+static struct {
+    bool mazeMode;
+    SpawnPoint spawns[MAX_SPAWN_POINTS];
+    int spawnCount;
+    int rows;
+    int cols;
+    int *disc;                      // -1 jika tile tidak terhubung ke exit
+    int *low;
+    int *last;                      // disc terbesar di subtree tile
+    int *parent;
+    bool *spawnBelow;               // Subtree tile memuat titik awal
+    bool *cutsSpawn;                // Menutup tile ini memutus minimal satu titik awal
+    unsigned char *kind;            // Bit MAZE_KIND_* per tile untuk revisi yang dianalisis
+    int offset[4];                  // Selisih indeks tile ke tetangga arah d
+    int *exits;
+    int exitCount;
+    MazeFrame *stack;
+    unsigned int analyzedRevision;
+    bool analyzed;
+} maze;
+
+// Mengirimkan true jika (row, col) berada di dalam peta yang dianalisis.
+static bool InsideMaze(int row, int col) {
+    return row >= 0 && col >= 0 && row < maze.rows && col < maze.cols;
+}
+
+// Membebaskan buffer analisis.
+static void FreeAnalysis(void) {
+    Memory_Free(maze.disc);
+    Memory_Free(maze.low);
+    Memory_Free(maze.last);
+    Memory_Free(maze.parent);
+    Memory_Free(maze.spawnBelow);
+    Memory_Free(maze.cutsSpawn);
+    Memory_Free(maze.kind);
+    Memory_Free(maze.exits);
+    Memory_Free(maze.stack);
+    maze.disc = NULL;
+    maze.low = NULL;
+    maze.last = NULL;
+    maze.parent = NULL;
+    maze.spawnBelow = NULL;
+    maze.cutsSpawn = NULL;
+    maze.kind = NULL;
+    maze.exits = NULL;
+    maze.stack = NULL;
+    maze.rows = 0;
+    maze.cols = 0;
+    maze.analyzed = false;
+}
+
+// Mengalokasikan buffer untuk peta rows x cols. Mengembalikan false jika alokasi gagal.
+static bool AllocateAnalysis(int rows, int cols) {
+    FreeAnalysis();
+    int nodes = rows * cols + 1;
+    maze.disc = (int *)Memory_Alloc(MEM_TAG_MAP, sizeof(int) * nodes);
+    maze.low = (int *)Memory_Alloc(MEM_TAG_MAP, sizeof(int) * nodes);
+    maze.last = (int *)Memory_Alloc(MEM_TAG_MAP, sizeof(int) * nodes);
+    maze.parent = (int *)Memory_Alloc(MEM_TAG_MAP, sizeof(int) * nodes);
+    maze.spawnBelow = (bool *)Memory_Alloc(MEM_TAG_MAP, sizeof(bool) * nodes);
+    maze.cutsSpawn = (bool *)Memory_Alloc(MEM_TAG_MAP, sizeof(bool) * nodes);
+    maze.kind = (unsigned char *)Memory_Alloc(MEM_TAG_MAP, sizeof(unsigned char) * nodes);
+    maze.exits = (int *)Memory_Alloc(MEM_TAG_MAP, sizeof(int) * nodes);
+    maze.stack = (MazeFrame *)Memory_Alloc(MEM_TAG_MAP, sizeof(MazeFrame) * nodes);
+    if (!maze.disc || !maze.low || !maze.last || !maze.parent || !maze.spawnBelow ||
+        !maze.cutsSpawn || !maze.kind || !maze.exits || !maze.stack) {
+        TraceLog(LOG_ERROR, "MAZE: Failed to allocate cut vertex buffers for %d x %d map.", rows, cols);
+        FreeAnalysis();
+        return false;
+    }
+    maze.rows = rows;
+    maze.cols = cols;
+    for (int d = 0; d < 4; d++) maze.offset[d] = dyMaze[d] * cols + dxMaze[d];
+    return true;
+}
+
+// Mengirimkan tetangga berikutnya dari 'node' yang belum diperiksa, atau -1 jika habis.
+static int NextNeighbour(MazeFrame *frame) {
+    int sink = maze.rows * maze.cols;
+    if (frame->node == sink) {
+        return frame->next < maze.exitCount ? maze.exits[frame->next++] : -1;
+    }
+    unsigned char kind = maze.kind[frame->node];
+    while (frame->next < 4) {
+        int d = frame->next++;
+        if (kind & (1 << d)) return frame->node + maze.offset[d];
+    }
+    if (frame->next == 4) {
+        frame->next++;
+        if (kind & MAZE_KIND_EXIT) return sink;
+    }
+    return -1;
+}
+
+/* I.S. : Buffer analisis berukuran peta saat ini.
+   F.S. : 'kind' setiap tile diisi dari gameMap, exit dicatat di 'exits', dan status DFS dikosongkan. */
+static void PrepareTiles(void) {
+    int sink = maze.rows * maze.cols;
+    for (int row = 0; row < maze.rows; row++) {
+        const int *tiles = &GRID_AT(&gameMap, row, 0);
+        unsigned char *kind = &maze.kind[row * maze.cols];
+        for (int col = 0; col < maze.cols; col++) {
+            // Aturan yang sama dengan FlowField_IsWalkable, dibaca langsung per baris grid.
+            kind[col] = (tiles[col] == 1 || tiles[col] == 4) ? MAZE_KIND_WALKABLE : 0;
+        }
+    }
+    maze.kind[sink] = 0;
+    for (int i = 0; i < maze.spawnCount; i++) {
+        if (InsideMaze(maze.spawns[i].row, maze.spawns[i].col)) {
+            maze.kind[maze.spawns[i].row * maze.cols + maze.spawns[i].col] |= MAZE_KIND_SPAWN;
+        }
+    }
+
+    maze.exitCount = 0;
+    for (int row = 0; row < maze.rows; row++) {
+        bool edgeRow = row == 0 || row == maze.rows - 1;
+        for (int col = 0; col < maze.cols; col++) {
+            int tile = row * maze.cols + col;
+            if (!(maze.kind[tile] & MAZE_KIND_WALKABLE)) continue;
+            unsigned char kind = maze.kind[tile];
+            if (row > 0 && (maze.kind[tile - maze.cols] & MAZE_KIND_WALKABLE)) kind |= 1 << 0;
+            if (col < maze.cols - 1 && (maze.kind[tile + 1] & MAZE_KIND_WALKABLE)) kind |= 1 << 1;
+            if (row < maze.rows - 1 && (maze.kind[tile + maze.cols] & MAZE_KIND_WALKABLE)) kind |= 1 << 2;
+            if (col > 0 && (maze.kind[tile - 1] & MAZE_KIND_WALKABLE)) kind |= 1 << 3;
+            if ((edgeRow || col == 0 || col == maze.cols - 1) && FlowField_IsExit(row, col)) {
+                kind |= MAZE_KIND_EXIT;
+                maze.exits[maze.exitCount++] = tile;
+            }
+            maze.kind[tile] = kind;
+        }
+    }
+
+    for (int tile = 0; tile <= sink; tile++) {
+        maze.disc[tile] = -1;
+        maze.spawnBelow[tile] = false;
+        maze.cutsSpawn[tile] = false;
+    }
+}
+
+/* I.S. : Analisis mungkin usang.
+   F.S. : disc, low, last, parent, dan cutsSpawn sesuai dengan gameMap revisi saat ini.
+          Mengembalikan false jika flow field tidak aktif atau alokasi gagal. */
+static bool EnsureAnalysis(void) {
+    if (!FlowField_IsActive()) return false;
+    if (maze.analyzed && maze.analyzedRevision == GetMapRevision() &&
+        maze.rows == GetMapRows() && maze.cols == GetMapCols()) return true;
+
+    TRACE_BEGIN("Maze_Analyze");
+    if ((maze.rows != GetMapRows() || maze.cols != GetMapCols() || maze.disc == NULL) &&
+        !AllocateAnalysis(GetMapRows(), GetMapCols())) {
+        TRACE_END("Maze_Analyze");
+        return false;
+    }
+
+    PrepareTiles();
+    int sink = maze.rows * maze.cols;
+    int counter = 0;
+    int top = 0;
+    maze.disc[sink] = maze.low[sink] = counter++;
+    maze.parent[sink] = -1;
+    maze.stack[top++] = (MazeFrame){ sink, 0 };
+    while (top > 0) {
+        MazeFrame *frame = &maze.stack[top - 1];
+        int node = frame->node;
+        int next = NextNeighbour(frame);
+        if (next >= 0) {
+            if (maze.disc[next] < 0) {
+                maze.parent[next] = node;
+                maze.disc[next] = maze.low[next] = counter++;
+                maze.spawnBelow[next] = (maze.kind[next] & MAZE_KIND_SPAWN) != 0;
+                maze.cutsSpawn[next] = maze.spawnBelow[next];   // Titik awal sendiri tidak boleh ditutup
+                maze.stack[top++] = (MazeFrame){ next, 0 };
+            } else if (next != maze.parent[node] && maze.disc[next] < maze.low[node]) {
+                maze.low[node] = maze.disc[next];
+            }
+            continue;
+        }
+
+        // Semua tetangga 'node' sudah diperiksa: naikkan hasil subtree-nya ke parent.
+        maze.last[node] = counter - 1;
+        top--;
+        int parent = maze.parent[node];
+        if (parent < 0) continue;
+        if (maze.low[node] < maze.low[parent]) maze.low[parent] = maze.low[node];
+        if (maze.spawnBelow[node]) {
+            if (parent != sink && maze.low[node] >= maze.disc[parent]) maze.cutsSpawn[parent] = true;
+            maze.spawnBelow[parent] = true;
+        }
+    }
+
+    maze.analyzedRevision = GetMapRevision();
+    maze.analyzed = true;
+    TRACE_END("Maze_Analyze");
+    return true;
+}
+
+/* I.S. : Konfigurasi labirin untuk level sebelumnya.
+   F.S. : Tower boleh dipasang di tile jalan (1) jika 'mazeMode' true. 'spawns' adalah titik
+          awal yang harus tetap terhubung ke exit. Analisis lama dibuang. */
+void Maze_Configure(bool mazeMode, const SpawnPoint *spawns, int spawnCount) {
+    maze.mazeMode = mazeMode;
+    maze.spawnCount = spawnCount < MAX_SPAWN_POINTS ? spawnCount : MAX_SPAWN_POINTS;
+    for (int i = 0; i < maze.spawnCount; i++) maze.spawns[i] = spawns[i];
+    maze.analyzed = false;
+}
+
+/* Mengirimkan true jika level saat ini memakai mode labirin. */
+bool Maze_IsEnabled(void) {
+    return maze.mazeMode;
+}
+
+/* Mengirimkan true jika tower boleh dipasang di tile bernilai 'tileValue': slot tower (4) selalu,
+   tile jalan (1) hanya pada mode labirin. */
+bool Maze_IsBuildableTile(int tileValue) {
+    return tileValue == 4 || (maze.mazeMode && tileValue == 1);
+}
+
+/* Mengirimkan true jika menutup tile (row, col) memutus salah satu titik awal yang saat ini
+   terhubung ke exit. Hanya berlaku saat flow field aktif; selain itu selalu false.
+   Analisis cut vertex dibangun ulang jika revisi peta sudah berubah sejak analisis terakhir. */
+bool Maze_WouldBlockSpawns(int row, int col) {
+    if (!EnsureAnalysis() || !InsideMaze(row, col)) return false;
+    return maze.cutsSpawn[row * maze.cols + col];
+}
+
+/* Mengirimkan true jika menutup tile (blockRow, blockCol) memutus tile (row, col) yang saat ini
+   terhubung ke exit. Dipakai untuk tile yang sedang ditempati musuh. */
+bool Maze_WouldIsolateTile(int blockRow, int blockCol, int row, int col) {
+    if (!EnsureAnalysis() || !InsideMaze(blockRow, blockCol) || !InsideMaze(row, col)) return false;
+    int block = blockRow * maze.cols + blockCol;
+    int tile = row * maze.cols + col;
+    if (block == tile || maze.disc[block] < 0 || maze.disc[tile] < 0) return false;
+    // Tile di luar subtree 'block' tetap bisa naik ke sink lewat leluhurnya sendiri.
+    if (maze.disc[tile] < maze.disc[block] || maze.disc[tile] > maze.last[block]) return false;
+
+    for (int d = 0; d < 4; d++) {
+        int childRow = blockRow + dyMaze[d];
+        int childCol = blockCol + dxMaze[d];
+        if (!InsideMaze(childRow, childCol)) continue;
+        int child = childRow * maze.cols + childCol;
+        if (maze.disc[child] < 0 || maze.parent[child] != block) continue;
+        if (maze.disc[tile] >= maze.disc[child] && maze.disc[tile] <= maze.last[child]) {
+            return maze.low[child] >= maze.disc[block];
+        }
+    }
+    return false;
+}
+
+/* I.S. : Modul mungkin memiliki buffer analisis.
+   F.S. : Buffer dibebaskan dan mode labirin tidak aktif. */
+void Maze_Clear(void) {
+    FreeAnalysis();
+    maze.mazeMode = false;
+    maze.spawnCount = 0;
+}
@@ -0,0 +1,256 @@
+/* File        : memory_tracker.c
+* Deskripsi   : Implementasi untuk modul Memory Tracker.
+*               Setiap blok heap diawali header 16 byte berisi ukuran, tag, dan penanda
+*               (magic) sehingga Memory_Free tahu tag pemiliknya tanpa tabel pencarian.
+*               Tekstur dicatat berdasarkan id OpenGL, sound berdasarkan buffer audionya;
+*               keduanya disimpan di array statis kecil karena jumlahnya sedikit.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "memory_tracker.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MEMORY_HEADER_SIZE 16
+#define MEMORY_MAGIC 0x4D454D54u
+
+/* Header di depan setiap blok. Ukurannya tetap 16 byte agar alignment pointer
+   yang dikembalikan sama dengan milik malloc. */
+typedef union {
+    struct {
+        size_t size;
+        uint32_t magic;
+        uint16_t tag;
+    } info;
+    unsigned char raw[MEMORY_HEADER_SIZE];
+} MemoryHeader;
+
+/* Satu aset (tekstur atau sound) yang tercatat. */
+typedef struct {
+    const void *key;
+    size_t bytes;
+    MemoryTag tag;
+    bool used;
+} TrackedAsset;
+
+static const char *tagNames[MEM_TAG_COUNT] = {
+    "enemy",
+    "tower",
+    "wave",
+    "upgrade",
+    "editor",
+    "audio",
+    "map",
+    "other"
+};
+
+static MemoryStats heapStats[MEM_TAG_COUNT];
+static MemoryStats assetStats[MEM_TAG_COUNT];
+static TrackedAsset trackedTextures[MEMORY_MAX_TRACKED_TEXTURES];
+static TrackedAsset trackedSounds[MEMORY_MAX_TRACKED_SOUNDS];
+
+// Menambahkan 'bytes' ke statistik 'stats' untuk satu alokasi baru.
+static void RecordAlloc(MemoryStats *stats, size_t bytes) {
+    stats->liveBytes += bytes;
+    stats->liveCount++;
+    stats->totalAllocs++;
+    if (stats->liveBytes > stats->peakBytes) stats->peakBytes = stats->liveBytes;
+}
+
+// Mengurangi 'bytes' dari statistik 'stats' untuk satu pembebasan.
+static void RecordFree(MemoryStats *stats, size_t bytes) {
+    stats->liveBytes -= bytes;
+    stats->liveCount--;
+    stats->totalFrees++;
+}
+
+// Mengembalikan 'tag' yang valid; tag di luar rentang dicatat sebagai MEM_TAG_OTHER.
+static MemoryTag ClampTag(MemoryTag tag) {
+    return (tag >= 0 && tag < MEM_TAG_COUNT) ? tag : MEM_TAG_OTHER;
+}
+
+// Mengisi header pada 'base' dan mengembalikan pointer untuk pemanggil.
+static void *TrackBlock(void *base, MemoryTag tag, size_t size) {
+    if (base == NULL) return NULL;
+    MemoryHeader *header = (MemoryHeader *)base;
+    header->info.size = size;
+    header->info.magic = MEMORY_MAGIC;
+    header->info.tag = (uint16_t)tag;
+    RecordAlloc(&heapStats[tag], size);
+    return (unsigned char *)base + MEMORY_HEADER_SIZE;
+}
+
+// Mengembalikan header milik 'ptr', atau NULL jika 'ptr' bukan blok dari modul ini.
+static MemoryHeader *GetHeader(void *ptr) {
+    MemoryHeader *header = (MemoryHeader *)((unsigned char *)ptr - MEMORY_HEADER_SIZE);
+    return header->info.magic == MEMORY_MAGIC ? header : NULL;
+}
+
+/* I.S. : Sembarang.
+   F.S. : Mengembalikan blok berukuran 'size' byte yang dicatat atas nama 'tag',
+          atau NULL jika alokasi gagal. Blok harus dibebaskan dengan Memory_Free. */
+void *Memory_Alloc(MemoryTag tag, size_t size) {
+    if (size > SIZE_MAX - MEMORY_HEADER_SIZE) return NULL;
+    return TrackBlock(malloc(size + MEMORY_HEADER_SIZE), ClampTag(tag), size);
+}
+
+/* I.S. : Sembarang.
+   F.S. : Sama seperti Memory_Alloc, tetapi untuk 'count' elemen berukuran 'size'
+          dan isinya diinisialisasi nol. */
+void *Memory_Calloc(MemoryTag tag, size_t count, size_t size) {
+    if (size != 0 && count > (SIZE_MAX - MEMORY_HEADER_SIZE) / size) return NULL;
+    size_t bytes = count * size;
+    return TrackBlock(calloc(1, bytes + MEMORY_HEADER_SIZE), ClampTag(tag), bytes);
+}
+
+/* I.S. : 'ptr' NULL atau blok dari Memory_Alloc/Calloc/Realloc.
+   F.S. : Blok diubah ukurannya menjadi 'size' byte dan dicatat atas nama 'tag'.
+          Jika gagal, mengembalikan NULL dan blok lama tetap utuh. */
+void *Memory_Realloc(MemoryTag tag, void *ptr, size_t size) {
+    if (ptr == NULL) return Memory_Alloc(tag, size);
+    if (size > SIZE_MAX - MEMORY_HEADER_SIZE) return NULL;
+
+    MemoryHeader *header = GetHeader(ptr);
+    if (header == NULL) {
+        TraceLog(LOG_ERROR, "MEMORY: Memory_Realloc called on a block it did not allocate.");
+        return NULL;
+    }
+    MemoryTag oldTag = (MemoryTag)header->info.tag;
+    size_t oldSize = header->info.size;
+
+    void *base = realloc(header, size + MEMORY_HEADER_SIZE);
+    if (base == NULL) return NULL;
+
+    // Realloc dihitung sebagai pembebasan blok lama dan alokasi blok baru.
+    RecordFree(&heapStats[oldTag], oldSize);
+    return TrackBlock(base, ClampTag(tag), size);
+}
+
+/* I.S. : 'ptr' NULL atau blok dari Memory_Alloc/Calloc/Realloc/StrDup.
+   F.S. : Blok dibebaskan dan statistik tag pemiliknya diperbarui. */
+void Memory_Free(void *ptr) {
+    if (ptr == NULL) return;
+
+    MemoryHeader *header = GetHeader(ptr);
+    if (header == NULL) {
+        TraceLog(LOG_ERROR, "MEMORY: Memory_Free called on a block it did not allocate.");
+        return;
+    }
+    RecordFree(&heapStats[header->info.tag], header->info.size);
+    header->info.magic = 0;
+    free(header);
+}
+
+/* Mengirimkan salinan 'text' yang dialokasikan atas nama 'tag' (bebaskan dengan Memory_Free). */
+char *Memory_StrDup(MemoryTag tag, const char *text) {
+    if (text == NULL) return NULL;
+    size_t length = strlen(text) + 1;
+    char *copy = (char *)Memory_Alloc(tag, length);
+    if (copy != NULL) memcpy(copy, text, length);
+    return copy;
+}
+
+// Mencatat aset 'key' berukuran 'bytes' ke 'table'.
+static void TrackAsset(TrackedAsset *table, int capacity, const void *key, size_t bytes, MemoryTag tag) {
+    tag = ClampTag(tag);
+    for (int i = 0; i < capacity; i++) {
+        if (!table[i].used) {
+            table[i] = (TrackedAsset){ key, bytes, tag, true };
+            RecordAlloc(&assetStats[tag], bytes);
+            return;
+        }
+    }
+    TraceLog(LOG_WARNING, "MEMORY: Asset registry full (%d entries); asset not tracked.", capacity);
+}
+
+// Menghapus aset 'key' dari 'table'. Aset yang tidak tercatat diabaikan.
+static void UntrackAsset(TrackedAsset *table, int capacity, const void *key) {
+    for (int i = 0; i < capacity; i++) {
+        if (table[i].used && table[i].key == key) {
+            RecordFree(&assetStats[table[i].tag], table[i].bytes);
+            table[i].used = false;
+            return;
+        }
+    }
+}
+
+/* I.S. : 'texture' baru saja dimuat.
+   F.S. : Ukuran data piksel 'texture' dicatat atas nama 'tag'. */
+void Memory_TrackTexture(MemoryTag tag, Texture2D texture) {
+    if (texture.id == 0) return;
+    size_t bytes = (size_t)GetPixelDataSize(texture.width, texture.height, texture.format);
+    TrackAsset(trackedTextures, MEMORY_MAX_TRACKED_TEXTURES, (const void *)(uintptr_t)texture.id, bytes, tag);
+}
+
+/* I.S. : 'texture' akan di-unload.
+   F.S. : Catatan 'texture' dihapus dari registri. */
+void Memory_UntrackTexture(Texture2D texture) {
+    if (texture.id == 0) return;
+    UntrackAsset(trackedTextures, MEMORY_MAX_TRACKED_TEXTURES, (const void *)(uintptr_t)texture.id);
+}
+
+/* I.S. : 'sound' baru saja dimuat.
+   F.S. : Ukuran sampel 'sound' dicatat atas nama 'tag'. */
+void Memory_TrackSound(MemoryTag tag, Sound sound) {
+    if (sound.stream.buffer == NULL) return;
+    size_t bytes = (size_t)sound.frameCount * sound.stream.channels * (sound.stream.sampleSize / 8);
+    TrackAsset(trackedSounds, MEMORY_MAX_TRACKED_SOUNDS, sound.stream.buffer, bytes, tag);
+}
+
+/* I.S. : 'sound' akan di-unload.
+   F.S. : Catatan 'sound' dihapus dari registri. */
+void Memory_UntrackSound(Sound sound) {
+    if (sound.stream.buffer == NULL) return;
+    UntrackAsset(trackedSounds, MEMORY_MAX_TRACKED_SOUNDS, sound.stream.buffer);
+}
+
+/* Mengirimkan statistik heap untuk 'tag'. */
+MemoryStats Memory_GetHeapStats(MemoryTag tag) {
+    return heapStats[ClampTag(tag)];
+}
+
+/* Mengirimkan statistik aset (tekstur dan sound) untuk 'tag'. */
+MemoryStats Memory_GetAssetStats(MemoryTag tag) {
+    return assetStats[ClampTag(tag)];
+}
+
+/* Mengirimkan nama 'tag' untuk ditampilkan. */
+const char *Memory_GetTagName(MemoryTag tag) {
+    return tagNames[ClampTag(tag)];
+}
+
+/* I.S. : Sembarang.
+   F.S. : Ringkasan statistik heap dan aset per tag ditulis ke log dengan label 'context'. */
+void Memory_LogReport(const char *context) {
+    TraceLog(LOG_INFO, "MEMORY: Report (%s): tag | heap live/peak KiB, live blocks, allocs/frees | assets live/peak KiB, live assets", context);
+    for (int t = 0; t < MEM_TAG_COUNT; t++) {
+        const MemoryStats *heap = &heapStats[t];
+        const MemoryStats *asset = &assetStats[t];
+        TraceLog(LOG_INFO, "MEMORY:   %-8s | %9.1f / %9.1f, %5d, %7d / %7d | %9.1f / %9.1f, %4d",
+                 tagNames[t], heap->liveBytes / 1024.0, heap->peakBytes / 1024.0, heap->liveCount,
+                 heap->totalAllocs, heap->totalFrees,
+                 asset->liveBytes / 1024.0, asset->peakBytes / 1024.0, asset->liveCount);
+    }
+}
+
+/* I.S. : Sedang di dalam BeginDrawing/EndDrawing.
+   F.S. : Tabel statistik per tag digambar mulai dari (x, y). Mengembalikan tinggi tabel. */
+int DrawMemoryTable(int x, int y, int fontSize, int lineHeight) {
+    int textY = y;
+    DrawText("memory", x + 20, textY, fontSize, LIGHTGRAY);
+    DrawText("heap KiB", x + 160, textY, fontSize, LIGHTGRAY);
+    DrawText("peak", x + 280, textY, fontSize, LIGHTGRAY);
+    DrawText("blocks", x + 380, textY, fontSize, LIGHTGRAY);
+    DrawText("asset KiB", x + 480, textY, fontSize, LIGHTGRAY);
+    for (int t = 0; t < MEM_TAG_COUNT; t++) {
+        textY += lineHeight;
+        DrawText(tagNames[t], x + 20, textY, fontSize, RAYWHITE);
+        DrawText(TextFormat("%8.1f", heapStats[t].liveBytes / 1024.0), x + 160, textY, fontSize, RAYWHITE);
+        DrawText(TextFormat("%8.1f", heapStats[t].peakBytes / 1024.0), x + 280, textY, fontSize, RAYWHITE);
+        DrawText(TextFormat("%6d", heapStats[t].liveCount), x + 380, textY, fontSize, RAYWHITE);
+        DrawText(TextFormat("%8.1f", assetStats[t].liveBytes / 1024.0), x + 480, textY, fontSize, RAYWHITE);
+    }
+    return textY + lineHeight - y;
+}
@@ -0,0 +1,443 @@
+/* File        : path_cache.c
+* Deskripsi   : Implementasi untuk modul Path Cache.
+*               Cache berupa array kecil berukuran tetap. Setiap entri adalah satu tabel rute
+*               yang dikenali dari revisi gameMap dan daftar titik awalnya; entri dari revisi
+*               lama dibebaskan begitu tidak ada wave yang memakainya lagi.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "path_cache.h"
+#include "map.h"
+#include "memory_tracker.h"
+#include "trace.h"
+#include <math.h>
+#include <string.h>
+
+static const int dxPath[] = {0, 1, 0, -1};
+static const int dyPath[] = {-1, 0, 1, 0};
+
+static RouteTable cacheEntries[PATH_CACHE_MAX_ENTRIES];
+static bool cacheUsed[PATH_CACHE_MAX_ENTRIES];
+
+/* Satu frame pada stack penelusuran depth-first: tile dan arah berikutnya yang dicoba. */
+typedef struct {
+    int tile;           // row * cols + col
+    int nextDir;
+} RouteFrame;
+
+/* State sementara selama BuildRouteTable. */
+typedef struct {
+    RouteTable *table;
+    int poolCapacity;
+    int routeCapacity;
+    bool *onRoute;      // Tile yang ada di rute yang sedang ditelusuri
+    RouteFrame *stack;
+    int rows;
+    int cols;
+} RouteBuilder;
+
+// Mengirimkan true jika tile (row, col) pada gameMap adalah jalan musuh.
+static bool IsPathTile(int row, int col) {
+    return GetMapTile(row, col) == 1;
+}
+
+// Mengirimkan titik pusat tile 'tile' dalam koordinat dunia.
+static Vector2 TileCenter(int tile, int cols) {
+    return (Vector2){ (tile % cols) * (float)TILE_SIZE + TILE_SIZE / 2.0f,
+                      (tile / cols) * (float)TILE_SIZE + TILE_SIZE / 2.0f };
+}
+
+// Menambahkan tile di stack sebagai satu rute baru milik 'spawnIndex'.
+// Nilai pengembalian: false jika alokasi gagal.
+static bool EmitRoute(RouteBuilder *builder, int spawnIndex, int depth) {
+    RouteTable *table = builder->table;
+    if (table->poolCount + depth > builder->poolCapacity) {
+        int newCapacity = builder->poolCapacity > 0 ? builder->poolCapacity * 2 : 256;
+        while (newCapacity < table->poolCount + depth) newCapacity *= 2;
+        Vector2 *newPool = (Vector2 *)Memory_Realloc(MEM_TAG_WAVE, table->pointPool, sizeof(Vector2) * newCapacity);
+        if (newPool == NULL) {
+            TraceLog(LOG_ERROR, "PATH_CACHE: Failed to grow route point pool to %d points.", newCapacity);
+            return false;
+        }
+        table->pointPool = newPool;
+        builder->poolCapacity = newCapacity;
+    }
+    if (table->routeCount >= builder->routeCapacity) {
+        int newCapacity = builder->routeCapacity > 0 ? builder->routeCapacity * 2 : 8;
+        MapPath *newRoutes = (MapPath *)Memory_Realloc(MEM_TAG_WAVE, table->routes, sizeof(MapPath) * newCapacity);
+        if (newRoutes == NULL) {
+            TraceLog(LOG_ERROR, "PATH_CACHE: Failed to grow route table to %d routes.", newCapacity);
+            return false;
+        }
+        table->routes = newRoutes;
+        builder->routeCapacity = newCapacity;
+    }
+
+    for (int i = 0; i < depth; i++) {
+        table->pointPool[table->poolCount + i] = TileCenter(builder->stack[i].tile, builder->cols);
+    }
+    // Pointer ke pool baru diisi di FinalizeRoutes karena pool masih bisa dipindah oleh realloc.
+    table->routes[table->routeCount++] = (MapPath){ .count = depth, .spawnIndex = spawnIndex };
+    table->poolCount += depth;
+    return true;
+}
+
+// Menelusuri semua rute dari titik awal 'spawnIndex' secara depth-first tanpa rekursi.
+// Penelusuran berhenti di tile exit (IsGridExitTile) dan setiap exit yang dicapai menjadi ujung
+// satu rute; cabang yang buntu sebelum mencapai exit tidak menghasilkan rute. Tile dilepas dari
+// 'onRoute' saat backtrack sehingga cabang yang bertemu lagi tetap menghasilkan rute terpisah.
+// Nilai pengembalian: false jika alokasi gagal.
+static bool EnumerateSpawnRoutes(RouteBuilder *builder, int spawnIndex) {
+    RouteTable *table = builder->table;
+    SpawnPoint spawn = table->spawns[spawnIndex];
+    int cols = builder->cols;
+    int firstRoute = table->routeCount;
+    table->spawnFirstRoute[spawnIndex] = firstRoute;
+    table->spawnRouteCount[spawnIndex] = 0;
+
+    if (!IsInsideGrid(&gameMap, spawn.row, spawn.col) || !IsPathTile(spawn.row, spawn.col)) {
+        TraceLog(LOG_ERROR, "Pathfinding failed: Start point (%d, %d) is not a valid path tile.", spawn.col, spawn.row);
+        return true;
+    }
+
+    // Batas langkah mencegah ledakan kombinasi pada area jalan yang lebar atau berputar.
+    long stepBudget = (long)builder->rows * cols * ROUTE_TABLE_MAX_ROUTES_PER_SPAWN;
+    bool ok = true;
+    int depth = 0;
+    builder->stack[depth++] = (RouteFrame){ spawn.row * cols + spawn.col, 0 };
+    builder->onRoute[spawn.row * cols + spawn.col] = true;
+
+    while (depth > 0) {
+        RouteFrame *top = &builder->stack[depth - 1];
+        int row = top->tile / cols;
+        int col = top->tile % cols;
+
+        bool atExit = IsGridExitTile(&gameMap, table->spawns, table->spawnCount, row, col);
+        bool pushed = false;
+        while (!atExit && top->nextDir < 4) {
+            int d = top->nextDir++;
+            int nextRow = row + dyPath[d];
+            int nextCol = col + dxPath[d];
+            if (IsPathTile(nextRow, nextCol) && !builder->onRoute[nextRow * cols + nextCol]) {
+                builder->stack[depth++] = (RouteFrame){ nextRow * cols + nextCol, 0 };
+                builder->onRoute[nextRow * cols + nextCol] = true;
+                pushed = true;
+                break;
+            }
+        }
+        if (pushed) {
+            if (--stepBudget <= 0) {
+                TraceLog(LOG_WARNING, "PATH_CACHE: Route search from (%d, %d) hit its step limit; keeping %d routes.",
+                         spawn.col, spawn.row, table->routeCount - firstRoute);
+                break;
+            }
+            continue;
+        }
+
+        if (atExit) {
+            if (!EmitRoute(builder, spawnIndex, depth)) {
+                ok = false;
+                break;
+            }
+            if (table->routeCount - firstRoute >= ROUTE_TABLE_MAX_ROUTES_PER_SPAWN) {
+                TraceLog(LOG_WARNING, "PATH_CACHE: Spawn (%d, %d) has more than %d routes; extra branches ignored.",
+                         spawn.col, spawn.row, ROUTE_TABLE_MAX_ROUTES_PER_SPAWN);
+                break;
+            }
+        }
+        builder->onRoute[top->tile] = false;
+        depth--;
+    }
+    for (int i = 0; i < depth; i++) builder->onRoute[builder->stack[i].tile] = false;
+
+    table->spawnRouteCount[spawnIndex] = table->routeCount - firstRoute;
+    return ok;
+}
+
+// Menyusutkan tabel rute ke ukuran akhirnya, mengisi pointer setiap rute ke pool, dan
+// menghitung panjang kumulatif serta arah satuan setiap segmen.
+// Nilai pengembalian: false jika alokasi gagal.
+static bool FinalizeRoutes(RouteTable *table) {
+    MapPath *routes = (MapPath *)Memory_Realloc(MEM_TAG_WAVE, table->routes, sizeof(MapPath) * table->routeCount);
+    Vector2 *points = (Vector2 *)Memory_Realloc(MEM_TAG_WAVE, table->pointPool, sizeof(Vector2) * table->poolCount);
+    if (routes) table->routes = routes;
+    if (points) table->pointPool = points;
+    table->lengthPool = (float *)Memory_Alloc(MEM_TAG_WAVE, sizeof(float) * table->poolCount);
+    table->directionPool = (Vector2 *)Memory_Alloc(MEM_TAG_WAVE, sizeof(Vector2) * table->poolCount);
+    if (!routes || !points || !table->lengthPool || !table->directionPool) return false;
+
+    int offset = 0;
+    for (int r = 0; r < table->routeCount; r++) {
+        MapPath *route = &table->routes[r];
+        route->points = table->pointPool + offset;
+        route->cumulativeLengths = table->lengthPool + offset;
+        route->directions = table->directionPool + offset;
+        offset += route->count;
+
+        float total = 0.0f;
+        route->cumulativeLengths[0] = 0.0f;
+        for (int i = 0; i < route->count - 1; i++) {
+            float dx = route->points[i + 1].x - route->points[i].x;
+            float dy = route->points[i + 1].y - route->points[i].y;
+            float length = sqrtf(dx * dx + dy * dy);
+            route->directions[i] = length > 0.0f ? (Vector2){ dx / length, dy / length } : (Vector2){ 0.0f, 0.0f };
+            total += length;
+            route->cumulativeLengths[i + 1] = total;
+        }
+        route->totalLength = total;
+    }
+    return true;
+}
+
+// Membebaskan semua buffer 'table' tanpa menghapus kunci cache (titik awal dan revisi).
+static void ReleaseRouteBuffers(RouteTable *table) {
+    Memory_Free(table->routes);
+    Memory_Free(table->pointPool);
+    Memory_Free(table->lengthPool);
+    Memory_Free(table->directionPool);
+    table->routes = NULL;
+    table->pointPool = NULL;
+    table->lengthPool = NULL;
+    table->directionPool = NULL;
+    table->routeCount = 0;
+    table->poolCount = 0;
+    for (int i = 0; i < MAX_SPAWN_POINTS; i++) {
+        table->spawnFirstRoute[i] = 0;
+        table->spawnRouteCount[i] = 0;
+    }
+}
+
+/* I.S. : 'table' kosong atau berisi tabel lama.
+   F.S. : 'table' berisi semua rute pada gameMap dari 'spawns'. Dari setiap titik awal, jalan
+          ditelusuri secara depth-first dengan urutan arah atas, kanan, bawah, kiri; setiap
+          cabang yang mencapai tile exit (IsGridExitTile, aturan yang sama dengan validator
+          editor) menghasilkan satu rute yang berakhir di exit tersebut. Cabang yang buntu di
+          tengah peta tidak menghasilkan rute. Titik awal yang bukan tile jalan atau tidak
+          terhubung ke exit tidak memiliki rute. Buffer lama dibebaskan.
+          Mengembalikan false jika tidak ada rute sama sekali atau alokasi gagal. */
+bool BuildRouteTable(RouteTable *table, const SpawnPoint *spawns, int spawnCount) {
+    TRACE_BEGIN("BuildRouteTable");
+    ReleaseRouteBuffers(table);
+    if (spawnCount > MAX_SPAWN_POINTS) {
+        TraceLog(LOG_WARNING, "PATH_CACHE: %d spawn points given; only the first %d are used.", spawnCount, MAX_SPAWN_POINTS);
+        spawnCount = MAX_SPAWN_POINTS;
+    }
+    table->spawnCount = spawnCount > 0 ? spawnCount : 0;
+    for (int i = 0; i < table->spawnCount; i++) table->spawns[i] = spawns[i];
+    table->mapRevision = GetMapRevision();
+
+    RouteBuilder builder = { .table = table, .rows = GetMapRows(), .cols = GetMapCols() };
+    size_t cells = (size_t)builder.rows * builder.cols;
+    builder.onRoute = (bool *)Memory_Calloc(MEM_TAG_WAVE, cells, sizeof(bool));
+    builder.stack = (RouteFrame *)Memory_Alloc(MEM_TAG_WAVE, sizeof(RouteFrame) * cells);
+    bool ok = builder.onRoute != NULL && builder.stack != NULL;
+    if (!ok) {
+        TraceLog(LOG_ERROR, "Pathfinding failed: Could not allocate search buffers (%d x %d).", builder.rows, builder.cols);
+    }
+
+    for (int s = 0; ok && s < table->spawnCount; s++) {
+        ok = EnumerateSpawnRoutes(&builder, s);
+        if (ok) {
+            TraceLog(LOG_INFO, "PATH_CACHE: Spawn (%d, %d) has %d route(s).",
+                     table->spawns[s].col, table->spawns[s].row, table->spawnRouteCount[s]);
+        }
+    }
+    Memory_Free(builder.onRoute);
+    Memory_Free(builder.stack);
+
+    if (ok && table->routeCount > 0 && !FinalizeRoutes(table)) {
+        TraceLog(LOG_ERROR, "PATH_CACHE: Failed to allocate arc-length tables for %d points.", table->poolCount);
+        ok = false;
+    }
+    if (!ok || table->routeCount == 0) {
+        ReleaseRouteBuffers(table);
+        TraceLog(LOG_WARNING, "Pathfinding failed to build any route from %d spawn point(s).", table->spawnCount);
+        TRACE_END("BuildRouteTable");
+        return false;
+    }
+
+    TraceLog(LOG_INFO, "Route table built: %d route(s), %d points from %d spawn point(s).",
+             table->routeCount, table->poolCount, table->spawnCount);
+    TRACE_END("BuildRouteTable");
+    return true;
+}
+
+/* I.S. : 'table' mungkin memiliki buffer yang dialokasikan.
+   F.S. : Buffer 'table' dibebaskan dan 'table' menjadi kosong. */
+void FreeRouteTable(RouteTable *table) {
+    ReleaseRouteBuffers(table);
+    *table = (RouteTable){0};
+}
+
+/* Mengirimkan rute dengan id 'routeId' dari 'table', atau NULL jika id tidak valid. */
+const MapPath *GetRoute(const RouteTable *table, int routeId) {
+    if (table == NULL || routeId < 0 || routeId >= table->routeCount) return NULL;
+    return &table->routes[routeId];
+}
+
+/* Mengirimkan id rute ke-'ordinal' (dibungkus modulo jumlah rute) milik titik awal
+   'spawnIndex' (dibungkus modulo jumlah titik awal). Titik awal tanpa rute dilewati ke
+   titik awal berikutnya. Mengirimkan -1 jika tabel kosong. */
+int GetSpawnRouteId(const RouteTable *table, int spawnIndex, int ordinal) {
+    if (table == NULL || table->routeCount == 0 || table->spawnCount == 0) return -1;
+    if (spawnIndex < 0) spawnIndex = 0;
+    if (ordinal < 0) ordinal = 0;
+    for (int i = 0; i < table->spawnCount; i++) {
+        int s = (spawnIndex + i) % table->spawnCount;
+        if (table->spawnRouteCount[s] > 0) {
+            return table->spawnFirstRoute[s] + ordinal % table->spawnRouteCount[s];
+        }
+    }
+    return -1;
+}
+
+/* I.S. : 'path' memiliki minimal dua titik; '*segmentHint' adalah segmen hasil pemanggilan
+          sebelumnya untuk musuh yang sama (atau 0).
+   F.S. : Mengembalikan posisi pada jarak 'distance' dari titik awal (dibatasi ke ujung jalur).
+          '*segmentHint' diperbarui ke segmen yang memuat posisi tersebut. Jika jarak hanya
+          maju sedikit, pencarian cukup melangkah dari petunjuk; jika tidak, memakai binary search. */
+Vector2 GetMapPathPosition(const MapPath *path, float distance, int *segmentHint) {
+    const float *lengths = path->cumulativeLengths;
+    int lastSegment = path->count - 2;
+    if (distance <= 0.0f) {
+        *segmentHint = 0;
+        return path->points[0];
+    }
+    if (distance >= path->totalLength) {
+        *segmentHint = lastSegment;
+        return path->points[path->count - 1];
+    }
+
+    int s = *segmentHint;
+    if (s < 0 || s > lastSegment || distance < lengths[s]) {
+        // Petunjuk tidak dapat dipakai: cari segmen terakhir dengan lengths[s] <= distance.
+        int low = 0;
+        int high = lastSegment;
+        while (low < high) {
+            int mid = (low + high + 1) / 2;
+            if (lengths[mid] <= distance) low = mid;
+            else high = mid - 1;
+        }
+        s = low;
+    } else {
+        // Dalam satu frame musuh biasanya tetap di segmen yang sama atau maju satu segmen.
+        while (s < lastSegment && distance >= lengths[s + 1]) s++;
+    }
+    *segmentHint = s;
+
+    float along = distance - lengths[s];
+    return (Vector2){ path->points[s].x + path->directions[s].x * along,
+                      path->points[s].y + path->directions[s].y * along };
+}
+
+// Membebaskan entri cache ke-'index'.
+static void EvictEntry(int index) {
+    FreeRouteTable(&cacheEntries[index]);
+    cacheUsed[index] = false;
+}
+
+// Mengirimkan true jika 'table' dibangun dari daftar titik awal yang sama dengan 'spawns'.
+static bool SameSpawns(const RouteTable *table, const SpawnPoint *spawns, int spawnCount) {
+    if (spawnCount > MAX_SPAWN_POINTS) spawnCount = MAX_SPAWN_POINTS;
+    if (table->spawnCount != spawnCount) return false;
+    for (int i = 0; i < spawnCount; i++) {
+        if (table->spawns[i].row != spawns[i].row || table->spawns[i].col != spawns[i].col) return false;
+    }
+    return true;
+}
+
+// Mengembalikan indeks entri untuk 'spawns' pada revisi 'revision', atau -1.
+static int FindEntry(const SpawnPoint *spawns, int spawnCount, unsigned int revision) {
+    for (int i = 0; i < PATH_CACHE_MAX_ENTRIES; i++) {
+        if (cacheUsed[i] && cacheEntries[i].mapRevision == revision &&
+            SameSpawns(&cacheEntries[i], spawns, spawnCount)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Mengembalikan indeks entri yang boleh ditimpa: slot kosong, lalu entri revisi lama,
+// lalu entri mana pun yang tidak sedang dipakai. Mengembalikan -1 jika semua dipakai.
+static int FindFreeEntry(unsigned int revision) {
+    int fallback = -1;
+    for (int i = 0; i < PATH_CACHE_MAX_ENTRIES; i++) {
+        if (!cacheUsed[i]) return i;
+        if (cacheEntries[i].refCount > 0) continue;
+        if (cacheEntries[i].mapRevision != revision) return i;
+        if (fallback == -1) fallback = i;
+    }
+    return fallback;
+}
+
+// Mengembalikan indeks entri untuk 'spawns' pada revisi peta saat ini,
+// membangunnya jika belum ada. Mengembalikan -1 jika cache penuh.
+static int LookupOrBuild(const SpawnPoint *spawns, int spawnCount) {
+    unsigned int revision = GetMapRevision();
+    int index = FindEntry(spawns, spawnCount, revision);
+    if (index != -1) return index;
+
+    index = FindFreeEntry(revision);
+    if (index == -1) {
+        TraceLog(LOG_ERROR, "PATH_CACHE: All %d entries are in use; cannot build routes for %d spawn point(s).",
+                 PATH_CACHE_MAX_ENTRIES, spawnCount);
+        return -1;
+    }
+
+    // Tabel yang gagal dibangun tetap disimpan (tanpa rute) agar wave berikutnya
+    // tidak menelusuri peta lagi.
+    RouteTable *entry = &cacheEntries[index];
+    entry->refCount = 0;
+    cacheUsed[index] = true;
+    BuildRouteTable(entry, spawns, spawnCount);
+    return index;
+}
+
+/* I.S. : Cache mungkin sudah berisi tabel rute untuk revisi peta saat ini.
+   F.S. : Mengembalikan handle tabel rute dari 'spawns' untuk revisi gameMap saat ini;
+          tabel dibangun jika belum ada di cache. Jumlah referensinya bertambah satu.
+          Mengembalikan NULL jika cache penuh oleh tabel yang masih dipakai.
+          Handle tetap valid sampai dilepas dengan PathCache_Release, walaupun peta berubah. */
+const RouteTable *PathCache_Acquire(const SpawnPoint *spawns, int spawnCount) {
+    int index = LookupOrBuild(spawns, spawnCount);
+    if (index == -1) return NULL;
+    cacheEntries[index].refCount++;
+    return &cacheEntries[index];
+}
+
+/* I.S. : 'table' adalah handle dari PathCache_Acquire atau NULL.
+   F.S. : Jumlah referensi 'table' berkurang satu. Tabel tetap di cache untuk dipakai ulang
+          sampai revisi peta berubah. */
+void PathCache_Release(const RouteTable *table) {
+    if (table == NULL) return;
+    int index = (int)(table - cacheEntries);
+    if (index < 0 || index >= PATH_CACHE_MAX_ENTRIES || !cacheUsed[index]) {
+        TraceLog(LOG_WARNING, "PATH_CACHE: Release called with a handle that is not in the cache.");
+        return;
+    }
+
+    RouteTable *entry = &cacheEntries[index];
+    if (entry->refCount > 0) entry->refCount--;
+    if (entry->refCount == 0 && entry->mapRevision != GetMapRevision()) {
+        EvictEntry(index);
+    }
+}
+
+/* I.S. : Cache berisi tabel rute sembarang.
+   F.S. : Tabel rute dari 'spawns' untuk revisi peta saat ini sudah ada di cache.
+          Mengembalikan jumlah rute di tabel tersebut (0 jika tidak ada rute yang valid). */
+int PathCache_Prepare(const SpawnPoint *spawns, int spawnCount) {
+    int index = LookupOrBuild(spawns, spawnCount);
+    return index == -1 ? 0 : cacheEntries[index].routeCount;
+}
+
+/* I.S. : Cache berisi tabel rute sembarang.
+   F.S. : Semua tabel yang tidak sedang dipakai dibebaskan. */
+void PathCache_Clear(void) {
+    for (int i = 0; i < PATH_CACHE_MAX_ENTRIES; i++) {
+        if (cacheUsed[i] && cacheEntries[i].refCount == 0) {
+            EvictEntry(i);
+        }
+    }
+}
@@ -0,0 +1,330 @@
+/* File        : path_validator.c
+* Deskripsi   : Implementasi untuk modul Path Validator.
+*               LPA* berjalan mundur: semua tile exit memiliki rhs 0 dan titik awal menjadi
+*               tujuan. g adalah jarak yang sudah diselesaikan, rhs adalah jarak satu langkah dari
+*               g tetangga. Tile dengan g != rhs (tidak konsisten) berada di antrian prioritas
+*               dengan kunci [min(g, rhs) + h, min(g, rhs)], dengan h jarak Manhattan ke titik awal
+*               terdekat. Pencarian berhenti begitu semua titik awal konsisten dan tidak ada kunci
+*               yang lebih kecil dari kunci titik awal, sehingga tile yang jauh dari rute tidak
+*               pernah disentuh. Perubahan satu tile cukup memperbarui rhs tile itu dan tetangganya.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "path_validator.h"
+#include "memory_tracker.h"
+#include "trace.h"
+#include <stdlib.h>
+
+#define INF PATH_VALIDATOR_UNREACHABLE
+
+static const int dxValidator[] = {0, 1, 0, -1};
+static const int dyValidator[] = {-1, 0, 1, 0};
+
+/* Entri antrian prioritas. Kunci dibandingkan secara leksikografis (k1, lalu k2). */
+typedef struct {
+    int k1;
+    int k2;
+    int tile;
+} ValidatorHeapEntry;
+
+static struct {
+    const TileGrid *grid;
+    int rows;
+    int cols;
+    SpawnPoint spawns[MAX_SPAWN_POINTS];
+    int spawnCount;
+    bool flowFieldMode;
+    int *g;
+    int *rhs;
+    int *heapIndex;                 // Posisi tile di heap, atau -1 jika tidak ada di antrian
+    ValidatorHeapEntry *heap;
+    int heapCount;
+} validator;
+
+// Mengirimkan true jika (row, col) berada di dalam grid validator.
+static bool InsideValidator(int row, int col) {
+    return row >= 0 && col >= 0 && row < validator.rows && col < validator.cols;
+}
+
+// Mengirimkan true jika tile (row, col) bisa dilewati pada mode yang sedang divalidasi.
+static bool IsValidatorWalkable(int row, int col) {
+    int tile = GRID_AT(validator.grid, row, col);
+    return tile == 1 || (validator.flowFieldMode && tile == 4);
+}
+
+// Mengirimkan true jika (row, col) adalah tile exit, dengan aturan yang sama seperti tabel rute gameplay.
+static bool IsValidatorExit(int row, int col) {
+    return IsGridExitTile(validator.grid, validator.spawns, validator.spawnCount, row, col);
+}
+
+// Mengirimkan jarak Manhattan dari 'tile' ke titik awal terdekat (heuristik yang konsisten).
+static int Heuristic(int tile) {
+    int row = tile / validator.cols;
+    int col = tile % validator.cols;
+    int best = INF;
+    for (int i = 0; i < validator.spawnCount; i++) {
+        int distance = abs(validator.spawns[i].row - row) + abs(validator.spawns[i].col - col);
+        if (distance < best) best = distance;
+    }
+    return best;
+}
+
+// Mengirimkan kunci antrian untuk 'tile'. Hanya dipanggil untuk tile yang tidak konsisten.
+static ValidatorHeapEntry CalculateKey(int tile) {
+    int best = validator.g[tile] < validator.rhs[tile] ? validator.g[tile] : validator.rhs[tile];
+    return (ValidatorHeapEntry){ best + Heuristic(tile), best, tile };
+}
+
+// Mengirimkan true jika kunci 'a' lebih kecil dari kunci 'b'.
+static bool KeyLess(ValidatorHeapEntry a, ValidatorHeapEntry b) {
+    return a.k1 < b.k1 || (a.k1 == b.k1 && a.k2 < b.k2);
+}
+
+// Menempatkan 'entry' di posisi 'i' heap dan mencatat posisinya.
+static void HeapPlace(int i, ValidatorHeapEntry entry) {
+    validator.heap[i] = entry;
+    validator.heapIndex[entry.tile] = i;
+}
+
+// Menggeser entri di posisi 'i' ke atas atau ke bawah sampai sifat heap terpenuhi.
+static void HeapRestore(int i) {
+    ValidatorHeapEntry entry = validator.heap[i];
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!KeyLess(entry, validator.heap[parent])) break;
+        HeapPlace(i, validator.heap[parent]);
+        i = parent;
+    }
+    while (true) {
+        int child = i * 2 + 1;
+        if (child >= validator.heapCount) break;
+        if (child + 1 < validator.heapCount && KeyLess(validator.heap[child + 1], validator.heap[child])) child++;
+        if (!KeyLess(validator.heap[child], entry)) break;
+        HeapPlace(i, validator.heap[child]);
+        i = child;
+    }
+    HeapPlace(i, entry);
+}
+
+// Mengeluarkan 'tile' dari antrian jika ada di dalamnya.
+static void HeapRemove(int tile) {
+    int i = validator.heapIndex[tile];
+    if (i < 0) return;
+    validator.heapIndex[tile] = -1;
+    validator.heapCount--;
+    if (i == validator.heapCount) return;
+    validator.heap[i] = validator.heap[validator.heapCount];
+    HeapRestore(i);
+}
+
+// Memasukkan 'tile' ke antrian, atau memperbarui kuncinya jika sudah ada.
+static void HeapUpsert(int tile) {
+    int i = validator.heapIndex[tile];
+    if (i < 0) i = validator.heapCount++;
+    validator.heap[i] = CalculateKey(tile);
+    HeapRestore(i);
+}
+
+// Menghitung ulang rhs 'tile' dari g tetangganya dan memperbarui keanggotaannya di antrian.
+static void UpdateTile(int tile) {
+    int row = tile / validator.cols;
+    int col = tile % validator.cols;
+    int rhs = INF;
+    if (IsValidatorExit(row, col)) {
+        rhs = 0;
+    } else if (IsValidatorWalkable(row, col)) {
+        for (int d = 0; d < 4; d++) {
+            int nextRow = row + dyValidator[d];
+            int nextCol = col + dxValidator[d];
+            if (!InsideValidator(nextRow, nextCol) || !IsValidatorWalkable(nextRow, nextCol)) continue;
+            int neighbour = validator.g[nextRow * validator.cols + nextCol];
+            if (neighbour != INF && neighbour + 1 < rhs) rhs = neighbour + 1;
+        }
+    }
+    validator.rhs[tile] = rhs;
+
+    if (validator.g[tile] != rhs) HeapUpsert(tile);
+    else HeapRemove(tile);
+}
+
+// Memanggil UpdateTile untuk semua tetangga 'tile' di dalam grid.
+static void UpdateNeighbours(int tile) {
+    int row = tile / validator.cols;
+    int col = tile % validator.cols;
+    for (int d = 0; d < 4; d++) {
+        int nextRow = row + dyValidator[d];
+        int nextCol = col + dxValidator[d];
+        if (InsideValidator(nextRow, nextCol)) UpdateTile(nextRow * validator.cols + nextCol);
+    }
+}
+
+// Mengirimkan true jika masih ada titik awal yang jaraknya belum pasti benar.
+static bool SpawnsNeedWork(void) {
+    if (validator.heapCount == 0) return false;
+    ValidatorHeapEntry top = validator.heap[0];
+    for (int i = 0; i < validator.spawnCount; i++) {
+        const SpawnPoint *spawn = &validator.spawns[i];
+        if (!InsideValidator(spawn->row, spawn->col)) continue;
+        int tile = spawn->row * validator.cols + spawn->col;
+        if (validator.g[tile] != validator.rhs[tile]) return true;
+        if (validator.g[tile] != INF && KeyLess(top, CalculateKey(tile))) return true;
+        // Titik awal yang tidak terhubung baru pasti setelah antrian habis.
+        if (validator.g[tile] == INF) return true;
+    }
+    return false;
+}
+
+// Memproses antrian sampai jarak semua titik awal benar (ComputeShortestPath pada LPA*).
+static void ComputeShortestPath(void) {
+    while (SpawnsNeedWork()) {
+        int tile = validator.heap[0].tile;
+        HeapRemove(tile);
+        if (validator.g[tile] > validator.rhs[tile]) {
+            validator.g[tile] = validator.rhs[tile];
+            UpdateNeighbours(tile);
+        } else {
+            validator.g[tile] = INF;
+            UpdateTile(tile);
+            UpdateNeighbours(tile);
+        }
+    }
+}
+
+/* I.S. : Validator mungkin berisi hasil untuk peta sebelumnya.
+   F.S. : Validator mengikuti 'grid' dengan titik awal 'spawns'. Tile jalan (1) bisa dilewati;
+          jika 'flowFieldMode' true, slot tower (4) juga bisa dilewati. Tile exit adalah tile
+          jalan di tepi peta yang bukan titik awal. Jarak setiap titik awal sudah dihitung.
+          'grid' harus tetap hidup selama validator dipakai.
+          Mengembalikan PathValidator_IsValid(), atau false jika alokasi gagal. */
+bool PathValidator_Rebuild(const TileGrid *grid, const SpawnPoint *spawns, int spawnCount, bool flowFieldMode) {
+    TRACE_BEGIN("PathValidator_Rebuild");
+    int cells = grid->rows * grid->cols;
+    if (cells <= 0) {
+        PathValidator_Free();
+        TRACE_END("PathValidator_Rebuild");
+        return false;
+    }
+    if (validator.g == NULL || validator.rows * validator.cols != cells) {
+        PathValidator_Free();
+        validator.g = (int *)Memory_Alloc(MEM_TAG_EDITOR, sizeof(int) * cells);
+        validator.rhs = (int *)Memory_Alloc(MEM_TAG_EDITOR, sizeof(int) * cells);
+        validator.heapIndex = (int *)Memory_Alloc(MEM_TAG_EDITOR, sizeof(int) * cells);
+        validator.heap = (ValidatorHeapEntry *)Memory_Alloc(MEM_TAG_EDITOR, sizeof(ValidatorHeapEntry) * cells);
+        if (validator.g == NULL || validator.rhs == NULL || validator.heapIndex == NULL || validator.heap == NULL) {
+            TraceLog(LOG_ERROR, "PATH_VALIDATOR: Failed to allocate buffers for %d x %d map.", grid->rows, grid->cols);
+            PathValidator_Free();
+            TRACE_END("PathValidator_Rebuild");
+            return false;
+        }
+    }
+
+    validator.grid = grid;
+    validator.rows = grid->rows;
+    validator.cols = grid->cols;
+    validator.flowFieldMode = flowFieldMode;
+    validator.spawnCount = spawnCount < MAX_SPAWN_POINTS ? spawnCount : MAX_SPAWN_POINTS;
+    for (int i = 0; i < validator.spawnCount; i++) validator.spawns[i] = spawns[i];
+
+    validator.heapCount = 0;
+    for (int tile = 0; tile < cells; tile++) {
+        validator.g[tile] = INF;
+        validator.rhs[tile] = INF;
+        validator.heapIndex[tile] = -1;
+    }
+    if (validator.spawnCount > 0) {
+        for (int row = 0; row < validator.rows; row++) {
+            for (int col = 0; col < validator.cols; col++) {
+                if (IsValidatorExit(row, col)) UpdateTile(row * validator.cols + col);
+            }
+        }
+        ComputeShortestPath();
+    }
+    TRACE_END("PathValidator_Rebuild");
+    return PathValidator_IsValid();
+}
+
+/* I.S. : Tile (row, col) pada grid validator baru saja berubah nilai.
+   F.S. : Jarak semua titik awal sudah diperbarui. Hanya tile yang jaraknya terpengaruh
+          yang diproses ulang. Jika ukuran grid berubah, validator dibangun ulang penuh. */
+void PathValidator_OnTileChanged(int row, int col) {
+    if (validator.grid == NULL) return;
+    if (validator.grid->rows != validator.rows || validator.grid->cols != validator.cols) {
+        PathValidator_Rebuild(validator.grid, validator.spawns, validator.spawnCount, validator.flowFieldMode);
+        return;
+    }
+    if (!InsideValidator(row, col) || validator.spawnCount == 0) return;
+
+    TRACE_BEGIN("PathValidator_OnTileChanged");
+    int tile = row * validator.cols + col;
+    UpdateTile(tile);
+    UpdateNeighbours(tile);
+    ComputeShortestPath();
+    TRACE_END("PathValidator_OnTileChanged");
+}
+
+/* Mengirimkan true jika ada minimal satu titik awal dan semua titik awal terhubung ke exit. */
+bool PathValidator_IsValid(void) {
+    if (validator.g == NULL || validator.spawnCount == 0) return false;
+    for (int i = 0; i < validator.spawnCount; i++) {
+        if (PathValidator_GetSpawnDistance(i) == INF) return false;
+    }
+    return true;
+}
+
+/* Mengirimkan jumlah langkah terpendek dari titik awal ke-'spawnIndex' ke exit, atau
+   PATH_VALIDATOR_UNREACHABLE jika titik awal tidak terhubung atau indeks tidak valid. */
+int PathValidator_GetSpawnDistance(int spawnIndex) {
+    if (validator.g == NULL || spawnIndex < 0 || spawnIndex >= validator.spawnCount) return INF;
+    const SpawnPoint *spawn = &validator.spawns[spawnIndex];
+    if (!InsideValidator(spawn->row, spawn->col)) return INF;
+    return validator.g[spawn->row * validator.cols + spawn->col];
+}
+
+/* I.S. : 'tiles' memiliki ruang untuk 'maxTiles' indeks.
+   F.S. : 'tiles' berisi indeks tile (row * cols + col) rute terpendek dari titik awal
+          ke-'spawnIndex' sampai exit. Mengembalikan jumlah tile yang ditulis, atau 0 jika
+          titik awal tidak terhubung. Rute dipotong jika lebih panjang dari 'maxTiles'. */
+int PathValidator_GetRoute(int spawnIndex, int *tiles, int maxTiles) {
+    int distance = PathValidator_GetSpawnDistance(spawnIndex);
+    if (distance == INF || maxTiles <= 0) return 0;
+
+    // Setelah ComputeShortestPath, tile di rute terpendek konsisten sehingga selalu ada
+    // tetangga dengan g tepat satu lebih kecil sampai exit (g = 0).
+    int tile = validator.spawns[spawnIndex].row * validator.cols + validator.spawns[spawnIndex].col;
+    int count = 0;
+    tiles[count++] = tile;
+    while (validator.g[tile] > 0 && count < maxTiles) {
+        int row = tile / validator.cols;
+        int col = tile % validator.cols;
+        int next = -1;
+        for (int d = 0; d < 4 && next < 0; d++) {
+            int nextRow = row + dyValidator[d];
+            int nextCol = col + dxValidator[d];
+            if (!InsideValidator(nextRow, nextCol) || !IsValidatorWalkable(nextRow, nextCol)) continue;
+            int neighbour = nextRow * validator.cols + nextCol;
+            if (validator.g[neighbour] == validator.g[tile] - 1) next = neighbour;
+        }
+        if (next < 0) break;
+        tile = next;
+        tiles[count++] = tile;
+    }
+    return count;
+}
+
+/* I.S. : Validator mungkin memiliki buffer yang dialokasikan.
+   F.S. : Buffer dibebaskan dan validator kosong. */
+void PathValidator_Free(void) {
+    Memory_Free(validator.g);
+    Memory_Free(validator.rhs);
+    Memory_Free(validator.heapIndex);
+    Memory_Free(validator.heap);
+    validator.g = NULL;
+    validator.rhs = NULL;
+    validator.heapIndex = NULL;
+    validator.heap = NULL;
+    validator.heapCount = 0;
+    validator.grid = NULL;
+    validator.rows = 0;
+    validator.cols = 0;
+}
@@ -0,0 +1,222 @@
+/* File        : profiler.c
+* Deskripsi   : Implementasi untuk modul Profiler.
+*               Berisi pencatatan waktu per section dengan ring buffer riwayat frame,
+*               penggambaran overlay grafik, dan ekspor riwayat ke CSV.
+*               Waktu diambil dari GetTime() milik raylib (timer resolusi tinggi
+*               yang portabel di Windows, Linux, dan macOS).
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "profiler.h"
+#include "memory_tracker.h"
+
+#define PROFILER_GRAPH_FRAMES 300
+#define PROFILER_GRAPH_BAR_WIDTH 2
+#define PROFILER_GRAPH_HEIGHT 200
+#define PROFILER_GRAPH_MAX_MS 33.3f
+#define PROFILER_TARGET_FRAME_MS (1000.0f / 60.0f)
+#define PROFILER_MEMORY_TABLE_GAP 20
+
+static const char *sectionNames[PROF_SECTION_COUNT] = {
+    "UpdateGameplay",
+    "Enemies_Update",
+    "UpdateTowerAttacks",
+    "UpdateShots",
+    "UpdateStatus",
+    "UpdateGameAudio",
+    "DrawMap",
+    "Enemies_Draw",
+    "DrawTowers",
+    "DrawShots"
+};
+
+static const Color sectionColors[PROF_SECTION_COUNT] = {
+    { 230, 41, 55, 255 },   // merah
+    { 255, 161, 0, 255 },   // oranye
+    { 253, 249, 0, 255 },   // kuning
+    { 0, 228, 48, 255 },    // hijau
+    { 0, 158, 47, 255 },    // hijau tua
+    { 102, 191, 255, 255 }, // biru muda
+    { 0, 121, 241, 255 },   // biru
+    { 200, 122, 255, 255 }, // ungu muda
+    { 255, 109, 194, 255 }, // pink
+    { 127, 106, 79, 255 }   // cokelat
+};
+
+static float sectionHistory[PROFILER_HISTORY_FRAMES][PROF_SECTION_COUNT];
+static float frameHistory[PROFILER_HISTORY_FRAMES];
+static double sectionStart[PROF_SECTION_COUNT];
+static double frameStart = 0.0;
+static int currentFrame = 0;
+static int framesRecorded = 0;
+static bool overlayVisible = false;
+
+// UpdateGameplay membungkus section lain; grafik bertumpuk hanya memakai section daun
+// agar waktu yang sama tidak dihitung dua kali.
+static bool IsNestedParentSection(int section) {
+    return section == PROF_UPDATE_GAMEPLAY;
+}
+
+/* I.S. : Frame sebelumnya telah selesai atau profiler belum pernah dipakai.
+   F.S. : Slot riwayat untuk frame baru telah dikosongkan dan waktu mulai frame dicatat. */
+void Profiler_BeginFrame(void) {
+    for (int s = 0; s < PROF_SECTION_COUNT; s++) {
+        sectionHistory[currentFrame][s] = 0.0f;
+    }
+    frameHistory[currentFrame] = 0.0f;
+    frameStart = GetTime();
+}
+
+/* I.S. : Frame sedang berjalan.
+   F.S. : Total waktu frame dicatat dan indeks ring buffer maju ke slot berikutnya. */
+void Profiler_EndFrame(void) {
+    frameHistory[currentFrame] = (float)((GetTime() - frameStart) * 1000.0);
+    currentFrame = (currentFrame + 1) % PROFILER_HISTORY_FRAMES;
+    if (framesRecorded < PROFILER_HISTORY_FRAMES) framesRecorded++;
+}
+
+/* I.S. : 'section' belum sedang diukur.
+   F.S. : Waktu mulai 'section' dicatat. */
+void Profiler_BeginSection(ProfileSection section) {
+    sectionStart[section] = GetTime();
+}
+
+/* I.S. : 'section' sedang diukur (Profiler_BeginSection telah dipanggil).
+   F.S. : Waktu yang berlalu sejak Profiler_BeginSection ditambahkan ke frame saat ini.
+          Section yang dipanggil beberapa kali dalam satu frame diakumulasi. */
+void Profiler_EndSection(ProfileSection section) {
+    sectionHistory[currentFrame][section] += (float)((GetTime() - sectionStart[section]) * 1000.0);
+}
+
+/* I.S. : Overlay profiler dalam keadaan tampil atau tersembunyi.
+   F.S. : Keadaan overlay dibalik jika tombol PROFILER_TOGGLE_KEY ditekan. */
+void Profiler_HandleInput(void) {
+    if (IsKeyPressed(PROFILER_TOGGLE_KEY)) {
+        overlayVisible = !overlayVisible;
+        TraceLog(LOG_INFO, "PROFILER: Overlay %s.", overlayVisible ? "shown" : "hidden");
+    }
+}
+
+/* Mengirimkan rata-rata waktu (milidetik) 'section' selama riwayat yang tersimpan. */
+double Profiler_GetAverageMs(ProfileSection section) {
+    double total = 0.0;
+    int count = 0;
+    for (int i = 0; i < framesRecorded; i++) {
+        if (i == currentFrame) continue; // slot frame yang sedang berjalan
+        total += sectionHistory[i][section];
+        count++;
+    }
+    return count > 0 ? total / count : 0.0;
+}
+
+// Mengirimkan rata-rata total waktu frame (milidetik) selama riwayat yang tersimpan.
+static double GetAverageFrameMs(void) {
+    double total = 0.0;
+    int count = 0;
+    for (int i = 0; i < framesRecorded; i++) {
+        if (i == currentFrame) continue; // slot frame yang sedang berjalan
+        total += frameHistory[i];
+        count++;
+    }
+    return count > 0 ? total / count : 0.0;
+}
+
+/* I.S. : Riwayat profiler berisi data frame terakhir.
+   F.S. : Jika overlay aktif, grafik batang bertumpuk per frame, tabel rata-rata
+          per section, dan tabel memori per subsistem telah digambar ke layar. */
+void DrawProfilerOverlay(void) {
+    if (!overlayVisible) return;
+
+    const int fontSize = 20;
+    const int lineHeight = 24;
+    int graphWidth = PROFILER_GRAPH_FRAMES * PROFILER_GRAPH_BAR_WIDTH;
+    int panelWidth = graphWidth + 40;
+    int panelHeight = PROFILER_GRAPH_HEIGHT + 80 + lineHeight * (PROF_SECTION_COUNT + 1)
+                      + PROFILER_MEMORY_TABLE_GAP + lineHeight * (MEM_TAG_COUNT + 1);
+    int panelX = VIRTUAL_WIDTH - panelWidth - 20;
+    int panelY = 120;
+    int graphX = panelX + 20;
+    int graphY = panelY + 50;
+    float pixelsPerMs = PROFILER_GRAPH_HEIGHT / PROFILER_GRAPH_MAX_MS;
+
+    DrawRectangle(panelX, panelY, panelWidth, panelHeight, Fade(BLACK, 0.75f));
+    DrawText(TextFormat("Profiler (F3)  frame avg %.2f ms", GetAverageFrameMs()), panelX + 20, panelY + 15, fontSize, RAYWHITE);
+
+    // Grafik batang: satu batang per frame, frame terbaru di kanan.
+    int framesToDraw = framesRecorded < PROFILER_GRAPH_FRAMES ? framesRecorded : PROFILER_GRAPH_FRAMES;
+    for (int i = 0; i < framesToDraw; i++) {
+        int frame = (currentFrame - framesToDraw + i + PROFILER_HISTORY_FRAMES) % PROFILER_HISTORY_FRAMES;
+        int x = graphX + (PROFILER_GRAPH_FRAMES - framesToDraw + i) * PROFILER_GRAPH_BAR_WIDTH;
+        float y = (float)(graphY + PROFILER_GRAPH_HEIGHT);
+        float stacked = 0.0f;
+        for (int s = 0; s < PROF_SECTION_COUNT; s++) {
+            if (IsNestedParentSection(s)) continue;
+            float h = sectionHistory[frame][s] * pixelsPerMs;
+            if (h <= 0.0f) continue;
+            y -= h;
+            DrawRectangle(x, (int)y, PROFILER_GRAPH_BAR_WIDTH, (int)ceilf(h), sectionColors[s]);
+            stacked += sectionHistory[frame][s];
+        }
+        // Sisa waktu frame yang tidak tercakup section mana pun (vsync, menu, dsb.).
+        float other = frameHistory[frame] - stacked;
+        if (other > 0.0f) {
+            float h = fminf(other * pixelsPerMs, y - graphY);
+            DrawRectangle(x, (int)(y - h), PROFILER_GRAPH_BAR_WIDTH, (int)h, Fade(GRAY, 0.5f));
+        }
+    }
+    int targetY = graphY + PROFILER_GRAPH_HEIGHT - (int)(PROFILER_TARGET_FRAME_MS * pixelsPerMs);
+    DrawLine(graphX, targetY, graphX + graphWidth, targetY, Fade(RAYWHITE, 0.6f));
+    DrawText("16.7 ms", graphX + graphWidth - MeasureText("16.7 ms", 16), targetY - 18, 16, RAYWHITE);
+    DrawRectangleLines(graphX, graphY, graphWidth, PROFILER_GRAPH_HEIGHT, Fade(RAYWHITE, 0.4f));
+
+    // Tabel rata-rata dan nilai frame terakhir per section.
+    int lastFrame = (currentFrame - 1 + PROFILER_HISTORY_FRAMES) % PROFILER_HISTORY_FRAMES;
+    int textY = graphY + PROFILER_GRAPH_HEIGHT + 20;
+    DrawText("section", graphX + 20, textY, fontSize, LIGHTGRAY);
+    DrawText("avg ms", graphX + 280, textY, fontSize, LIGHTGRAY);
+    DrawText("last ms", graphX + 400, textY, fontSize, LIGHTGRAY);
+    for (int s = 0; s < PROF_SECTION_COUNT; s++) {
+        textY += lineHeight;
+        DrawRectangle(graphX, textY + 4, 12, 12, sectionColors[s]);
+        DrawText(sectionNames[s], graphX + 20, textY, fontSize, RAYWHITE);
+        DrawText(TextFormat("%6.3f", Profiler_GetAverageMs((ProfileSection)s)), graphX + 280, textY, fontSize, RAYWHITE);
+        DrawText(TextFormat("%6.3f", framesRecorded > 0 ? sectionHistory[lastFrame][s] : 0.0f), graphX + 400, textY, fontSize, RAYWHITE);
+    }
+
+    DrawMemoryTable(graphX, textY + lineHeight + PROFILER_MEMORY_TABLE_GAP, fontSize, lineHeight);
+}
+
+/* I.S. : Riwayat profiler berisi data hingga PROFILER_HISTORY_FRAMES frame terakhir.
+   F.S. : Riwayat ditulis ke 'fileName' dalam format CSV (satu baris per frame, milidetik).
+          Mengembalikan false jika file tidak dapat dibuka atau belum ada data. */
+bool Profiler_DumpCSV(const char *fileName) {
+    if (framesRecorded == 0) return false;
+
+    FILE *file = fopen(fileName, "w");
+    if (!file) {
+        TraceLog(LOG_WARNING, "PROFILER: Failed to open %s for writing.", fileName);
+        return false;
+    }
+
+    fprintf(file, "frame,frame_ms");
+    for (int s = 0; s < PROF_SECTION_COUNT; s++) {
+        fprintf(file, ",%s", sectionNames[s]);
+    }
+    fprintf(file, "\n");
+
+    // Frame tertua ditulis lebih dulu.
+    int oldest = (currentFrame - framesRecorded + PROFILER_HISTORY_FRAMES) % PROFILER_HISTORY_FRAMES;
+    for (int i = 0; i < framesRecorded; i++) {
+        int frame = (oldest + i) % PROFILER_HISTORY_FRAMES;
+        fprintf(file, "%d,%.4f", i, frameHistory[frame]);
+        for (int s = 0; s < PROF_SECTION_COUNT; s++) {
+            fprintf(file, ",%.4f", sectionHistory[frame][s]);
+        }
+        fprintf(file, "\n");
+    }
+
+    fclose(file);
+    TraceLog(LOG_INFO, "PROFILER: Wrote %d frames to %s.", framesRecorded, fileName);
+    return true;
+}
@@ -21,6 +21,7 @@
 #include "raylib.h"
 #include "upgrade_tree.h"
 #include "gameplay.h"
+#include "memory_tracker.h"
 #include "audio.h"
 
 PlayerProgress playerProgress;
@@ -99,8 +100,8 @@ static void CalculateNewSkillCost() {
  * F.S. : Semua tekstur yang diperlukan (ikon, dll.) telah dimuat dan siap digunakan.
  */
 void InitResearchMenu(void) {
-    emptySkillNodeTex = LoadTextureSafe("assets/img/mainmenu_imgs/nodeskill.png");
-    research_moneyIconTex = LoadTextureSafe("assets/img/gameplay_imgs/coin.png"); 
+    emptySkillNodeTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/mainmenu_imgs/nodeskill.png");
+    research_moneyIconTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/gameplay_imgs/coin.png"); 
 }
 
  /*
@@ -251,7 +252,8 @@ void UpdateResearchMenu(void) {
         if (playerProgress.globalGold < newSkillCost) { Push(&statusStack, "Emas global tidak mencukupi!"); return; }
         
         playerProgress.globalGold -= newSkillCost;
-        UpgradeNode* newNode = CreateUpgradeNode((UpgradeType)nextCustomSkillId, strdup(newSkillNameBuffer), "Skill Kustom", newSkillCost, parentNodeForNewSkill, 0);
+        UpgradeNode* newNode = CreateUpgradeNode((UpgradeType)nextCustomSkillId, Memory_StrDup(MEM_TAG_UPGRADE, newSkillNameBuffer),
+                                                  Memory_StrDup(MEM_TAG_UPGRADE, "Skill Kustom"), newSkillCost, parentNodeForNewSkill, 0);
         
         if (newNode) {
             switch(parentNodeForNewSkill->type) {
@@ -276,6 +278,7 @@ void UpdateResearchMenu(void) {
                     break;
             }
             AddChild(parentNodeForNewSkill, newNode);
+            CompileUpgradeTree(&tower1UpgradeTree);
             SaveProgress(&playerProgress);
             Push(&statusStack, TextFormat("Skill kustom '%s' berhasil dibuat!", newNode->name));
             nextCustomSkillId++;
@@ -0,0 +1,349 @@
+/* File        : shot_batch.c
+* Deskripsi   : Implementasi untuk modul Shot Batch.
+*               Satu quad memakai empat vertex dengan atribut:
+*                   vertexPosition  : (awal.x, awal.y, waktu mulai)
+*                   vertexTexCoord  : sudut quad dalam [-1, 1] (tetap)
+*                   vertexTexCoord2 : (akhir.x, akhir.y), sama dengan awal untuk efek tumbukan
+*                   vertexNormal    : (durasi, ukuran, 0)
+*                   vertexColor     : warna efek
+*               Slot yang ditulis dalam satu frame dikumpulkan dalam satu rentang kotor dan
+*               diunggah sekali per buffer sebelum mesh digambar.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "shot_batch.h"
+#include "memory_tracker.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <string.h>
+
+#define SHOT_QUAD_VERTICES 4
+#define SHOT_QUAD_INDICES 6
+
+// Indeks buffer mesh raylib untuk UpdateMeshBuffer.
+#define MESH_BUFFER_POSITION 0
+#define MESH_BUFFER_NORMAL 2
+#define MESH_BUFFER_COLOR 3
+#define MESH_BUFFER_TEXCOORD2 5
+
+/* Jenis shader efek. Tumbukan biasa dan ledakan area memakai gradien yang sama. */
+typedef enum {
+    SHOT_SHADER_SOLID,
+    SHOT_SHADER_GRADIENT,
+    SHOT_SHADER_SHATTER,
+    SHOT_SHADER_BEAM,
+    SHOT_SHADER_COUNT
+} ShotShaderKind;
+
+/* Mesh satu tipe efek beserta rentang slot yang belum diunggah ('dirtyLast' eksklusif). */
+typedef struct {
+    Mesh mesh;
+    int capacity;
+    int dirtyFirst;
+    int dirtyLast;
+} ShotBatch;
+
+static const ShotShaderKind shaderForType[SHOT_TYPE_COUNT] = {
+    [SHOT_TYPE_NORMAL_IMPACT] = SHOT_SHADER_GRADIENT,
+    [SHOT_TYPE_PROJECTILE] = SHOT_SHADER_SOLID,
+    [SHOT_TYPE_AOE_BLAST] = SHOT_SHADER_GRADIENT,
+    [SHOT_TYPE_CRIT_SHATTER] = SHOT_SHADER_SHATTER,
+    [SHOT_TYPE_CHAIN_BEAM] = SHOT_SHADER_BEAM
+};
+
+static ShotBatch batches[SHOT_TYPE_COUNT];
+static Shader shaders[SHOT_SHADER_COUNT];
+static int timeLoc[SHOT_SHADER_COUNT];
+static int scaleLoc[SHOT_SHADER_COUNT];
+static int offsetLoc[SHOT_SHADER_COUNT];
+static Material batchMaterial;
+static bool batchReady = false;
+
+#define SHOT_VERTEX_HEADER \
+    "#version 330\n" \
+    "in vec3 vertexPosition;\n" \
+    "in vec2 vertexTexCoord;\n" \
+    "in vec2 vertexTexCoord2;\n" \
+    "in vec3 vertexNormal;\n" \
+    "in vec4 vertexColor;\n" \
+    "uniform mat4 mvp;\n" \
+    "uniform float time;\n" \
+    "uniform float scale;\n" \
+    "uniform vec2 offset;\n" \
+    "out vec2 fragCorner;\n" \
+    "out vec4 fragColor;\n" \
+    "out float fragProgress;\n" \
+    "out float fragPixelSize;\n"
+
+// Quad persegi di sekitar titik efek. Proyektil bergerak dari awal ke akhir; quad diciutkan
+// di luar masa hidup efek.
+static const char *shotVertexShader = SHOT_VERTEX_HEADER
+    "void main() {\n"
+    "    float progress = (time - vertexPosition.z) / vertexNormal.x;\n"
+    "    float size = (progress >= 0.0 && progress < 1.0) ? vertexNormal.y : 0.0;\n"
+    "    vec2 center = mix(vertexPosition.xy, vertexTexCoord2, clamp(progress, 0.0, 1.0));\n"
+    "    fragCorner = vertexTexCoord;\n"
+    "    fragColor = vertexColor;\n"
+    "    fragProgress = progress;\n"
+    "    fragPixelSize = size * scale;\n"
+    "    gl_Position = mvp * vec4(offset + (center + vertexTexCoord * size) * scale, 0.0, 1.0);\n"
+    "}\n";
+
+// Quad memanjang dari awal ke akhir dengan setengah lebar 'size' piksel layar.
+static const char *beamVertexShader = SHOT_VERTEX_HEADER
+    "void main() {\n"
+    "    float progress = (time - vertexPosition.z) / vertexNormal.x;\n"
+    "    float halfWidth = (progress >= 0.0 && progress < 1.0) ? vertexNormal.y : 0.0;\n"
+    "    vec2 screenStart = offset + vertexPosition.xy * scale;\n"
+    "    vec2 screenEnd = offset + vertexTexCoord2 * scale;\n"
+    "    vec2 delta = screenEnd - screenStart;\n"
+    "    vec2 dir = delta / max(length(delta), 0.0001);\n"
+    "    vec2 side = vec2(-dir.y, dir.x);\n"
+    "    vec2 pos = mix(screenStart, screenEnd, vertexTexCoord.x * 0.5 + 0.5) + side * vertexTexCoord.y * halfWidth;\n"
+    "    fragCorner = vertexTexCoord;\n"
+    "    fragColor = vertexColor;\n"
+    "    fragProgress = progress;\n"
+    "    fragPixelSize = halfWidth;\n"
+    "    gl_Position = mvp * vec4(pos, 0.0, 1.0);\n"
+    "}\n";
+
+#define SHOT_FRAGMENT_HEADER \
+    "#version 330\n" \
+    "in vec2 fragCorner;\n" \
+    "in vec4 fragColor;\n" \
+    "in float fragProgress;\n" \
+    "in float fragPixelSize;\n" \
+    "out vec4 finalColor;\n"
+
+// Padanan DrawCircleV: lingkaran penuh.
+static const char *solidFragmentShader = SHOT_FRAGMENT_HEADER
+    "void main() {\n"
+    "    if (dot(fragCorner, fragCorner) > 1.0) discard;\n"
+    "    finalColor = fragColor;\n"
+    "}\n";
+
+// Padanan DrawCircleGradient: jari-jari tumbuh dengan progress, warna memudar ke BLANK.
+static const char *gradientFragmentShader = SHOT_FRAGMENT_HEADER
+    "void main() {\n"
+    "    float r = length(fragCorner) / max(fragProgress, 0.0001);\n"
+    "    if (r > 1.0) discard;\n"
+    "    vec4 inner = vec4(fragColor.rgb, fragColor.a * (1.0 - fragProgress));\n"
+    "    finalColor = mix(inner, vec4(0.0), r);\n"
+    "}\n";
+
+// Padanan enam DrawLineEx setebal 2 piksel setiap 60 derajat.
+static const char *shatterFragmentShader = SHOT_FRAGMENT_HEADER
+    "void main() {\n"
+    "    vec2 d = fragCorner * fragPixelSize;\n"
+    "    float len = length(d);\n"
+    "    if (len > fragProgress * fragPixelSize) discard;\n"
+    "    float spacing = radians(60.0);\n"
+    "    float angle = atan(d.y, d.x);\n"
+    "    float nearest = floor(angle / spacing + 0.5) * spacing;\n"
+    "    if (len * abs(sin(angle - nearest)) > 1.0) discard;\n"
+    "    finalColor = vec4(fragColor.rgb, fragColor.a * (1.0 - fragProgress));\n"
+    "}\n";
+
+// Padanan garis inti 2 piksel di atas garis cahaya 3 piksel setengah transparan, memudar.
+static const char *beamFragmentShader = SHOT_FRAGMENT_HEADER
+    "void main() {\n"
+    "    float alpha = (abs(fragCorner.y) * fragPixelSize <= 1.0) ? 1.0 : 0.5;\n"
+    "    finalColor = vec4(fragColor.rgb, fragColor.a * alpha * (1.0 - fragProgress));\n"
+    "}\n";
+
+// Membebaskan buffer CPU dan GPU 'mesh'. Buffer CPU dialokasikan lewat memory tracker,
+// jadi dibebaskan di sini sebelum UnloadMesh agar raylib tidak membebaskannya lagi.
+static void FreeBatchMesh(Mesh *mesh) {
+    Memory_Free(mesh->vertices);
+    Memory_Free(mesh->texcoords);
+    Memory_Free(mesh->texcoords2);
+    Memory_Free(mesh->normals);
+    Memory_Free(mesh->colors);
+    Memory_Free(mesh->indices);
+    mesh->vertices = mesh->texcoords = mesh->texcoords2 = mesh->normals = NULL;
+    mesh->colors = NULL;
+    mesh->indices = NULL;
+    if (mesh->vaoId > 0) UnloadMesh(*mesh);
+    *mesh = (Mesh){0};
+}
+
+// Mengunggah slot kotor 'batch' ke GPU.
+static void FlushBatch(ShotBatch *batch) {
+    if (batch->dirtyFirst >= batch->dirtyLast) return;
+    Mesh mesh = batch->mesh;
+    int first = batch->dirtyFirst * SHOT_QUAD_VERTICES;
+    int count = (batch->dirtyLast - batch->dirtyFirst) * SHOT_QUAD_VERTICES;
+    UpdateMeshBuffer(mesh, MESH_BUFFER_POSITION, &mesh.vertices[first * 3], count * 3 * sizeof(float), first * 3 * sizeof(float));
+    UpdateMeshBuffer(mesh, MESH_BUFFER_TEXCOORD2, &mesh.texcoords2[first * 2], count * 2 * sizeof(float), first * 2 * sizeof(float));
+    UpdateMeshBuffer(mesh, MESH_BUFFER_NORMAL, &mesh.normals[first * 3], count * 3 * sizeof(float), first * 3 * sizeof(float));
+    UpdateMeshBuffer(mesh, MESH_BUFFER_COLOR, &mesh.colors[first * 4], count * 4, first * 4);
+    batch->dirtyFirst = batch->capacity;
+    batch->dirtyLast = 0;
+}
+
+/* I.S. : Jendela dan konteks OpenGL sudah dibuat. Shader batch belum dimuat.
+   F.S. : Shader batch dimuat. Mengembalikan false jika shader gagal dikompilasi; efek
+          kemudian digambar satu per satu oleh DrawShots. */
+bool ShotBatch_Init(void) {
+    if (batchReady) return true;
+    const char *fragmentShaders[SHOT_SHADER_COUNT] = {
+        [SHOT_SHADER_SOLID] = solidFragmentShader,
+        [SHOT_SHADER_GRADIENT] = gradientFragmentShader,
+        [SHOT_SHADER_SHATTER] = shatterFragmentShader,
+        [SHOT_SHADER_BEAM] = beamFragmentShader
+    };
+    for (int k = 0; k < SHOT_SHADER_COUNT; k++) {
+        const char *vertexShader = k == SHOT_SHADER_BEAM ? beamVertexShader : shotVertexShader;
+        shaders[k] = LoadShaderFromMemory(vertexShader, fragmentShaders[k]);
+        if (shaders[k].id == rlGetShaderIdDefault()) {
+            TraceLog(LOG_WARNING, "SHOTS: Batch shader %d failed to compile, drawing effects one by one.", k);
+            for (int j = 0; j < k; j++) UnloadShader(shaders[j]);
+            return false;
+        }
+        timeLoc[k] = GetShaderLocation(shaders[k], "time");
+        scaleLoc[k] = GetShaderLocation(shaders[k], "scale");
+        offsetLoc[k] = GetShaderLocation(shaders[k], "offset");
+    }
+    batchMaterial = LoadMaterialDefault();
+    batchReady = true;
+    TraceLog(LOG_INFO, "SHOTS: Batched effect rendering initialized.");
+    return true;
+}
+
+/* I.S. : Shader dan mesh batch mungkin sedang dimuat.
+   F.S. : Semua mesh, shader, dan buffer CPU batch dibebaskan. */
+void ShotBatch_Shutdown(void) {
+    if (!batchReady) return;
+    for (int t = 0; t < SHOT_TYPE_COUNT; t++) {
+        FreeBatchMesh(&batches[t].mesh);
+        batches[t] = (ShotBatch){0};
+    }
+    for (int k = 0; k < SHOT_SHADER_COUNT; k++) UnloadShader(shaders[k]);
+    UnloadMaterial(batchMaterial);
+    batchReady = false;
+}
+
+/* Mengirimkan true jika efek digambar lewat batch. */
+bool ShotBatch_IsReady(void) {
+    return batchReady;
+}
+
+/* Mengirimkan jumlah slot quad yang dimiliki mesh batch tipe 'type'. */
+int ShotBatch_GetCapacity(ShotType type) {
+    return batches[type].capacity;
+}
+
+/* I.S. : Mesh batch tipe 'type' memiliki kapasitas sembarang.
+   F.S. : Mesh diperbesar sampai 'capacity' slot, paling banyak SHOT_BATCH_MAX_EFFECTS. Isi slot
+          lama dipertahankan. Mengembalikan true jika mesh sekarang memuat 'capacity' slot; false
+          jika 'capacity' melebihi batas (mesh mungkin tetap diperbesar sampai batas) atau mesh
+          tidak bisa dibuat. */
+bool ShotBatch_Reserve(ShotType type, int capacity) {
+    ShotBatch *batch = &batches[type];
+    if (!batchReady) return false;
+    if (capacity <= batch->capacity) return true;
+    bool fits = capacity <= SHOT_BATCH_MAX_EFFECTS;
+    if (!fits) {
+        // Mesh yang sudah di batas indeks dibiarkan apa adanya.
+        if (batch->capacity == SHOT_BATCH_MAX_EFFECTS) return false;
+        capacity = SHOT_BATCH_MAX_EFFECTS;
+    }
+
+    int vertexCount = capacity * SHOT_QUAD_VERTICES;
+    Mesh mesh = {0};
+    mesh.vertexCount = vertexCount;
+    mesh.triangleCount = capacity * 2;
+    mesh.vertices = (float *)Memory_Calloc(MEM_TAG_TOWER, vertexCount * 3, sizeof(float));
+    mesh.texcoords = (float *)Memory_Calloc(MEM_TAG_TOWER, vertexCount * 2, sizeof(float));
+    mesh.texcoords2 = (float *)Memory_Calloc(MEM_TAG_TOWER, vertexCount * 2, sizeof(float));
+    mesh.normals = (float *)Memory_Calloc(MEM_TAG_TOWER, vertexCount * 3, sizeof(float));
+    mesh.colors = (unsigned char *)Memory_Calloc(MEM_TAG_TOWER, vertexCount * 4, sizeof(unsigned char));
+    mesh.indices = (unsigned short *)Memory_Calloc(MEM_TAG_TOWER, capacity * SHOT_QUAD_INDICES, sizeof(unsigned short));
+    if (!mesh.vertices || !mesh.texcoords || !mesh.texcoords2 || !mesh.normals || !mesh.colors || !mesh.indices) {
+        TraceLog(LOG_ERROR, "SHOTS: Failed to allocate batch mesh with %d quads.", capacity);
+        FreeBatchMesh(&mesh);
+        return false;
+    }
+
+    static const float corners[SHOT_QUAD_VERTICES][2] = { {-1, -1}, {1, -1}, {1, 1}, {-1, 1} };
+    for (int q = 0; q < capacity; q++) {
+        for (int v = 0; v < SHOT_QUAD_VERTICES; v++) {
+            mesh.texcoords[(q * SHOT_QUAD_VERTICES + v) * 2 + 0] = corners[v][0];
+            mesh.texcoords[(q * SHOT_QUAD_VERTICES + v) * 2 + 1] = corners[v][1];
+        }
+        unsigned short base = (unsigned short)(q * SHOT_QUAD_VERTICES);
+        unsigned short *index = &mesh.indices[q * SHOT_QUAD_INDICES];
+        index[0] = base; index[1] = base + 1; index[2] = base + 2;
+        index[3] = base; index[4] = base + 2; index[5] = base + 3;
+    }
+    if (batch->capacity > 0) {
+        int oldVertices = batch->capacity * SHOT_QUAD_VERTICES;
+        memcpy(mesh.vertices, batch->mesh.vertices, sizeof(float) * oldVertices * 3);
+        memcpy(mesh.texcoords2, batch->mesh.texcoords2, sizeof(float) * oldVertices * 2);
+        memcpy(mesh.normals, batch->mesh.normals, sizeof(float) * oldVertices * 3);
+        memcpy(mesh.colors, batch->mesh.colors, sizeof(unsigned char) * oldVertices * 4);
+    }
+
+    UploadMesh(&mesh, true);
+    FreeBatchMesh(&batch->mesh);
+    batch->mesh = mesh;
+    batch->capacity = capacity;
+    batch->dirtyFirst = capacity;
+    batch->dirtyLast = 0;
+    return fits;
+}
+
+/* I.S. : 'slot' adalah slot pool tempat 'shot' baru disimpan.
+   F.S. : Quad di 'slot' ditulis ulang dari 'shot' dan diunggah ke GPU pada gambar berikutnya. */
+void ShotBatch_Write(ShotType type, int slot, const Shot *shot) {
+    ShotBatch *batch = &batches[type];
+    if (slot < 0 || slot >= batch->capacity) return;
+    for (int v = 0; v < SHOT_QUAD_VERTICES; v++) {
+        int i = slot * SHOT_QUAD_VERTICES + v;
+        batch->mesh.vertices[i * 3 + 0] = shot->startPos.x;
+        batch->mesh.vertices[i * 3 + 1] = shot->startPos.y;
+        batch->mesh.vertices[i * 3 + 2] = shot->startTime;
+        batch->mesh.texcoords2[i * 2 + 0] = shot->endPos.x;
+        batch->mesh.texcoords2[i * 2 + 1] = shot->endPos.y;
+        batch->mesh.normals[i * 3 + 0] = shot->duration;
+        batch->mesh.normals[i * 3 + 1] = shot->size;
+        batch->mesh.normals[i * 3 + 2] = 0.0f;
+        batch->mesh.colors[i * 4 + 0] = shot->color.r;
+        batch->mesh.colors[i * 4 + 1] = shot->color.g;
+        batch->mesh.colors[i * 4 + 2] = shot->color.b;
+        batch->mesh.colors[i * 4 + 3] = shot->color.a;
+    }
+    if (slot < batch->dirtyFirst) batch->dirtyFirst = slot;
+    if (slot + 1 > batch->dirtyLast) batch->dirtyLast = slot + 1;
+}
+
+/* I.S. : Quad tipe 'type' di slot 0..'slotCount'-1 berisi efek hidup atau yang sudah selesai.
+   F.S. : Semua quad tersebut digambar dalam satu draw call. Efek yang belum mulai atau sudah
+          selesai pada waktu 'time' diciutkan oleh shader sehingga tidak terlihat. */
+void ShotBatch_Draw(ShotType type, int slotCount, float time, float globalScale, float offsetX, float offsetY) {
+    ShotBatch *batch = &batches[type];
+    if (!batchReady || slotCount <= 0 || batch->capacity == 0) return;
+    if (slotCount > batch->capacity) slotCount = batch->capacity;
+
+    // Gambar 2D yang masih mengantri di batch raylib harus keluar lebih dulu agar urutan
+    // lapisan tetap sama dengan urutan pemanggilan.
+    rlDrawRenderBatchActive();
+    FlushBatch(batch);
+
+    Shader shader = shaders[shaderForType[type]];
+    Vector2 offset = { offsetX, offsetY };
+    SetShaderValue(shader, timeLoc[shaderForType[type]], &time, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(shader, scaleLoc[shaderForType[type]], &globalScale, SHADER_UNIFORM_FLOAT);
+    SetShaderValue(shader, offsetLoc[shaderForType[type]], &offset, SHADER_UNIFORM_VEC2);
+
+    Mesh mesh = batch->mesh;
+    mesh.triangleCount = slotCount * 2;
+    Material material = batchMaterial;
+    material.shader = shader;
+
+    // Proyeksi 2D raylib membalik sumbu Y, jadi urutan putaran quad ikut terbalik.
+    rlDisableBackfaceCulling();
+    DrawMesh(mesh, material, MatrixIdentity());
+    rlEnableBackfaceCulling();
+}
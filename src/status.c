@@ -9,9 +9,13 @@
 #include "status.h"
 #include "raymath.h"
 #include "stdbool.h"
+#include "event_scheduler.h"
 #include <string.h>
 
+#define STATUS_DISPLAY_SECONDS 3.0f
+
 Stack statusStack;
+static unsigned int nextStatusSerial = 1;
 
 /* IS : S adalah stack sembarang. */
 /* FS : Membuat sebuah stack S yang kosong dan siap digunakan. */
@@ -20,6 +24,7 @@ void CreateStatus(Stack *S) {
         S->messages[i][0] = '\0';
         S->alphas[i] = 0.0f;
         S->timers[i] = 0.0f;
+        S->serials[i] = 0;
         S->posX[i] = -400.0f; 
     }
 }
@@ -36,6 +41,7 @@ static void Pop(Stack *S){
         strcpy(S->messages[i], S->messages[i-1]);
         S->alphas[i] = S->alphas[i-1];
         S->timers[i] = S->timers[i-1];
+        S->serials[i] = S->serials[i-1];
         S->posX[i] = S->posX[i-1]; 
     }
 }
@@ -46,12 +52,26 @@ static void RemoveTopAndShiftUp(Stack *S) {
         strcpy(S->messages[i], S->messages[i+1]);
         S->alphas[i] = S->alphas[i+1];
         S->timers[i] = S->timers[i+1];
+        S->serials[i] = S->serials[i+1];
         S->posX[i] = S->posX[i+1];
     }
     
     S->messages[MAX_STACK_SIZE - 1][0] = '\0';
     S->alphas[MAX_STACK_SIZE - 1] = 0.0f;
     S->timers[MAX_STACK_SIZE - 1] = 0.0f;
+    S->serials[MAX_STACK_SIZE - 1] = 0;
+}
+
+/* Handler event scheduler: masa tampil pesan bernomor 'serial' habis sehingga pesan mulai
+   memudar begitu berada di TOP. Pesan yang sudah tergeser keluar dari stack diabaikan. */
+static void OnStatusExpired(void *target, int serial) {
+    Stack *S = (Stack *)target;
+    for (int i = 0; i < MAX_STACK_SIZE; i++) {
+        if (S->messages[i][0] != '\0' && S->serials[i] == (unsigned int)serial) {
+            S->timers[i] = 0.0f;
+            return;
+        }
+    }
 }
 
 /* IS : S mungkin sudah berisi pesan. */
@@ -67,8 +87,10 @@ void Push(Stack *S, const char* message) {
     strncpy(S->messages[0], message, MAX_MESSAGE_LENGTH - 1);
     S->messages[0][MAX_MESSAGE_LENGTH - 1] = '\0';
     S->alphas[0] = 1.0f;
-    S->timers[0] = 3.0f; 
+    S->timers[0] = STATUS_DISPLAY_SECONDS; 
+    S->serials[0] = nextStatusSerial++;
     S->posX[0] = -400.0f;
+    Scheduler_Schedule(Scheduler_SecondsToTicks(STATUS_DISPLAY_SECONDS), OnStatusExpired, S, (int)S->serials[0]);
     for (int i = 1; i < MAX_STACK_SIZE; i++) {
         if (S->messages[i][0] != '\0') {
             S->alphas[i] = 1.0f;
@@ -76,7 +98,8 @@ void Push(Stack *S, const char* message) {
     }
 }
 /* IS : S adalah stack status. */
-/* FS : Timer dan alpha dari setiap pesan di dalam S di-update. */
+/* FS : Posisi dan alpha dari setiap pesan di dalam S di-update. Masa tampil pesan
+        diakhiri oleh event scheduler, bukan dihitung mundur di sini. */
 // File: tubes1/status.c
 void UpdateStatus(Stack *S, float deltaTime) {
     // Animasikan posisi masuk untuk semua pesan yang terlihat
@@ -94,10 +117,7 @@ void UpdateStatus(Stack *S, float deltaTime) {
     }
 
     if (S->messages[0][0] != '\0') {
-        if (S->timers[0] > 0) {
-            S->timers[0] -= deltaTime;
-        } 
-        else if (S->alphas[0] > 0) {
+        if (S->timers[0] <= 0 && S->alphas[0] > 0) {
             S->alphas[0] -= deltaTime * 1.0f; 
         if (S->alphas[0] <= 0) {
             RemoveTopAndShiftUp(S);
@@ -16,9 +16,15 @@
 #include "player_resources.h"
 #include "status.h"
 #include "audio.h"
+#include "camera.h"
+#include "maze.h"
+#include "flow_field.h"
 #include <stddef.h>
 #include <stdlib.h>
+#include "memory_tracker.h"
+#include "shot_batch.h"
 #include <math.h>
+#include <stdatomic.h>
 
 Tower *towersListHead = NULL;
 Tower *selectedTowerForDeletion = NULL;
@@ -34,26 +40,161 @@ float UPGRADE_BUTTON_DRAW_SCALE = ORBIT_BUTTON_DRAW_SCALE;
 Texture2D tower1Texture = {0};
 Texture2D tower2Texture = {0};
 Texture2D tower3Texture = {0};
-static Shot shots[MAX_VISUAL_SHOTS]; 
 
-/* I.S. : Aset-aset untuk tower (seperti tekstur sprite, tombol UI) belum dimuat.
-   F.S. : Semua aset yang diperlukan oleh modul Tower telah dimuat ke memori. */
+/* Pool efek visual per tipe. Indeks slot kosong disimpan di 'freeList' (stack) dan indeks slot
+   hidup di array padat 'live' tanpa urutan. Efek satu tipe tidak selesai berurutan (impact bisa
+   ditunda sebesar waktu tempuh proyektil, dan lama proyektil bergantung jarak), jadi UpdateShots
+   memeriksa semua efek hidup dan menukar efek yang selesai dengan elemen terakhir 'live'.
+   Slot 0..'highWater'-1 adalah rentang quad yang digambar batch. Kapasitas digandakan saat penuh. */
+typedef struct {
+    Shot *items;
+    int *freeList;
+    int *live;
+    int freeCount;
+    int liveCount;
+    int highWater;
+    int capacity;
+} ShotPool;
+
+static ShotPool shotPools[SHOT_TYPE_COUNT];
+static float shotClock = 0.0f;      // Jam efek visual, maju di UpdateShots
+
+/* Antrian tambah efek. Produsen (boleh lebih dari satu thread) memesan slot dengan satu
+   atomic_fetch_add lalu menulis efeknya tanpa lock. Antrian dikuras ke pool oleh thread utama
+   di UpdateShots/DrawShots, saat tidak ada produsen yang sedang berjalan. Pesanan yang melewati
+   kapasitas dibuang dan kapasitas antrian diperbesar untuk frame berikutnya. */
+static struct {
+    Shot *slots;
+    int capacity;
+    atomic_int reserved;
+} shotQueue;
+
+// Mengosongkan 'pool': semua slot kembali ke free-list, indeks kecil di puncak stack.
+static void ResetShotPool(ShotPool *pool) {
+    pool->freeCount = 0;
+    for (int i = pool->capacity - 1; i >= 0; i--) {
+        pool->freeList[pool->freeCount++] = i;
+    }
+    pool->liveCount = 0;
+    pool->highWater = 0;
+}
+
+// Memperbesar 'pool' menjadi 'newCapacity' slot. Slot baru masuk ke free-list.
+static bool GrowShotPool(ShotPool *pool, int newCapacity) {
+    Shot *items = (Shot *)Memory_Realloc(MEM_TAG_TOWER, pool->items, sizeof(Shot) * newCapacity);
+    if (items == NULL) return false;
+    pool->items = items;
+    int *freeList = (int *)Memory_Realloc(MEM_TAG_TOWER, pool->freeList, sizeof(int) * newCapacity);
+    if (freeList == NULL) return false;
+    pool->freeList = freeList;
+    int *live = (int *)Memory_Realloc(MEM_TAG_TOWER, pool->live, sizeof(int) * newCapacity);
+    if (live == NULL) return false;
+    pool->live = live;
+
+    for (int i = newCapacity - 1; i >= pool->capacity; i--) {
+        pool->freeList[pool->freeCount++] = i;
+    }
+    pool->capacity = newCapacity;
+    return true;
+}
+
+// Membebaskan semua buffer 'pool'.
+static void FreeShotPool(ShotPool *pool) {
+    Memory_Free(pool->items);
+    Memory_Free(pool->freeList);
+    Memory_Free(pool->live);
+    *pool = (ShotPool){0};
+}
+
+// Mengganti buffer antrian dengan buffer kosong berkapasitas 'newCapacity'.
+static bool ResizeShotQueue(int newCapacity) {
+    Shot *slots = (Shot *)Memory_Alloc(MEM_TAG_TOWER, sizeof(Shot) * newCapacity);
+    if (slots == NULL) return false;
+    Memory_Free(shotQueue.slots);
+    shotQueue.slots = slots;
+    shotQueue.capacity = newCapacity;
+    return true;
+}
+
+// Menambahkan 'shot' ke antrian. Aman dipanggil dari beberapa thread sekaligus.
+static void EnqueueShot(const Shot *shot) {
+    int slot = atomic_fetch_add_explicit(&shotQueue.reserved, 1, memory_order_relaxed);
+    if (slot < shotQueue.capacity) shotQueue.slots[slot] = *shot;
+}
+
+// Memindahkan 'shot' ke slot kosong di pool tipenya. Mengembalikan false jika pool penuh
+// dan sudah mencapai SHOT_BATCH_MAX_EFFECTS atau tidak bisa diperbesar.
+static bool AddShotToPool(const Shot *shot) {
+    ShotPool *pool = &shotPools[shot->type];
+    if (pool->freeCount == 0) {
+        int newCapacity = pool->capacity > 0 ? pool->capacity * 2 : SHOT_POOL_INITIAL_CAPACITY;
+        if (newCapacity > SHOT_BATCH_MAX_EFFECTS) newCapacity = SHOT_BATCH_MAX_EFFECTS;
+        if (newCapacity <= pool->capacity || !GrowShotPool(pool, newCapacity)) return false;
+    }
+    int index = pool->freeList[--pool->freeCount];
+    pool->items[index] = *shot;
+    pool->live[pool->liveCount++] = index;
+    if (index >= pool->highWater) pool->highWater = index + 1;
+    if (ShotBatch_IsReady()) ShotBatch_Write(shot->type, index, shot);
+    return true;
+}
+
+/* I.S. : Antrian berisi efek yang di-spawn sejak pengurasan terakhir. Tidak ada produsen aktif.
+   F.S. : Semua efek di antrian dipindah ke pool tipenya (pool diperbesar bila perlu) dan
+          antrian kosong. */
+static void DrainShotQueue(void) {
+    int reserved = atomic_load_explicit(&shotQueue.reserved, memory_order_acquire);
+    if (reserved == 0) return;
+    int count = reserved < shotQueue.capacity ? reserved : shotQueue.capacity;
+
+    int rejected = 0;
+    for (int i = 0; i < count; i++) {
+        if (!AddShotToPool(&shotQueue.slots[i])) rejected++;
+    }
+    if (rejected > 0) {
+        TraceLog(LOG_WARNING, "SHOTS: Effect pool full, dropped %d effects.", rejected);
+    }
+
+    if (reserved > shotQueue.capacity) {
+        int newCapacity = shotQueue.capacity;
+        while (newCapacity < reserved) newCapacity *= 2;
+        TraceLog(LOG_WARNING, "SHOTS: Effect queue overflowed, dropped %d effects. Growing queue to %d.",
+                 reserved - shotQueue.capacity, newCapacity);
+        if (!ResizeShotQueue(newCapacity)) {
+            TraceLog(LOG_ERROR, "SHOTS: Failed to grow effect queue to %d slots.", newCapacity);
+        }
+    }
+    atomic_store_explicit(&shotQueue.reserved, 0, memory_order_relaxed);
+}
+
+/* I.S. : Sistem visual tembakan (shots) belum siap digunakan, atau berisi efek dari sesi sebelumnya.
+   F.S. : Pool dan antrian efek visual kosong, jam efek kembali ke 0, dan sistem siap digunakan.
+          Buffer yang sudah ada dipakai ulang. */
 void InitShots(void) {
-    for (int i = 0; i < MAX_VISUAL_SHOTS; i++) {
-        shots[i].active = false;
+    for (int t = 0; t < SHOT_TYPE_COUNT; t++) {
+        if (shotPools[t].capacity == 0 && !GrowShotPool(&shotPools[t], SHOT_POOL_INITIAL_CAPACITY)) {
+            TraceLog(LOG_ERROR, "SHOTS: Failed to allocate effect pool for type %d.", t);
+        }
+        ResetShotPool(&shotPools[t]);
+    }
+    if (shotQueue.capacity == 0 && !ResizeShotQueue(SHOT_QUEUE_INITIAL_CAPACITY)) {
+        TraceLog(LOG_ERROR, "SHOTS: Failed to allocate effect queue.");
     }
+    atomic_store(&shotQueue.reserved, 0);
+    shotClock = 0.0f;
     TraceLog(LOG_INFO, "SHOTS: Visual shot system initialized.");
 }
 
-/* I.S. : Sistem visual tembakan (shots) belum siap digunakan.
-   F.S. : Array internal untuk menampung efek visual telah diinisialisasi dan siap digunakan. */
+/* I.S. : Aset-aset untuk tower (seperti tekstur sprite, tombol UI) belum dimuat.
+   F.S. : Semua aset yang diperlukan oleh modul Tower telah dimuat ke memori. */
 void InitTowerAssets()
 {
-    tower1Texture = LoadTextureSafe("assets/img/gameplay_imgs/tower1.png");
-    tower2Texture = LoadTextureSafe("assets/img/gameplay_imgs/tower2.png");
-    tower3Texture = LoadTextureSafe("assets/img/gameplay_imgs/tower3.png");
-    deleteButtonTex = LoadTextureSafe("assets/img/gameplay_imgs/delete_button.png");
-    upgradeButtonTex = LoadTextureSafe("assets/img/gameplay_imgs/upgrade_button.png");
+    tower1Texture = LoadTextureSafe(MEM_TAG_TOWER, "assets/img/gameplay_imgs/tower1.png");
+    tower2Texture = LoadTextureSafe(MEM_TAG_TOWER, "assets/img/gameplay_imgs/tower2.png");
+    tower3Texture = LoadTextureSafe(MEM_TAG_TOWER, "assets/img/gameplay_imgs/tower3.png");
+    deleteButtonTex = LoadTextureSafe(MEM_TAG_TOWER, "assets/img/gameplay_imgs/delete_button.png");
+    upgradeButtonTex = LoadTextureSafe(MEM_TAG_TOWER, "assets/img/gameplay_imgs/upgrade_button.png");
+    ShotBatch_Init();
     TraceLog(LOG_INFO, "Tower assets initialized.");
 }
 
@@ -67,12 +208,14 @@ void ShutdownTowerAssets()
     UnloadTextureSafe(&tower3Texture);
     UnloadTextureSafe(&deleteButtonTex);
     UnloadTextureSafe(&upgradeButtonTex);
+    ShotBatch_Shutdown();
 
     Tower *current = towersListHead;
     while (current != NULL)
     {
         Tower *next = (Tower *)current->next;
-        free(current);
+        FreeTowerUpgrades(current);
+        Memory_Free(current);
         current = next;
     }
     towersListHead = NULL;
@@ -81,8 +224,15 @@ void ShutdownTowerAssets()
 }   
 
 /* I.S. : Sistem visual tembakan sedang berjalan.
-   F.S. : Tidak ada tindakan spesifik di implementasi saat ini, namun disiapkan untuk dealokasi di masa depan. */
+   F.S. : Pool dan antrian efek visual dibebaskan. */
 void ShutdownShots(void) {
+    for (int t = 0; t < SHOT_TYPE_COUNT; t++) {
+        FreeShotPool(&shotPools[t]);
+    }
+    Memory_Free(shotQueue.slots);
+    shotQueue.slots = NULL;
+    shotQueue.capacity = 0;
+    atomic_store(&shotQueue.reserved, 0);
     TraceLog(LOG_INFO, "SHOTS: Visual shot system shutdown.");
 }
 
@@ -170,9 +320,29 @@ bool CheckOrbitButtonClick(Vector2 mousePos, Vector2 orbitCenter, float orbitRad
     return CheckCollisionPointRec(mousePos, rect);
 }
 
+// Mengirimkan true jika tower di (row, col) akan memutus titik awal atau musuh aktif dari exit.
+// Hanya tile yang bisa dilewati pada peta flow field yang perlu diperiksa; jawabannya memakai
+// analisis cut vertex modul Maze sehingga tidak ada BFS per klik.
+static bool WouldBlockEnemyPath(int row, int col)
+{
+    if (!FlowField_IsActive() || !FlowField_IsWalkable(row, col)) return false;
+    if (Maze_WouldBlockSpawns(row, col)) return true;
+    if (!allActiveEnemies) return false;
+    for (int i = 0; i < maxTotalActiveEnemies; i++)
+    {
+        const Enemy *e = &allActiveEnemies[i];
+        if (!e->active) continue;
+        int enemyRow = (int)(e->position.y / TILE_SIZE);
+        int enemyCol = (int)(e->position.x / TILE_SIZE);
+        if (Maze_WouldIsolateTile(row, col, enemyRow, enemyCol)) return true;
+    }
+    return false;
+}
+
 /* I.S. : Petak di (row, col) adalah petak yang valid dan kosong. Pemain memiliki cukup uang.
    F.S. : Sebuah tower baru dibuat dan ditambahkan ke daftar tower pada posisi tersebut.
-          Uang pemain berkurang, dan tile di peta diperbarui. */
+          Uang pemain berkurang, dan tile di peta diperbarui. Pada peta flow field, tower
+          yang akan memutus jalan musuh ke exit ditolak. */
 void PlaceTower(int row, int col, TowerType type)
 {
 
@@ -181,18 +351,25 @@ void PlaceTower(int row, int col, TowerType type)
         TraceLog(LOG_WARNING, "Cannot place tower: Already a tower at (%d, %d).", row, col);
         return;
     }
-    if (GetMoney() < 50)
+    if (GetMoney() < TOWER_BASE_COST)
     {
         TraceLog(LOG_WARNING, "Cannot place tower: Insufficient money.");
         return;
     }
-    if (GetMapTile(row, col) != 4)
+    int groundTile = GetMapTile(row, col);
+    if (!Maze_IsBuildableTile(groundTile))
+    {
+        TraceLog(LOG_WARNING, "Cannot place tower: Invalid tile type %d at (%d, %d).", groundTile, row, col);
+        return;
+    }
+    if (WouldBlockEnemyPath(row, col))
     {
-        TraceLog(LOG_WARNING, "Cannot place tower: Invalid tile type %d at (%d, %d).", GetMapTile(row, col), row, col);
+        Push(&statusStack, "Cannot place tower: it would block the enemy path.");
+        TraceLog(LOG_WARNING, "Cannot place tower: (%d, %d) would cut enemies off from every exit.", row, col);
         return;
     }
 
-    Tower *newTower = (Tower *)malloc(sizeof(Tower));
+    Tower *newTower = (Tower *)Memory_Alloc(MEM_TAG_TOWER, sizeof(Tower));
     if (newTower == NULL)
     {
         TraceLog(LOG_ERROR, "Failed to allocate memory for new tower.");
@@ -202,9 +379,9 @@ void PlaceTower(int row, int col, TowerType type)
     *newTower = (Tower){0};
     SetTowerPosition(newTower, (Vector2){col * TILE_SIZE + TILE_SIZE / 2.0f, row * TILE_SIZE + TILE_SIZE / 2.0f});
     SetTowerType(newTower, type);
-    SetTowerDamage(newTower, 25);
-    SetTowerRange(newTower, 100.0f);
-    SetTowerAttackSpeed(newTower, 1.0f);
+    SetTowerDamage(newTower, TOWER_BASE_DAMAGE);
+    SetTowerRange(newTower, TOWER_BASE_RANGE);
+    SetTowerAttackSpeed(newTower, TOWER_BASE_ATTACK_SPEED);
     SetTowerAttackCooldown(newTower, 0.3f);
     SetTowerActive(newTower, true);
     newTower->texture = tower1Texture;
@@ -214,14 +391,15 @@ void PlaceTower(int row, int col, TowerType type)
     newTower->frameTimer = 0.0f;
     newTower->row = row;
     newTower->col = col;
-    newTower->totalCost = 50;
+    newTower->totalCost = TOWER_BASE_COST;
+    newTower->groundTile = groundTile;
     newTower->next = NULL;
 
 
     newTower->next = (struct Tower *)towersListHead;
     towersListHead = newTower;
 
-    AddMoney(-50);
+    AddMoney(-TOWER_BASE_COST);
     SetMapTile(row, col, 7);
     Push(&statusStack, "Tower placed successfully."); 
     PlaySpendMoneySound(); // <-- PANGGIL DI SINI
@@ -260,9 +438,10 @@ void RemoveTower(Tower *towerToRemove)
         prev->next = (struct Tower *)current->next;
     }
 
-    SetMapTile(current->row, current->col, 4);
+    SetMapTile(current->row, current->col, current->groundTile);
 
-    free(current);
+    FreeTowerUpgrades(current);
+    Memory_Free(current);
     TraceLog(LOG_INFO, "Tower removed from map at (%d, %d).", towerToRemove->row, towerToRemove->col);
     HideTowerOrbitUI();
 }
@@ -283,131 +462,165 @@ void SellTower(Tower *towerToSell)
     RemoveTower(towerToSell);
 }
 
+// Mengirimkan efek tumbukan bertipe 'type' di 'position' yang mulai terlihat pada 'startTime'.
+static Shot MakeImpactEffect(Vector2 position, ShotType type, Color color, float startTime) {
+    Shot shot = {0};
+    shot.type = type;
+    shot.startPos = position;
+    shot.endPos = position;
+    shot.color = color;
+    shot.startTime = startTime;
+
+    if (type == SHOT_TYPE_AOE_BLAST) {
+        shot.duration = 0.4f;
+        shot.size = 60.0f;
+    } else if (type == SHOT_TYPE_CRIT_SHATTER) {
+        shot.duration = 0.4f;
+        shot.size = 25.0f;
+    } else {
+        shot.duration = 0.2f;
+        shot.size = 10.0f;
+    }
+    return shot;
+}
+
 /* I.S. : Aksi dalam game (misalnya serangan tower) terjadi.
-   F.S. : Sebuah efek visual proyektil baru yang bergerak dari 'startPos' ke 'endPos' dibuat dan diaktifkan. */
+   F.S. : Sebuah efek visual proyektil baru yang bergerak dari 'startPos' ke 'endPos' dibuat dan diaktifkan,
+          diikuti efek tumbukan biasa di 'endPos' yang mulai saat proyektil tiba. */
 void SpawnProjectile(Vector2 startPos, Vector2 endPos, Color color, float radius, float travelTime) {
-    for (int i = 0; i < MAX_VISUAL_SHOTS; i++) {
-        if (!shots[i].active) {
-            
-            shots[i] = (Shot){0};
-            
-            
-            shots[i].type = SHOT_TYPE_PROJECTILE;
-            shots[i].active = true;
-            shots[i].startPos = startPos;
-            shots[i].endPos = endPos;
-            shots[i].color = color;
-            shots[i].radius = radius;
-            shots[i].travelTime = fmax(travelTime, 0.01f);
-            shots[i].currentTravelTime = 0.0f; 
-            
-            TraceLog(LOG_DEBUG, "Spawned PROJECTILE in slot %d.", i);
-            return;
-        }
-    }
-    TraceLog(LOG_WARNING, "FAILED to spawn projectile. No available slots.");
+    Shot shot = {0};
+    shot.type = SHOT_TYPE_PROJECTILE;
+    shot.startPos = startPos;
+    shot.endPos = endPos;
+    shot.color = color;
+    shot.size = radius;
+    shot.startTime = shotClock;
+    shot.duration = fmax(travelTime, 0.01f);
+    EnqueueShot(&shot);
+
+    Shot impact = MakeImpactEffect(endPos, SHOT_TYPE_NORMAL_IMPACT, color, shot.startTime + shot.duration);
+    EnqueueShot(&impact);
 }
 
 /* I.S. : Sebuah proyektil mengenai target atau sebuah serangan area terjadi.
    F.S. : Sebuah efek visual tumbukan (impact) dengan tipe tertentu ('type') dibuat dan diaktifkan di 'position'. */
 void SpawnImpactEffect(Vector2 position, ShotType type, Color color) {
-    for (int i = 0; i < MAX_VISUAL_SHOTS; i++) {
-        if (!shots[i].active) {
-            shots[i] = (Shot){0};
-            shots[i].type = type;
-            shots[i].active = true;
-            shots[i].startPos = position;
-            shots[i].color = color;
-            shots[i].impactTimer = 0.0f;
-            
-            if (type == SHOT_TYPE_AOE_BLAST) {
-                shots[i].impactDuration = 0.4f;
-                shots[i].impactMaxSize = 60.0f;
-            } else if (type == SHOT_TYPE_CRIT_SHATTER) {
-                shots[i].impactDuration = 0.4f;
-                shots[i].impactMaxSize = 25.0f;
-            } else if (type == SHOT_TYPE_NORMAL_IMPACT) {
-                shots[i].impactDuration = 0.2f;
-                shots[i].impactMaxSize = 10.0f;
-            }
-            return;
-        }
-    }
+    Shot shot = MakeImpactEffect(position, type, color, shotClock);
+    EnqueueShot(&shot);
 }
 
-/* I.S. : Posisi dan durasi semua efek visual pada frame sebelumnya.
-   F.S. : Posisi proyektil diperbarui, dan durasi animasi untuk efek tumbukan dikurangi berdasarkan 'deltaTime'.*/
-void UpdateShots(float deltaTime) {
-    for (int i = 0; i < MAX_VISUAL_SHOTS; i++) {
-        if (!shots[i].active) continue;
-
-        
-        if (shots[i].type == SHOT_TYPE_PROJECTILE) {
-            shots[i].currentTravelTime += deltaTime;
+/* I.S. : Sebuah serangan berantai melompat dari 'startPos' ke 'endPos'.
+   F.S. : Sebuah efek visual beam dari 'startPos' ke 'endPos' dibuat dan memudar selama CHAIN_BEAM_DURATION. */
+void SpawnChainBeam(Vector2 startPos, Vector2 endPos, Color color) {
+    Shot shot = {0};
+    shot.type = SHOT_TYPE_CHAIN_BEAM;
+    shot.startPos = startPos;
+    shot.endPos = endPos;
+    shot.color = color;
+    shot.size = 1.5f;
+    shot.startTime = shotClock;
+    shot.duration = CHAIN_BEAM_DURATION;
+    EnqueueShot(&shot);
+}
 
-            
-            if (shots[i].currentTravelTime >= shots[i].travelTime) {
-                
-                
-                shots[i].type = SHOT_TYPE_NORMAL_IMPACT;
-                shots[i].startPos = shots[i].endPos; 
-                shots[i].impactTimer = 0.0f;         
-                shots[i].impactDuration = 0.2f;
-                shots[i].impactMaxSize = 10.0f;
-            }
-        } 
-        
-        else {
-            shots[i].impactTimer += deltaTime;
-            if (shots[i].impactTimer >= shots[i].impactDuration) {
-                shots[i].active = false; 
+/* I.S. : Jam efek dan pool efek visual pada frame sebelumnya.
+   F.S. : Efek di antrian masuk ke pool, jam efek maju sebesar 'deltaTime', dan efek yang sudah
+          selesai dikembalikan ke free-list. Posisi dan animasi efek dihitung dari jam saat digambar. */
+void UpdateShots(float deltaTime) {
+    DrainShotQueue();
+    shotClock += deltaTime;
+
+    for (int t = 0; t < SHOT_TYPE_COUNT; t++) {
+        ShotPool *pool = &shotPools[t];
+        for (int i = 0; i < pool->liveCount; ) {
+            int index = pool->live[i];
+            const Shot *shot = &pool->items[index];
+            if (shotClock < shot->startTime + shot->duration) {
+                i++;
+                continue;
             }
+            pool->freeList[pool->freeCount++] = index;
+            pool->live[i] = pool->live[--pool->liveCount];
         }
+        if (pool->liveCount == 0 && pool->highWater > 0) ResetShotPool(pool);
+    }
+}
+
+// Menggambar satu efek dengan fungsi gambar raylib, dipakai jika shader batch tidak tersedia.
+static void DrawShotDirect(const Shot *shot, float globalScale, float offsetX, float offsetY) {
+    float progress = (shotClock - shot->startTime) / shot->duration;
+    if (progress < 0.0f || progress >= 1.0f) return;
+
+    switch (shot->type) {
+        case SHOT_TYPE_PROJECTILE: {
+            Vector2 currentPos = Vector2Lerp(shot->startPos, shot->endPos, progress);
+            if (!IsWorldPointVisible(currentPos, shot->size * globalScale, globalScale, offsetX, offsetY)) break;
+            Vector2 screenPos = { offsetX + currentPos.x * globalScale, offsetY + currentPos.y * globalScale };
+            DrawCircleV(screenPos, shot->size * globalScale, shot->color);
+        } break;
+
+        case SHOT_TYPE_AOE_BLAST:
+        case SHOT_TYPE_NORMAL_IMPACT: {
+            if (!IsWorldPointVisible(shot->startPos, shot->size * globalScale, globalScale, offsetX, offsetY)) break;
+            float currentRadius = Lerp(0, shot->size, progress);
+            Color currentColor = Fade(shot->color, 1.0f - progress);
+            Vector2 screenPos = { offsetX + shot->startPos.x * globalScale, offsetY + shot->startPos.y * globalScale };
+            DrawCircleGradient(screenPos.x, screenPos.y, currentRadius * globalScale, currentColor, BLANK);
+        } break;
+
+        case SHOT_TYPE_CRIT_SHATTER: {
+            if (!IsWorldPointVisible(shot->startPos, shot->size * globalScale, globalScale, offsetX, offsetY)) break;
+            Color currentColor = Fade(shot->color, 1.0f - progress);
+            Vector2 screenPos = { offsetX + shot->startPos.x * globalScale, offsetY + shot->startPos.y * globalScale };
+            for (int j = 0; j < 6; j++) { 
+                Vector2 endPos = { 
+                    screenPos.x + cosf(DEG2RAD * (j * 60)) * (progress * shot->size * globalScale),
+                    screenPos.y + sinf(DEG2RAD * (j * 60)) * (progress * shot->size * globalScale)
+                };
+                DrawLineEx(screenPos, endPos, 2.0f, currentColor);
+            }                
+        } break;
+
+        case SHOT_TYPE_CHAIN_BEAM: {
+            Vector2 screenStart = { offsetX + shot->startPos.x * globalScale, offsetY + shot->startPos.y * globalScale };
+            Vector2 screenEnd = { offsetX + shot->endPos.x * globalScale, offsetY + shot->endPos.y * globalScale };
+            DrawLineEx(Vector2Add(screenStart, (Vector2){-1,-1}), Vector2Add(screenEnd, (Vector2){-1,-1}), 3.0f, Fade(shot->color, 0.5f * (1.0f - progress)));
+            DrawLineEx(screenStart, screenEnd, 2.0f, Fade(shot->color, 1.0f - progress));
+        } break;
+
+        default: break;
     }
 }
 
 /* I.S. : Terdapat efek visual (shots) yang aktif.
-   F.S. : Semua efek visual yang 'active' digambar ke layar sesuai dengan tipe dan propertinya. */
+   F.S. : Efek di antrian masuk ke pool, lalu semua efek yang hidup digambar ke layar sesuai
+          dengan tipe dan propertinya: satu draw call per tipe jika shader batch tersedia,
+          atau satu per satu dengan fungsi gambar raylib jika tidak. */
 void DrawShots(float globalScale, float offsetX, float offsetY) {
-    for (int i = 0; i < MAX_VISUAL_SHOTS; i++) {
-        if (shots[i].active) {
-            switch (shots[i].type) {
-                case SHOT_TYPE_PROJECTILE: {
-                    float progress = shots[i].currentTravelTime / shots[i].travelTime;
-                    Vector2 currentPos = Vector2Lerp(shots[i].startPos, shots[i].endPos, progress);
-                    Vector2 screenPos = { offsetX + currentPos.x * globalScale, offsetY + currentPos.y * globalScale };
-                    DrawCircleV(screenPos, shots[i].radius * globalScale, shots[i].color);
-                } break;
-
-                case SHOT_TYPE_AOE_BLAST: {
-                    float progress = shots[i].impactTimer / shots[i].impactDuration;
-                    float currentRadius = Lerp(0, shots[i].impactMaxSize, progress);
-                    Color currentColor = Fade(shots[i].color, 1.0f - progress);
-                    Vector2 screenPos = { offsetX + shots[i].startPos.x * globalScale, offsetY + shots[i].startPos.y * globalScale };
-                    DrawCircleGradient(screenPos.x, screenPos.y, currentRadius * globalScale, currentColor, BLANK);
-                } break;
-                case SHOT_TYPE_NORMAL_IMPACT: { 
-                    float progress = shots[i].impactTimer / shots[i].impactDuration;
-                    float currentRadius = Lerp(0, shots[i].impactMaxSize, progress);
-                    Color currentColor = Fade(shots[i].color, 1.0f - progress);
-                    Vector2 screenPos = { offsetX + shots[i].startPos.x * globalScale, offsetY + shots[i].startPos.y * globalScale };
-                    DrawCircleGradient(screenPos.x, screenPos.y, currentRadius * globalScale, currentColor, BLANK);
-                } break;
-                
-
-                case SHOT_TYPE_CRIT_SHATTER: {
-                    float progress = shots[i].impactTimer / shots[i].impactDuration;
-                    Color currentColor = Fade(shots[i].color, 1.0f - progress);
-                    Vector2 screenPos = { offsetX + shots[i].startPos.x * globalScale, offsetY + shots[i].startPos.y * globalScale };
-                    for (int j = 0; j < 6; j++) { 
-                        Vector2 endPos = { 
-                            screenPos.x + cosf(DEG2RAD * (j * 60)) * (progress * shots[i].impactMaxSize * globalScale),
-                            screenPos.y + sinf(DEG2RAD * (j * 60)) * (progress * shots[i].impactMaxSize * globalScale)
-                        };
-                        DrawLineEx(screenPos, endPos, 2.0f, currentColor);
-                    }                
-                } break;
+    DrainShotQueue();
+
+    for (int t = 0; t < SHOT_TYPE_COUNT; t++) {
+        const ShotPool *pool = &shotPools[t];
+        if (pool->liveCount == 0) continue;
+
+        if (ShotBatch_IsReady()) {
+            // Mesh batch mengikuti kapasitas pool. Isi slot lama ikut disalin saat mesh diperbesar,
+            // jadi hanya efek hidup di slot yang belum muat di mesh lama yang ditulis ulang.
+            int meshCapacity = ShotBatch_GetCapacity(t);
+            if (meshCapacity < pool->capacity) {
+                ShotBatch_Reserve(t, pool->capacity);
+                if (ShotBatch_GetCapacity(t) > meshCapacity) {
+                    for (int i = 0; i < pool->liveCount; i++) {
+                        int index = pool->live[i];
+                        if (index >= meshCapacity) ShotBatch_Write(t, index, &pool->items[index]);
+                    }
+                }
             }
+            ShotBatch_Draw(t, pool->highWater, shotClock, globalScale, offsetX, offsetY);
+            continue;
+        }
+        for (int i = 0; i < pool->liveCount; i++) {
+            DrawShotDirect(&pool->items[pool->live[i]], globalScale, offsetX, offsetY);
         }
     }
 }
@@ -458,22 +671,21 @@ void UpdateTowerAttacks(EnemyWave *wave, float deltaTime)
 
                 
                 if (current->hasStunEffect && GetRandomValue(1, 100) <= current->stunChance) {
-                    mainTarget->isStunned = true;
-                    mainTarget->stunTimer = current->stunDuration;
+                    StunEnemy(mainTarget, current->stunDuration);
                     shotColor = SKYBLUE; 
                 }
 
                 
                 if (current->hasAreaAttack) {
                     shotColor = ORANGE;
-                    SetEnemyHP(mainTarget, GetEnemyHP(mainTarget) - damage);
+                    DamageEnemy(mainTarget, damage, DAMAGE_AREA);
                     SpawnImpactEffect(GetEnemyPosition(mainTarget), SHOT_TYPE_AOE_BLAST, shotColor);
                     
                     
                     for (int k = 0; k < maxTotalActiveEnemies; k++) {
                         if (allActiveEnemies[k].active && &allActiveEnemies[k] != mainTarget) {
                             if (Vector2Distance(GetEnemyPosition(mainTarget), GetEnemyPosition(&allActiveEnemies[k])) <= current->areaAttackRadius) {
-                                SetEnemyHP(&allActiveEnemies[k], GetEnemyHP(&allActiveEnemies[k]) - damage);
+                                DamageEnemy(&allActiveEnemies[k], damage, DAMAGE_AREA);
                             }
                         }
                     }
@@ -486,9 +698,8 @@ void UpdateTowerAttacks(EnemyWave *wave, float deltaTime)
 
                     
                     for (int i = 0; i <= current->chainJumps && currentTarget != NULL; i++) {
-                        SetEnemyHP(currentTarget, GetEnemyHP(currentTarget) - damage);
-                        DrawLineEx(Vector2Add(lastPos, (Vector2){-1,-1}), Vector2Add(GetEnemyPosition(currentTarget), (Vector2){-1,-1}), 3.0f, Fade(shotColor, 0.5f));
-                        DrawLineEx(lastPos, GetEnemyPosition(currentTarget), 2.0f, shotColor);
+                        DamageEnemy(currentTarget, damage, DAMAGE_CHAIN);
+                        SpawnChainBeam(lastPos, GetEnemyPosition(currentTarget), shotColor);
                         SpawnImpactEffect(GetEnemyPosition(currentTarget), SHOT_TYPE_CRIT_SHATTER, shotColor);
                         
                         lastPos = GetEnemyPosition(currentTarget);
@@ -498,7 +709,7 @@ void UpdateTowerAttacks(EnemyWave *wave, float deltaTime)
                     }
                 } else {
                     
-                    SetEnemyHP(mainTarget, GetEnemyHP(mainTarget) - damage);
+                    DamageEnemy(mainTarget, damage, DAMAGE_PROJECTILE);
                     
                     
                     SpawnProjectile(GetTowerPosition(current), GetEnemyPosition(mainTarget), shotColor, 3.0f, 0.05f);
@@ -542,6 +753,18 @@ void DrawTowers(float globalScale, float offsetX, float offsetY)
 
         Vector2 pos = GetTowerPosition(current);
 
+        // Lewati tower yang sprite-nya berada di luar layar.
+        Rectangle worldRect = {
+            pos.x - (current->frameWidth * TOWER_DRAW_SCALE / 2.0f),
+            pos.y - (current->frameHeight * TOWER_DRAW_SCALE) + TOWER_Y_OFFSET_PIXELS,
+            current->frameWidth * TOWER_DRAW_SCALE,
+            current->frameHeight * TOWER_DRAW_SCALE};
+        if (!IsWorldRectVisible(worldRect, globalScale, offsetX, offsetY))
+        {
+            current = (Tower *)current->next;
+            continue;
+        }
+
         float finalDrawWidth = current->frameWidth * TOWER_DRAW_SCALE * globalScale;
         float finalDrawHeight = current->frameHeight * TOWER_DRAW_SCALE * globalScale;
 
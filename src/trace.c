@@ -0,0 +1,191 @@
+/* File        : trace.c
+* Deskripsi   : Implementasi untuk modul Trace.
+*               Setiap thread memiliki ring buffer single-producer/single-consumer:
+*               thread pemilik hanya memajukan 'head', thread flusher hanya memajukan
+*               'tail', sehingga keduanya cukup memakai atomic load/store tanpa lock.
+*               Buffer baru didaftarkan ke linked list global dengan compare-and-swap.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#define _POSIX_C_SOURCE 199309L    // nanosleep dan clock_gettime
+
+#include "trace.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+
+#define TRACE_BUFFER_MASK (TRACE_BUFFER_EVENTS - 1)
+
+/* Satu event trace. 'name' menunjuk ke string literal milik pemanggil. */
+typedef struct {
+    const char *name;
+    double timestampUs;
+    char phase;
+} TraceEvent;
+
+/* Ring buffer milik satu thread. */
+typedef struct TraceThreadBuffer {
+    TraceEvent events[TRACE_BUFFER_EVENTS];
+    atomic_uint head;
+    atomic_uint tail;
+    atomic_uint dropped;
+    int threadId;
+    struct TraceThreadBuffer *next;
+} TraceThreadBuffer;
+
+static _Atomic(TraceThreadBuffer *) bufferListHead = NULL;
+static _Thread_local TraceThreadBuffer *localBuffer = NULL;
+static atomic_int nextThreadId = 1;
+static atomic_bool traceActive = false;
+static atomic_bool flusherStopRequested = false;
+static pthread_t flusherThread;
+static FILE *traceFile = NULL;
+static bool firstEventWritten = false;
+static double traceStartTime = 0.0;
+
+// Mengirimkan waktu monotonic dalam detik. Tidak memakai GetTime() karena timer raylib baru
+// diinisialisasi oleh InitWindow, sedangkan tracing boleh dimulai sebelumnya.
+static double TraceNowSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1000000000.0;
+}
+
+// Membuat dan mendaftarkan buffer untuk thread pemanggil.
+static TraceThreadBuffer *RegisterThreadBuffer(void) {
+    TraceThreadBuffer *buffer = (TraceThreadBuffer *)calloc(1, sizeof(TraceThreadBuffer));
+    if (buffer == NULL) return NULL;
+    atomic_init(&buffer->head, 0);
+    atomic_init(&buffer->tail, 0);
+    atomic_init(&buffer->dropped, 0);
+    buffer->threadId = atomic_fetch_add(&nextThreadId, 1);
+
+    TraceThreadBuffer *oldHead = atomic_load(&bufferListHead);
+    do {
+        buffer->next = oldHead;
+    } while (!atomic_compare_exchange_weak(&bufferListHead, &oldHead, buffer));
+
+    localBuffer = buffer;
+    return buffer;
+}
+
+// Menulis semua event yang belum di-flush dari 'buffer' ke file.
+static void DrainBuffer(TraceThreadBuffer *buffer) {
+    unsigned int head = atomic_load_explicit(&buffer->head, memory_order_acquire);
+    unsigned int tail = atomic_load_explicit(&buffer->tail, memory_order_relaxed);
+    while (tail != head) {
+        const TraceEvent *event = &buffer->events[tail & TRACE_BUFFER_MASK];
+        fprintf(traceFile, "%s\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}",
+                firstEventWritten ? "," : "", event->name, event->phase, event->timestampUs, buffer->threadId);
+        firstEventWritten = true;
+        tail++;
+    }
+    atomic_store_explicit(&buffer->tail, tail, memory_order_release);
+}
+
+// Menulis isi semua buffer yang terdaftar ke file.
+static void DrainAllBuffers(void) {
+    for (TraceThreadBuffer *buffer = atomic_load(&bufferListHead); buffer != NULL; buffer = buffer->next) {
+        DrainBuffer(buffer);
+    }
+}
+
+// Fungsi utama thread flusher: menguras buffer secara berkala sampai diminta berhenti.
+static void *FlusherThreadMain(void *arg) {
+    (void)arg;
+    struct timespec interval = { 0, TRACE_FLUSH_INTERVAL_MS * 1000000L };
+    while (!atomic_load(&flusherStopRequested)) {
+        DrainAllBuffers();
+        nanosleep(&interval, NULL);
+    }
+    return NULL;
+}
+
+/* I.S. : Tracing tidak aktif.
+   F.S. : File 'fileName' dibuat, thread flusher berjalan, dan event mulai direkam.
+          Mengembalikan false jika file atau thread gagal dibuat. */
+bool Trace_Init(const char *fileName) {
+    if (atomic_load(&traceActive)) return true;
+
+    traceFile = fopen(fileName, "w");
+    if (!traceFile) {
+        TraceLog(LOG_WARNING, "TRACE: Failed to open %s for writing.", fileName);
+        return false;
+    }
+    fprintf(traceFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    firstEventWritten = false;
+    traceStartTime = TraceNowSeconds();
+
+    atomic_store(&flusherStopRequested, false);
+    if (pthread_create(&flusherThread, NULL, FlusherThreadMain, NULL) != 0) {
+        TraceLog(LOG_WARNING, "TRACE: Failed to start flusher thread.");
+        fclose(traceFile);
+        traceFile = NULL;
+        return false;
+    }
+
+    atomic_store(&traceActive, true);
+    TraceLog(LOG_INFO, "TRACE: Recording to %s.", fileName);
+    return true;
+}
+
+/* I.S. : Tracing mungkin aktif.
+   F.S. : Perekaman dihentikan, semua event yang tersisa ditulis, file JSON ditutup
+          dengan benar, dan semua buffer dibebaskan. */
+void Trace_Shutdown(void) {
+    if (!atomic_load(&traceActive)) return;
+    atomic_store(&traceActive, false);
+
+    atomic_store(&flusherStopRequested, true);
+    pthread_join(flusherThread, NULL);
+    DrainAllBuffers();
+
+    unsigned int totalDropped = 0;
+    TraceThreadBuffer *buffer = atomic_exchange(&bufferListHead, NULL);
+    while (buffer != NULL) {
+        TraceThreadBuffer *next = buffer->next;
+        totalDropped += atomic_load(&buffer->dropped);
+        free(buffer);
+        buffer = next;
+    }
+    // Buffer thread utama sudah dibebaskan; thread lain tidak lagi merekam karena traceActive false.
+    localBuffer = NULL;
+
+    fprintf(traceFile, "\n]}\n");
+    fclose(traceFile);
+    traceFile = NULL;
+    if (totalDropped > 0) {
+        TraceLog(LOG_WARNING, "TRACE: %u events dropped because a thread buffer was full.", totalDropped);
+    }
+    TraceLog(LOG_INFO, "TRACE: Recording stopped.");
+}
+
+/* I.S. : Sembarang.
+   F.S. : Jika tracing aktif, satu event dengan fase 'phase' ('B' atau 'E') dicatat ke
+          ring buffer thread pemanggil. Jika buffer penuh, event dibuang dan dihitung. */
+void Trace_Emit(const char *name, char phase) {
+    if (!atomic_load_explicit(&traceActive, memory_order_relaxed)) return;
+
+    TraceThreadBuffer *buffer = localBuffer != NULL ? localBuffer : RegisterThreadBuffer();
+    if (buffer == NULL) return;
+
+    unsigned int head = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+    unsigned int tail = atomic_load_explicit(&buffer->tail, memory_order_acquire);
+    if (head - tail >= TRACE_BUFFER_EVENTS) {
+        atomic_fetch_add_explicit(&buffer->dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    TraceEvent *event = &buffer->events[head & TRACE_BUFFER_MASK];
+    event->name = name;
+    event->phase = phase;
+    event->timestampUs = (TraceNowSeconds() - traceStartTime) * 1000000.0;
+    atomic_store_explicit(&buffer->head, head + 1, memory_order_release);
+}
+
+/* Mengirimkan true jika tracing sedang aktif. */
+bool Trace_IsActive(void) {
+    return atomic_load(&traceActive);
+}
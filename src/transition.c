@@ -8,12 +8,15 @@
 
 #include "transition.h"
 #include "main_menu.h" 
+#include "trace.h"
+#include "utils.h"
 
 void PlayTransitionAnimation(GameState targetState) { 
+    TRACE_BEGIN("PlayTransitionAnimation");
     const int screenWidth = GetScreenWidth();
     const int screenHeight = GetScreenHeight();
 
-    Texture2D backgroundTex = LoadTexture("assets/img/mainmenu_imgs/background.jpg"); 
+    Texture2D backgroundTex = LoadTextureSafe(MEM_TAG_OTHER, "assets/img/mainmenu_imgs/background.jpg"); 
 
     const char* transitionText;
     switch (targetState) {
@@ -99,5 +102,6 @@ void PlayTransitionAnimation(GameState targetState) {
         EndDrawing();
     }
 
-    UnloadTexture(backgroundTex); 
+    UnloadTextureSafe(&backgroundTex); 
+    TRACE_END("PlayTransitionAnimation");
 }
\ No newline at end of file
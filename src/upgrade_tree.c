@@ -12,6 +12,7 @@
 #include "utils.h"
 #include "status.h"
 #include "audio.h"
+#include "memory_tracker.h"
 
 static Texture2D upgradeIcon_AttackSpeedBase = {0};
 static Texture2D upgradeIcon_AttackPowerBase = {0};
@@ -36,6 +37,8 @@ TowerUpgradeTree tower1UpgradeTree;
 UpgradeNode* pendingUpgradeNode = NULL;
 Vector2 pendingUpgradeIconPos = { 0 };
 
+static void ClearTowerStatsCache(void);
+
 // Fungsi ini menambahkan 'child' sebagai anak dari 'parent' dalam struktur pohon.
 // Ini mengatur pointer parent dari anak dan menambahkannya ke daftar anak-anak parent.
 void AddChild(UpgradeNode* parent, UpgradeNode* child) {
@@ -60,7 +63,7 @@ F.S.: 'UpgradeNode' baru telah dialokasikan di memori dan semua propertinya tela
 Fungsi mengembalikan pointer ke node baru tersebut. Jika alokasi memori gagal, fungsi akan mengembalikan NULL.*/
 UpgradeNode *CreateUpgradeNode(UpgradeType type, const char *name, const char *desc, int cost, UpgradeNode *parent, int exclusiveGroupId)
 {
-    UpgradeNode *node = (UpgradeNode *)malloc(sizeof(UpgradeNode));
+    UpgradeNode *node = (UpgradeNode *)Memory_Alloc(MEM_TAG_UPGRADE, sizeof(UpgradeNode));
     if (node == NULL)
     {
         TraceLog(LOG_ERROR, "Failed to allocate UpgradeNode for %s", name);
@@ -77,32 +80,200 @@ UpgradeNode *CreateUpgradeNode(UpgradeType type, const char *name, const char *d
 
     node->status = UPGRADE_LOCKED;
     node->effectType = EFFECT_NONE;
+    node->flatIndex = -1;
     return node;
 }
 
+// Mengirimkan jumlah node di subtree 'node'.
+static int CountUpgradeNodes(const UpgradeNode *node) {
+    if (!node) return 0;
+    int count = 1;
+    for (const UpgradeNode *child = node->firstChild; child != NULL; child = child->nextSibling) {
+        count += CountUpgradeNodes(child);
+    }
+    return count;
+}
+
+// Menyimpan subtree 'node' ke 'tree->nodes' mulai dari indeks '*next' dalam urutan pre-order.
+static void FlattenUpgradeNode(TowerUpgradeTree *tree, UpgradeNode *node, int parent, int *next) {
+    int index = (*next)++;
+    node->flatIndex = index;
+    tree->nodes[index] = (FlatUpgradeNode){ node, parent, 0, 0, 0 };
+    for (UpgradeNode *child = node->firstChild; child != NULL; child = child->nextSibling) {
+        FlattenUpgradeNode(tree, child, index, next);
+    }
+    tree->nodes[index].subtreeEnd = *next;
+}
+
+// Mengirimkan slot awal tabel hash untuk 'type'.
+static int TypeSlotOf(const TowerUpgradeTree *tree, UpgradeType type) {
+    return (int)(((unsigned int)type * 2654435761u) & (unsigned int)(tree->typeSlotCount - 1));
+}
+
+// Mengirimkan entri pohon pipih milik 'node', atau NULL jika 'node' bukan bagian dari 'tree' yang dikompilasi.
+static const FlatUpgradeNode *FlatNodeOf(const TowerUpgradeTree *tree, const UpgradeNode *node) {
+    if (!tree || !node || node->flatIndex < 0 || node->flatIndex >= tree->nodeCount) return NULL;
+    const FlatUpgradeNode *flat = &tree->nodes[node->flatIndex];
+    return flat->node == node ? flat : NULL;
+}
+
+// Mengosongkan pohon pipih 'tree' tanpa menyentuh pohon pointer.
+static void ClearFlatUpgradeTree(TowerUpgradeTree *tree) {
+    Memory_Free(tree->nodes);
+    Memory_Free(tree->childIndices);
+    Memory_Free(tree->typeSlots);
+    tree->nodes = NULL;
+    tree->childIndices = NULL;
+    tree->typeSlots = NULL;
+    tree->nodeCount = 0;
+    tree->typeSlotCount = 0;
+    tree->bitsetWords = 0;
+}
+
+/* I.S. : 'tree->root' adalah pohon pointer yang baru dibangun atau baru ditambah node.
+   F.S. : Array pre-order, rentang anak, dan tabel hash tipe -> indeks dibangun ulang dari pohon
+          pointer. Mengembalikan false jika alokasi gagal (pohon pipih dikosongkan). */
+bool CompileUpgradeTree(TowerUpgradeTree *tree) {
+    if (!tree) return false;
+    int nodeCount = CountUpgradeNodes(tree->root);
+    if (nodeCount == 0) {
+        ClearFlatUpgradeTree(tree);
+        return true;
+    }
+    int slotCount = 16;
+    while (slotCount < nodeCount * 2) slotCount *= 2;
+
+    FlatUpgradeNode *nodes = (FlatUpgradeNode *)Memory_Realloc(MEM_TAG_UPGRADE, tree->nodes, sizeof(FlatUpgradeNode) * nodeCount);
+    if (nodes) tree->nodes = nodes;
+    int *childIndices = nodes ? (int *)Memory_Realloc(MEM_TAG_UPGRADE, tree->childIndices, sizeof(int) * nodeCount) : NULL;
+    if (childIndices) tree->childIndices = childIndices;
+    int *typeSlots = childIndices ? (int *)Memory_Realloc(MEM_TAG_UPGRADE, tree->typeSlots, sizeof(int) * slotCount) : NULL;
+    if (typeSlots) tree->typeSlots = typeSlots;
+    if (!typeSlots) {
+        TraceLog(LOG_ERROR, "Failed to allocate flattened upgrade tree with %d nodes.", nodeCount);
+        ClearFlatUpgradeTree(tree);
+        return false;
+    }
+    ClearTowerStatsCache();
+    tree->nodeCount = nodeCount;
+    tree->typeSlotCount = slotCount;
+    tree->bitsetWords = (nodeCount + 63) / 64;
+
+    int next = 0;
+    FlattenUpgradeNode(tree, tree->root, -1, &next);
+
+    // Anak langsung node i adalah i + 1, lalu node setelah subtree anak sebelumnya.
+    int childCursor = 0;
+    for (int i = 0; i < nodeCount; i++) {
+        FlatUpgradeNode *flat = &tree->nodes[i];
+        flat->childStart = childCursor;
+        for (int c = i + 1; c < flat->subtreeEnd; c = tree->nodes[c].subtreeEnd) {
+            tree->childIndices[childCursor++] = c;
+        }
+        flat->childCount = childCursor - flat->childStart;
+    }
+
+    for (int i = 0; i < slotCount; i++) tree->typeSlots[i] = -1;
+    for (int i = 0; i < nodeCount; i++) {
+        UpgradeType type = tree->nodes[i].node->type;
+        int slot = TypeSlotOf(tree, type);
+        while (tree->typeSlots[slot] >= 0 && tree->nodes[tree->typeSlots[slot]].node->type != type) {
+            slot = (slot + 1) & (slotCount - 1);
+        }
+        if (tree->typeSlots[slot] >= 0) {
+            TraceLog(LOG_WARNING, "Upgrade type %d appears more than once; keeping the first node.", type);
+            continue;
+        }
+        tree->typeSlots[slot] = i;
+    }
+    return true;
+}
+
+/* Mengirimkan node bertipe 'type' di 'tree' dalam O(1), atau NULL jika tidak ada. */
+UpgradeNode *FindUpgradeNodeByType(const TowerUpgradeTree *tree, UpgradeType type) {
+    if (!tree || tree->nodeCount == 0) return NULL;
+    int slot = TypeSlotOf(tree, type);
+    while (tree->typeSlots[slot] >= 0) {
+        UpgradeNode *node = tree->nodes[tree->typeSlots[slot]].node;
+        if (node->type == type) return node;
+        slot = (slot + 1) & (tree->typeSlotCount - 1);
+    }
+    return NULL;
+}
+
+// Mengirimkan true jika 'tower' sudah membeli node ke-'index' pohon pipih.
+static bool IsNodePurchased(const Tower *tower, int index) {
+    int word = index / 64;
+    return word < tower->upgradeBitWords && (tower->upgradeBits[word] >> (index % 64)) & 1u;
+}
+
+// Mengirimkan true jika 'tower' sudah membeli paling sedikit satu upgrade.
+static bool HasAnyUpgrade(const Tower *tower) {
+    uint64_t any = 0;
+    for (int i = 0; i < tower->upgradeBitWords; i++) any |= tower->upgradeBits[i];
+    return any != 0;
+}
+
+/* Mengirimkan true jika 'tower' sudah membeli upgrade 'type' di 'tower1UpgradeTree'. */
+bool HasTowerUpgrade(const Tower *tower, UpgradeType type) {
+    const UpgradeNode *node = FindUpgradeNodeByType(&tower1UpgradeTree, type);
+    return tower && node && IsNodePurchased(tower, node->flatIndex);
+}
+
+/* I.S. : Bitset upgrade 'tower' mungkin lebih kecil dari pohon yang sedang dikompilasi.
+   F.S. : Bit node bertipe 'type' di 'tower1UpgradeTree' diset. Mengembalikan false jika
+          tipe tidak ada di pohon atau bitset gagal diperbesar. */
+bool MarkTowerUpgrade(Tower *tower, UpgradeType type) {
+    const UpgradeNode *node = FindUpgradeNodeByType(&tower1UpgradeTree, type);
+    if (!tower || !node) return false;
+
+    int words = tower1UpgradeTree.bitsetWords;
+    if (tower->upgradeBitWords < words) {
+        uint64_t *bits = (uint64_t *)Memory_Realloc(MEM_TAG_TOWER, tower->upgradeBits, sizeof(uint64_t) * words);
+        if (!bits) {
+            TraceLog(LOG_ERROR, "Failed to grow upgrade bitset to %d words.", words);
+            return false;
+        }
+        memset(bits + tower->upgradeBitWords, 0, sizeof(uint64_t) * (words - tower->upgradeBitWords));
+        tower->upgradeBits = bits;
+        tower->upgradeBitWords = words;
+    }
+    tower->upgradeBits[node->flatIndex / 64] |= (uint64_t)1 << (node->flatIndex % 64);
+    return true;
+}
+
+/* I.S. : 'tower' mungkin memiliki bitset upgrade.
+   F.S. : Bitset upgrade 'tower' dibebaskan dan semua upgrade dianggap belum dibeli. */
+void FreeTowerUpgrades(Tower *tower) {
+    if (!tower) return;
+    Memory_Free(tower->upgradeBits);
+    tower->upgradeBits = NULL;
+    tower->upgradeBitWords = 0;
+}
+
 /* I.S. : 'tree' adalah struct TowerUpgradeTree yang sembarang (belum diinisialisasi).
    F.S. : 'tree' telah diinisialisasi, semua node upgrade telah dibuat dan terhubung,
           membentuk sebuah pohon upgrade yang lengkap untuk 'type' tower yang ditentukan. */
 void InitUpgradeTree(TowerUpgradeTree *tree, TowerType type)
 {
     // Memuat semua tekstur ikon yang dibutuhkan
-    lockedIconTex = LoadTextureSafe("assets/img/upgrade_imgs/locked.png");
+    lockedIconTex = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/locked.png");
     
-    upgradeIcon_AttackSpeedBase = LoadTextureSafe("assets/img/upgrade_imgs/speed_upgrade.png"); 
-    upgradeIcon_AttackPowerBase = LoadTextureSafe("assets/img/upgrade_imgs/power_upgrade.png"); 
-    upgradeIcon_SpecialEffectBase = LoadTextureSafe("assets/img/upgrade_imgs/special_effect.png"); 
-    upgradeIcon_LightningAttack = LoadTextureSafe("assets/img/upgrade_imgs/flash_upgrade.png"); 
-    upgradeIcon_ChainAttack = LoadTextureSafe("assets/img/upgrade_imgs/chains_upgrade.png"); 
-    upgradeIcon_AreaAttack = LoadTextureSafe("assets/img/upgrade_imgs/aoe_upgrade.png"); 
-    upgradeIcon_CriticalAttack = LoadTextureSafe("assets/img/upgrade_imgs/critical_upgrade.png"); 
-    upgradeIcon_StunEffect = LoadTextureSafe("assets/img/upgrade_imgs/stun_upgrade.png"); 
-    upgradeIcon_WideChainRange = LoadTextureSafe("assets/img/upgrade_imgs/chains_upgrade(2).png"); 
-    upgradeIcon_LargeAoERadius = LoadTextureSafe("assets/img/upgrade_imgs/aoe_upgrade(2).png"); 
-    upgradeIcon_HighCritChance = LoadTextureSafe("assets/img/upgrade_imgs/critical_upgrade(2).png"); 
-    upgradeIcon_LethalPoison = LoadTextureSafe("assets/img/upgrade_imgs/poison_upgrade.png"); 
-    upgradeIcon_MassSlow = LoadTextureSafe("assets/img/upgrade_imgs/slow_upgrade.png"); 
-    upgradeIcon_CustomStat = LoadTextureSafe("assets/img/upgrade_imgs/nodeskill.png"); 
-    acceptIconTex = LoadTextureSafe("assets/img/upgrade_imgs/accept.png"); 
+    upgradeIcon_AttackSpeedBase = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/speed_upgrade.png"); 
+    upgradeIcon_AttackPowerBase = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/power_upgrade.png"); 
+    upgradeIcon_SpecialEffectBase = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/special_effect.png"); 
+    upgradeIcon_LightningAttack = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/flash_upgrade.png"); 
+    upgradeIcon_ChainAttack = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/chains_upgrade.png"); 
+    upgradeIcon_AreaAttack = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/aoe_upgrade.png"); 
+    upgradeIcon_CriticalAttack = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/critical_upgrade.png"); 
+    upgradeIcon_StunEffect = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/stun_upgrade.png"); 
+    upgradeIcon_WideChainRange = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/chains_upgrade(2).png"); 
+    upgradeIcon_LargeAoERadius = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/aoe_upgrade(2).png"); 
+    upgradeIcon_HighCritChance = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/critical_upgrade(2).png"); 
+    upgradeIcon_LethalPoison = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/poison_upgrade.png"); 
+    upgradeIcon_MassSlow = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/slow_upgrade.png"); 
+    upgradeIcon_CustomStat = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/nodeskill.png"); 
+    acceptIconTex = LoadTextureSafe(MEM_TAG_UPGRADE, "assets/img/upgrade_imgs/accept.png"); 
 
     TraceLog(LOG_INFO, "Initializing upgrade tree for Tower Type %d", type);
 
@@ -148,6 +319,8 @@ void InitUpgradeTree(TowerUpgradeTree *tree, TowerType type)
     AddChild(chain, wideChain);
     AddChild(area, largeAoE);
     AddChild(critical, highCrit);
+
+    CompileUpgradeTree(tree);
 }
 
 /* Mengirimkan aset Texture2D yang berasosiasi dengan 'type' upgrade tertentu. */
@@ -190,84 +363,80 @@ Texture2D GetUpgradeIconTexture(UpgradeType type)
 }
 
 //Mengembalikan true jika ada saudara eksklusif yang sudah dibeli, false jika tidak.
-static bool IsExclusiveSiblingPurchased(const UpgradeNode *node, const struct Tower *tower) {
-    if (!node || !node->parent || !tower || node->exclusiveGroupId == 0) {
+static bool IsExclusiveSiblingPurchased(const TowerUpgradeTree *tree, int index, const struct Tower *tower) {
+    const FlatUpgradeNode *flat = &tree->nodes[index];
+    if (flat->parent < 0 || flat->node->exclusiveGroupId == 0) {
         return false;
     }
 
-    UpgradeNode* parent = node->parent;
-    UpgradeNode* sibling = parent->firstChild;
-    while (sibling != NULL) {
-        if (sibling != node && sibling->exclusiveGroupId == node->exclusiveGroupId && tower->purchasedUpgrades[sibling->type]) {
+    const FlatUpgradeNode *parent = &tree->nodes[flat->parent];
+    for (int i = 0; i < parent->childCount; i++) {
+        int siblingIndex = tree->childIndices[parent->childStart + i];
+        const UpgradeNode *sibling = tree->nodes[siblingIndex].node;
+        if (siblingIndex != index && sibling->exclusiveGroupId == flat->node->exclusiveGroupId && IsNodePurchased(tower, siblingIndex)) {
             return true; 
         }
-        sibling = sibling->nextSibling;
     }
 
     return false; 
 }
 
-// Fungsi rekursif internal untuk menelusuri pohon
-static UpgradeNode* FindCurrentUpgradeNode_Recursive(UpgradeNode* currentNode, const struct Tower* tower) {
-    if (!currentNode || !tower) return NULL;
-
-    UpgradeNode* child = currentNode->firstChild;
-    while (child != NULL) {
-        if (tower->purchasedUpgrades[child->type]) {
-            return FindCurrentUpgradeNode_Recursive(child, tower);
-        }
-        child = child->nextSibling;
-    }
-    if (tower->purchasedUpgrades[currentNode->type] || currentNode->parent == NULL) {
-        return currentNode;
-    }
-    return currentNode->parent;
-}
-
-// Fungsi publik yang akan dipanggil dari luar
+// Fungsi publik yang akan dipanggil dari luar.
+// Menuruni pohon lewat anak yang sudah dibeli sampai tidak ada lagi anak yang dibeli.
 UpgradeNode* FindCurrentUpgradeNode(const struct Tower* tower) {
-    if (!tower || !tower1UpgradeTree.root) return NULL;
-    return FindCurrentUpgradeNode_Recursive(tower1UpgradeTree.root, tower);
-}
-
-/* I.S. : Status dari 'node' dan semua turunannya mungkin belum sesuai dengan kondisi 'tower' saat ini.
-   F.S. : Status dari 'node' dan semua turunannya telah diperbarui. */
-static void UpdateAllNodesRecursive(UpgradeNode* node, const struct Tower* tower) {
-    if (!node || !tower) return;
-
-    if (tower->purchasedUpgrades[node->type]) {
-        node->status = UPGRADE_PURCHASED;
-    } else {
-        if (node->parent == NULL) { 
-            node->status = UPGRADE_PURCHASED; 
-        } else if (node->parent->status != UPGRADE_PURCHASED) {
-            node->status = UPGRADE_LOCKED; 
-        } else {
-            if (IsExclusiveSiblingPurchased(node, tower)) {
-                node->status = UPGRADE_LOCKED_EXCLUDED; 
-            } else {
-                node->status = UPGRADE_UNLOCKED; 
+    const TowerUpgradeTree *tree = &tower1UpgradeTree;
+    if (!tower || tree->nodeCount == 0) return NULL;
+
+    int index = 0;
+    bool descended = HasAnyUpgrade(tower);
+    while (descended) {
+        descended = false;
+        const FlatUpgradeNode *flat = &tree->nodes[index];
+        for (int i = 0; i < flat->childCount; i++) {
+            int child = tree->childIndices[flat->childStart + i];
+            if (IsNodePurchased(tower, child)) {
+                index = child;
+                descended = true;
+                break;
             }
         }
     }
-    UpgradeNode* child = node->firstChild;
-    while (child != NULL) {
-        UpdateAllNodesRecursive(child, tower);
-        child = child->nextSibling; 
+    const FlatUpgradeNode *current = &tree->nodes[index];
+    if (IsNodePurchased(tower, index) || current->parent < 0) {
+        return current->node;
     }
+    return tree->nodes[current->parent].node;
 }
 
 /* I.S. : Status setiap node di dalam 'tree' mungkin tidak sesuai dengan upgrade yang dimiliki 'tower'.
    F.S. : Status (LOCKED, UNLOCKED, PURCHASED) dari setiap node di dalam 'tree' telah diperbarui
-          untuk secara akurat merefleksikan upgrade yang sudah dibeli oleh 'tower'. */
+          untuk secara akurat merefleksikan upgrade yang sudah dibeli oleh 'tower'.
+          Node diproses dalam urutan pre-order, sehingga status parent selalu sudah diperbarui. */
 void UpdateUpgradeTreeStatus(TowerUpgradeTree *tree, const Tower *tower)
 {
     if (!tree || !tree->root || !tower) {
         TraceLog(LOG_WARNING, "UpdateUpgradeTreeStatus: Invalid parameters provided.");
         return;
     }
-    
-    UpdateAllNodesRecursive(tree->root, tower);
+    if (tree->nodeCount == 0 && !CompileUpgradeTree(tree)) {
+        return;
+    }
+
+    for (int i = 0; i < tree->nodeCount; i++) {
+        const FlatUpgradeNode *flat = &tree->nodes[i];
+        UpgradeNode *node = flat->node;
+        if (IsNodePurchased(tower, i)) {
+            node->status = UPGRADE_PURCHASED;
+        } else if (flat->parent < 0) {
+            node->status = UPGRADE_PURCHASED; 
+        } else if (tree->nodes[flat->parent].node->status != UPGRADE_PURCHASED) {
+            node->status = UPGRADE_LOCKED; 
+        } else if (IsExclusiveSiblingPurchased(tree, i, tower)) {
+            node->status = UPGRADE_LOCKED_EXCLUDED; 
+        } else {
+            node->status = UPGRADE_UNLOCKED; 
+        }
+    }
 }
 
 /* I.S. : Tampilan menu orbit bisa berada di level mana pun dalam pohon upgrade.
@@ -291,7 +460,8 @@ void NavigateUpgradeOrbit(UpgradeNode *targetNode)
     TraceLog(LOG_INFO, "Navigated to orbit node: %s", targetNode->name);
 }
 
-UpgradeNode* FindNodeByType(UpgradeNode* startNode, UpgradeType type) {
+// Penelusuran pohon pointer, dipakai untuk node yang tidak ada di pohon pipih 'tower1UpgradeTree'.
+static UpgradeNode* FindNodeByType_Recursive(UpgradeNode* startNode, UpgradeType type) {
     if (!startNode) {
         return NULL;
     }
@@ -302,7 +472,7 @@ UpgradeNode* FindNodeByType(UpgradeNode* startNode, UpgradeType type) {
     UpgradeNode* foundNode = NULL;
     UpgradeNode* child = startNode->firstChild;
     while (child != NULL) {
-        foundNode = FindNodeByType(child, type);
+        foundNode = FindNodeByType_Recursive(child, type);
         if (foundNode) {
             return foundNode; 
         }
@@ -312,145 +482,290 @@ UpgradeNode* FindNodeByType(UpgradeNode* startNode, UpgradeType type) {
     return NULL; 
 }
 
-/* I.S. : 'tower' memiliki status (damage, speed, dll.) sebelum upgrade.
-   F.S. : 'tower' telah dimodifikasi sesuai dengan efek dari upgrade 'type'.
-          Contoh: damage bertambah, atau properti boolean seperti 'hasChainAttack' menjadi true. */
-void ApplyUpgradeEffect(Tower *tower, UpgradeType type)
-{
-    if (!tower) return;
-    
-    if (type < MAX_UPGRADE_TYPES) {
-        tower->purchasedUpgrades[type] = true;
+/* I.S. : 'startNode' adalah akar dari sebuah (sub)pohon 'tower1UpgradeTree', boleh NULL.
+   F.S. : Mengirimkan pointer ke node bertipe 'type' di dalam subtree 'startNode',
+          atau NULL jika tidak ditemukan. */
+UpgradeNode* FindNodeByType(UpgradeNode* startNode, UpgradeType type) {
+    const FlatUpgradeNode *start = FlatNodeOf(&tower1UpgradeTree, startNode);
+    if (!start) {
+        return FindNodeByType_Recursive(startNode, type);
     }
-    
-    UpgradeNode* appliedNode = FindNodeByType(GetUpgradeTreeRoot(&tower1UpgradeTree), type);
-    TraceLog(LOG_INFO, "Applying upgrade %d to tower at (%d,%d).", type, tower->row, tower->col);
-    
-    switch (type)
+    UpgradeNode *node = FindUpgradeNodeByType(&tower1UpgradeTree, type);
+    if (!node || node->flatIndex < startNode->flatIndex || node->flatIndex >= start->subtreeEnd) {
+        return NULL;
+    }
+    return node;
+}
+
+// Menerapkan efek 'node' ke 's'. Efek tier 2 dan 3 bergantung pada efek parent-nya,
+// sehingga node harus diterapkan dalam urutan pre-order.
+static void ApplyNodeToStats(TowerStats *s, const UpgradeNode *node)
+{
+    switch (node->type)
     {
         case UPGRADE_ATTACK_SPEED_BASE:
-            SetTowerAttackSpeed(tower, GetTowerAttackSpeed(tower) * 0.8f); 
+            s->attackSpeed *= 0.8f; 
             break;
         case UPGRADE_ATTACK_POWER_BASE:
-            SetTowerDamage(tower, GetTowerDamage(tower) + 15);
-            break;
-        case UPGRADE_SPECIAL_EFFECT_BASE:        
+            s->damage += 15;
             break;
         case UPGRADE_LIGHTNING_ATTACK:
-            SetTowerAttackSpeed(tower, GetTowerAttackSpeed(tower) * 0.7f);
-            tower->texture = tower2Texture; 
+            s->attackSpeed *= 0.7f;
+            s->visualTier = 1; 
             break;
         case UPGRADE_CHAIN_ATTACK:
-            tower->hasChainAttack = true; 
-            tower->chainJumps = 2; 
-            tower->chainRange = 100.0f; 
-            tower->texture = tower2Texture; 
-            SetTowerDamage(tower, GetTowerDamage(tower) * 0.8f); 
+            s->hasChainAttack = true; 
+            s->chainJumps = 2; 
+            s->chainRange = 100.0f; 
+            s->visualTier = 1; 
+            s->damage = (int)(s->damage * 0.8f); 
             break;
         case UPGRADE_AREA_ATTACK:
-            tower->hasAreaAttack = true; 
-            tower->areaAttackRadius = 60.0f; 
-            tower->texture = tower2Texture; 
-            SetTowerDamage(tower, GetTowerDamage(tower) * 0.7f); 
+            s->hasAreaAttack = true; 
+            s->areaAttackRadius = 60.0f; 
+            s->visualTier = 1; 
+            s->damage = (int)(s->damage * 0.7f); 
             break;
         case UPGRADE_CRITICAL_ATTACK:
-            tower->critChance = 15; 
-            tower->critMultiplier = 2.0f; 
-            tower->texture = tower2Texture; 
+            s->critChance = 15; 
+            s->critMultiplier = 2.0f; 
+            s->visualTier = 1; 
             break;
         case UPGRADE_LETHAL_POISON:
-            SetTowerDamage(tower, GetTowerDamage(tower) + 5);
-            tower->texture = tower2Texture; 
+            s->damage += 5;
+            s->visualTier = 1; 
             break;
         case UPGRADE_MASS_SLOW:
-            tower->hasAreaAttack = true; 
-            tower->areaAttackRadius = 80.0f;
-            tower->texture = tower2Texture; 
-            SetTowerDamage(tower, GetTowerDamage(tower) * 0.5f); 
+            s->hasAreaAttack = true; 
+            s->areaAttackRadius = 80.0f;
+            s->visualTier = 1; 
+            s->damage = (int)(s->damage * 0.5f); 
             break;
         case UPGRADE_STUN_EFFECT:
-            tower->hasStunEffect = true; 
-            tower->stunChance = 20.0f; 
-            tower->stunDuration = 0.5f; 
-            tower->texture = tower3Texture; 
+            s->hasStunEffect = true; 
+            s->stunChance = 20.0f; 
+            s->stunDuration = 0.5f; 
+            s->visualTier = 2; 
             break;
         case UPGRADE_WIDE_CHAIN_RANGE: 
-            if (tower->hasChainAttack) {
-                tower->chainJumps += 2; 
-                tower->chainRange *= 1.5f; 
-                tower->texture = tower3Texture; 
+            if (s->hasChainAttack) {
+                s->chainJumps += 2; 
+                s->chainRange *= 1.5f; 
+                s->visualTier = 2; 
             }
             break;
         case UPGRADE_LARGE_AOE_RADIUS: 
-            if (tower->hasAreaAttack) {
-                tower->areaAttackRadius *= 1.6f; 
-                tower->texture = tower3Texture; 
+            if (s->hasAreaAttack) {
+                s->areaAttackRadius *= 1.6f; 
+                s->visualTier = 2; 
             }
             break;
         case UPGRADE_HIGH_CRIT_CHANCE: 
-            if (tower->critChance > 0) {
-                tower->critChance += 20; 
-                tower->critMultiplier += 0.5f;
-                tower->texture = tower3Texture; 
+            if (s->critChance > 0) {
+                s->critChance += 20; 
+                s->critMultiplier += 0.5f;
+                s->visualTier = 2; 
             }
             break;
+        default:
+            break;
+    }
 
-        
-        case UPGRADE_NONE: 
-            
+    switch (node->effectType) {
+        case EFFECT_GENERIC_STATS:
+            s->damage += node->bonusData.generic.damage;
+            s->range += node->bonusData.generic.range;
+            s->attackSpeed *= (1.0f - node->bonusData.generic.attack_speed_percent);
+            break;
+        case EFFECT_CHAIN_MODIFIER:
+            if (s->hasChainAttack) {
+                s->chainJumps += node->bonusData.chain.jumps;
+                s->chainRange *= (1.0f + node->bonusData.chain.range_percent);
+            }
             break;
+        case EFFECT_CRIT_MODIFIER:
+            if (s->critChance > 0) {
+                s->critChance += node->bonusData.crit.chance;
+                s->critMultiplier += node->bonusData.crit.multiplier;
+            }
+            break;
+        case EFFECT_STUN_MODIFIER:
+            if (s->hasStunEffect) {
+                s->stunChance += node->bonusData.stun.chance;
+                s->stunDuration += node->bonusData.stun.duration;
+            }
+            break;
+        case EFFECT_AREA_MODIFIER:
+            if (s->hasAreaAttack) {
+                s->areaAttackRadius *= (1.0f + node->bonusData.area.radius_percent);
+            }
+            break;
+        case EFFECT_NONE:
         default:
-            
-            
             break;
     }
-    if (appliedNode) {
-        
-        switch (appliedNode->effectType) {
-            case EFFECT_GENERIC_STATS:
-                tower->damage += appliedNode->bonusData.generic.damage;
-                tower->range += appliedNode->bonusData.generic.range;
-                
-                tower->attackSpeed *= (1.0f - appliedNode->bonusData.generic.attack_speed_percent);
-                break;
-            case EFFECT_CHAIN_MODIFIER:
-                
-                if (tower->hasChainAttack) {
-                    tower->chainJumps += appliedNode->bonusData.chain.jumps;
-                    
-                    tower->chainRange *= (1.0f + appliedNode->bonusData.chain.range_percent);
-                }
-                break;
-            case EFFECT_CRIT_MODIFIER:
-                
-                if (tower->critChance > 0) {
-                    tower->critChance += appliedNode->bonusData.crit.chance;
-                    tower->critMultiplier += appliedNode->bonusData.crit.multiplier;
-                }
-                break;
-            case EFFECT_STUN_MODIFIER:
-                
-                if (tower->hasStunEffect) {
-                    tower->stunChance += appliedNode->bonusData.stun.chance;
-                    tower->stunDuration += appliedNode->bonusData.stun.duration;
-                }
-                break;
-            
-            case EFFECT_AREA_MODIFIER:
-                
-                if (tower->hasAreaAttack) {
-                    tower->areaAttackRadius *= (1.0f + appliedNode->bonusData.area.radius_percent);
-                }
-                break;
-            case EFFECT_NONE:
-            default:
-                
-                break;
+    if (s->visualTier == 1 && node->effectType != EFFECT_NONE) {
+        s->visualTier = 2;
+    }
+    s->upgradeCost += node->cost;
+}
+
+/* Mengirimkan stat efektif tower dengan bitset upgrade 'bits' ('wordCount' word) di 'tower1UpgradeTree'.
+   Stat dasar diambil dari konstanta TOWER_BASE_*, lalu efek setiap node yang dibeli diterapkan
+   dalam urutan pre-order, sehingga hasilnya tidak bergantung pada urutan pembelian. */
+TowerStats ComputeTowerStats(const uint64_t *bits, int wordCount)
+{
+    TowerStats stats = {0};
+    stats.damage = TOWER_BASE_DAMAGE;
+    stats.range = TOWER_BASE_RANGE;
+    stats.attackSpeed = TOWER_BASE_ATTACK_SPEED;
+
+    const TowerUpgradeTree *tree = &tower1UpgradeTree;
+    for (int w = 0; w < wordCount && w < tree->bitsetWords; w++) {
+        uint64_t word = bits[w];
+        while (word != 0) {
+            int bit = 0;
+            while (((word >> bit) & 1u) == 0) bit++;
+            word &= word - 1;
+            int index = w * 64 + bit;
+            if (index < tree->nodeCount) ApplyNodeToStats(&stats, tree->nodes[index].node);
         }
-        if (tower->texture.id == tower2Texture.id && appliedNode->effectType != EFFECT_NONE) {
-            tower->texture = tower3Texture;
+    }
+    return stats;
+}
+
+/* Cache stat per kombinasi upgrade, berupa tabel hash open addressing. Kunci setiap entri adalah
+   bitset dengan panjang 'tower1UpgradeTree.bitsetWords' word, disimpan berurutan di 'keys'.
+   Cache dikosongkan setiap kali pohon dikompilasi ulang karena indeks node bisa berubah. */
+static struct {
+    uint64_t *keys;
+    TowerStats stats[TOWER_STATS_CACHE_SIZE];
+    bool used[TOWER_STATS_CACHE_SIZE];
+    int words;
+    int count;
+} statsCache;
+
+static uint64_t *previewBits = NULL;
+static int previewBitWords = 0;
+
+// Mengosongkan cache stat dan membebaskan kuncinya.
+static void ClearTowerStatsCache(void)
+{
+    Memory_Free(statsCache.keys);
+    statsCache.keys = NULL;
+    statsCache.words = 0;
+    statsCache.count = 0;
+    memset(statsCache.used, 0, sizeof(statsCache.used));
+}
+
+// Mengirimkan word ke-'w' bitset 'bits', dengan word di luar 'wordCount' dianggap 0.
+static uint64_t BitsetWord(const uint64_t *bits, int wordCount, int w)
+{
+    return w < wordCount ? bits[w] : 0;
+}
+
+/* Sama seperti ComputeTowerStats, tetapi hasilnya disimpan di cache per kombinasi upgrade.
+   Pointer yang dikirimkan hanya valid sampai pemanggilan berikutnya. */
+const TowerStats *GetTowerStats(const uint64_t *bits, int wordCount)
+{
+    int words = tower1UpgradeTree.bitsetWords;
+    if (statsCache.words != words || statsCache.keys == NULL) {
+        ClearTowerStatsCache();
+        if (words > 0) {
+            statsCache.keys = (uint64_t *)Memory_Alloc(MEM_TAG_UPGRADE, sizeof(uint64_t) * words * TOWER_STATS_CACHE_SIZE);
         }
+        statsCache.words = words;
+    }
+    if (statsCache.keys == NULL) {
+        static TowerStats uncached;
+        uncached = ComputeTowerStats(bits, wordCount);
+        return &uncached;
+    }
+    if (statsCache.count >= TOWER_STATS_CACHE_SIZE * 3 / 4) {
+        memset(statsCache.used, 0, sizeof(statsCache.used));
+        statsCache.count = 0;
+    }
+
+    uint64_t hash = 1469598103934665603ull;
+    for (int w = 0; w < words; w++) {
+        hash = (hash ^ BitsetWord(bits, wordCount, w)) * 1099511628211ull;
+    }
+    int slot = (int)((hash ^ (hash >> 32)) & (TOWER_STATS_CACHE_SIZE - 1));
+    while (statsCache.used[slot]) {
+        const uint64_t *key = &statsCache.keys[slot * words];
+        bool match = true;
+        for (int w = 0; w < words && match; w++) {
+            match = key[w] == BitsetWord(bits, wordCount, w);
+        }
+        if (match) return &statsCache.stats[slot];
+        slot = (slot + 1) & (TOWER_STATS_CACHE_SIZE - 1);
+    }
+
+    uint64_t *key = &statsCache.keys[slot * words];
+    for (int w = 0; w < words; w++) key[w] = BitsetWord(bits, wordCount, w);
+    statsCache.stats[slot] = ComputeTowerStats(bits, wordCount);
+    statsCache.used[slot] = true;
+    statsCache.count++;
+    return &statsCache.stats[slot];
+}
+
+/* I.S. : Field stat 'tower' mungkin tidak sesuai dengan bitset upgrade-nya.
+   F.S. : Stat, tekstur, dan 'totalCost' 'tower' diisi ulang dari GetTowerStats. */
+void RefreshTowerStats(Tower *tower)
+{
+    if (!tower) return;
+    const TowerStats *stats = GetTowerStats(tower->upgradeBits, tower->upgradeBitWords);
+    SetTowerDamage(tower, stats->damage);
+    SetTowerRange(tower, stats->range);
+    SetTowerAttackSpeed(tower, stats->attackSpeed);
+    tower->hasChainAttack = stats->hasChainAttack;
+    tower->chainJumps = stats->chainJumps;
+    tower->chainRange = stats->chainRange;
+    tower->hasAreaAttack = stats->hasAreaAttack;
+    tower->areaAttackRadius = stats->areaAttackRadius;
+    tower->hasStunEffect = stats->hasStunEffect;
+    tower->stunChance = stats->stunChance;
+    tower->stunDuration = stats->stunDuration;
+    tower->critChance = stats->critChance;
+    tower->critMultiplier = stats->critMultiplier;
+    tower->texture = stats->visualTier == 2 ? tower3Texture : (stats->visualTier == 1 ? tower2Texture : tower1Texture);
+    tower->totalCost = TOWER_BASE_COST + stats->upgradeCost;
+}
+
+/* I.S. : 'tower' dan 'node' valid.
+   F.S. : '*out' berisi stat 'tower' jika 'node' dibeli. 'tower' tidak diubah.
+          Mengembalikan false jika pratinjau tidak bisa dihitung. */
+bool PreviewTowerUpgrade(const Tower *tower, const UpgradeNode *node, TowerStats *out)
+{
+    if (!tower || !out || !FlatNodeOf(&tower1UpgradeTree, node)) return false;
+
+    int words = tower1UpgradeTree.bitsetWords;
+    if (previewBitWords < words) {
+        uint64_t *bits = (uint64_t *)Memory_Realloc(MEM_TAG_UPGRADE, previewBits, sizeof(uint64_t) * words);
+        if (!bits) return false;
+        previewBits = bits;
+        previewBitWords = words;
     }
+    for (int w = 0; w < words; w++) previewBits[w] = BitsetWord(tower->upgradeBits, tower->upgradeBitWords, w);
+    previewBits[node->flatIndex / 64] |= (uint64_t)1 << (node->flatIndex % 64);
+    *out = *GetTowerStats(previewBits, words);
+    return true;
+}
+
+/* I.S. : 'tower' memiliki status (damage, speed, dll.) sebelum upgrade.
+   F.S. : Bit upgrade 'type' diset di 'tower' dan semua stat 'tower' dihitung ulang dari
+          kombinasi upgrade yang dimilikinya. Contoh: damage bertambah, atau properti boolean
+          seperti 'hasChainAttack' menjadi true. */
+void ApplyUpgradeEffect(Tower *tower, UpgradeType type)
+{
+    if (!tower) return;
+    
+    if (!MarkTowerUpgrade(tower, type)) {
+        TraceLog(LOG_WARNING, "Upgrade %d is not part of the compiled upgrade tree; it will not be tracked.", type);
+        return;
+    }
+    TraceLog(LOG_INFO, "Applying upgrade %d to tower at (%d,%d).", type, tower->row, tower->col);
+    RefreshTowerStats(tower);
 }
 
 /* I.S. : Menu orbit upgrade sedang ditampilkan, pemain melakukan klik pada posisi 'mousePos'.
@@ -544,6 +859,31 @@ bool HandleUpgradeOrbitClick(Vector2 mousePos, float currentTileScale)
     return false;
 }
 
+/* I.S. : 'node' sedang menunggu konfirmasi pembelian untuk 'tower'.
+   F.S. : Stat yang berubah jika 'node' dibeli digambar di bawah 'anchor' (lama > baru). */
+static void DrawUpgradePreview(const Tower *tower, const UpgradeNode *node, Vector2 anchor)
+{
+    TowerStats next;
+    if (!PreviewTowerUpgrade(tower, node, &next)) return;
+    const TowerStats *now = GetTowerStats(tower->upgradeBits, tower->upgradeBitWords);
+
+    char lines[7][40];
+    int count = 0;
+    if (next.damage != now->damage) snprintf(lines[count++], sizeof(lines[0]), "DMG %d > %d", now->damage, next.damage);
+    if (next.attackSpeed != now->attackSpeed) snprintf(lines[count++], sizeof(lines[0]), "SPD %.2fs > %.2fs", now->attackSpeed, next.attackSpeed);
+    if (next.range != now->range) snprintf(lines[count++], sizeof(lines[0]), "RNG %.0f > %.0f", now->range, next.range);
+    if (next.chainJumps != now->chainJumps) snprintf(lines[count++], sizeof(lines[0]), "CHAIN %d > %d", now->chainJumps, next.chainJumps);
+    if (next.areaAttackRadius != now->areaAttackRadius) snprintf(lines[count++], sizeof(lines[0]), "AOE %.0f > %.0f", now->areaAttackRadius, next.areaAttackRadius);
+    if (next.critChance != now->critChance) snprintf(lines[count++], sizeof(lines[0]), "CRIT %.0f%% > %.0f%%", now->critChance, next.critChance);
+    if (next.stunChance != now->stunChance) snprintf(lines[count++], sizeof(lines[0]), "STUN %.0f%% > %.0f%%", now->stunChance, next.stunChance);
+
+    int fontSize = 12;
+    for (int i = 0; i < count; i++) {
+        int textWidth = MeasureText(lines[i], fontSize);
+        DrawText(lines[i], (int)(anchor.x - textWidth / 2), (int)(anchor.y + i * (fontSize + 2)), fontSize, SKYBLUE);
+    }
+}
+
 /* I.S. : State untuk menu orbit upgrade (seperti 'currentOrbitParentNode') telah diatur.
    F.S. : Seluruh antarmuka pengguna (UI) untuk menu orbit, termasuk tombol-tombol skill,
           ikon status, dan tombol kembali, telah digambar ke layar. */
@@ -659,6 +999,8 @@ void DrawUpgradeOrbitMenu(float currentTileScale, float mapScreenOffsetX, float
             iconSize 
         };
         DrawTexturePro(acceptIconTex, (Rectangle){0,0, (float)acceptIconTex.width, (float)acceptIconTex.height}, destRect, (Vector2){0,0}, 0.0f, WHITE);
+        DrawUpgradePreview(selectedTowerForDeletion, pendingUpgradeNode,
+                           (Vector2){ pendingUpgradeIconPos.x, destRect.y + destRect.height + 4 });
     }
 }
 
@@ -676,16 +1018,23 @@ static void FreeUpgradeNode(UpgradeNode *node)
         child = next;
     }
     if (node->type >= 100) {
-        free((void*)node->name);
-        free((void*)node->description);
+        Memory_Free((void*)node->name);
+        Memory_Free((void*)node->description);
     }
-    free(node);
+    Memory_Free(node);
 }
 
 /* I.S. : 'tree' mungkin menunjuk ke sebuah pohon upgrade yang valid.
-   F.S. : Semua memori yang dialokasikan untuk setiap node di dalam 'tree' telah dibebaskan.
+   F.S. : Semua memori yang dialokasikan untuk setiap node dan pohon pipih 'tree' telah dibebaskan.
           'tree->root' diatur menjadi NULL. */
 void FreeUpgradeTree(TowerUpgradeTree* tree) {
+    if (tree) {
+        ClearFlatUpgradeTree(tree);
+        ClearTowerStatsCache();
+        Memory_Free(previewBits);
+        previewBits = NULL;
+        previewBitWords = 0;
+    }
     if (tree && tree->root) {
         FreeUpgradeNode(tree->root);
         tree->root = NULL;
@@ -705,6 +1054,10 @@ UpgradeNode *GetNthChild(UpgradeNode *parent, int n)
     if (!parent || n < 0) {
         return NULL;
     }
+    const FlatUpgradeNode *flat = FlatNodeOf(&tower1UpgradeTree, parent);
+    if (flat) {
+        return n < flat->childCount ? tower1UpgradeTree.nodes[tower1UpgradeTree.childIndices[flat->childStart + n]].node : NULL;
+    }
     UpgradeNode* currentChild = parent->firstChild;
     int count = 0;
 
@@ -723,6 +1076,8 @@ UpgradeNode *GetNthChild(UpgradeNode *parent, int n)
 int GetNumChildren(UpgradeNode *node)
 {
     if (!node) return 0;
+    const FlatUpgradeNode *flat = FlatNodeOf(&tower1UpgradeTree, node);
+    if (flat) return flat->childCount;
 
     int count = 0;
     UpgradeNode* child = node->firstChild;
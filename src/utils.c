@@ -8,37 +8,44 @@
 
 #include "utils.h"
 #include <string.h>
+#include "trace.h"
 
 /* I.S. : filePath adalah path ke sebuah file gambar.
    F.S. : Mengembalikan Texture2D yang valid jika file berhasil dimuat. 
           Jika file tidak ada atau gagal dimuat, mengembalikan Texture2D kosong ({0}) 
-          dan mencatat sebuah peringatan (warning). */
-Texture2D LoadTextureSafe(const char *filePath) {
+          dan mencatat sebuah peringatan (warning).
+          Tekstur yang berhasil dimuat dicatat di Memory Tracker atas nama 'tag'. */
+Texture2D LoadTextureSafe(MemoryTag tag, const char *filePath) {
     Texture2D texture = {0};
     if (filePath == NULL || !FileExists(filePath)) {
         TraceLog(LOG_WARNING, "Failed to load texture: File %s not found or invalid path.", filePath ? filePath : "NULL");
         return texture;
     }
 
+    TRACE_BEGIN("LoadTextureSafe");
+
     texture = LoadTexture(filePath);
     if (texture.id == 0) {
         TraceLog(LOG_WARNING, "Failed to load texture from %s: Invalid texture ID.", filePath);
     } else {
+        Memory_TrackTexture(tag, texture);
         TraceLog(LOG_INFO, "Texture loaded successfully from %s.", filePath);
     }
+    TRACE_END("LoadTextureSafe");
 
     return texture;
 }
 
 /* I.S. : texture adalah pointer ke sebuah Texture2D yang mungkin valid atau tidak.
-   F.S. : Jika tekstur valid, memorinya dibebaskan dan pointernya di-reset. 
-          Jika tidak valid, tidak terjadi apa-apa selain mencatat peringatan. */
+   F.S. : Jika tekstur valid, memorinya dibebaskan, catatannya di Memory Tracker dihapus,
+          dan pointernya di-reset. Jika tidak valid, tidak terjadi apa-apa selain mencatat peringatan. */
 void UnloadTextureSafe(Texture2D *texture) {
     if (texture == NULL || texture->id == 0) {
         TraceLog(LOG_WARNING, "Attempted to unload invalid or NULL texture.");
         return;
     }
 
+    Memory_UntrackTexture(*texture);
     UnloadTexture(*texture);
     *texture = (Texture2D){0};
     TraceLog(LOG_INFO, "Texture unloaded successfully.");
@@ -0,0 +1,191 @@
+/* File        : wave_script.c
+* Deskripsi   : Implementasi untuk modul Wave Script.
+*               Tabel spawn berisi musuh semua wave secara berurutan; 'waveStart[w - 1]' adalah
+*               indeks musuh pertama wave w dan 'waveStart[w]' adalah batas akhirnya. Nilai acak
+*               (kecepatan dan archetype campuran) diambil saat kompilasi.
+* Dibuat oleh : Ahmad Riyadh Almaliki
+* Perubahan terakhir : Senin, 19 Oktober 2026
+*/
+
+#include "wave_script.h"
+#include "enemy.h"
+#include "memory_tracker.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+
+#define WAVE_ENEMY_MIXED_NAME "mixed"
+
+static struct {
+    WaveSpawnEntry *entries;
+    int *waveStart;
+    int waveCount;
+} table;
+
+// Mengirimkan nama jenis musuh 'enemyType' untuk ditulis ke file peta.
+static const char *EnemyTypeName(int enemyType) {
+    return enemyType == WAVE_ENEMY_MIXED ? WAVE_ENEMY_MIXED_NAME : GetEnemyArchetype(enemyType)->name;
+}
+
+// Mengirimkan jumlah grup skrip untuk wave 'waveNum'.
+static int CountGroupsForWave(const WaveScript *script, int waveNum) {
+    int count = 0;
+    for (int i = 0; script && i < script->groupCount; i++) {
+        if (script->groups[i].wave == waveNum) count++;
+    }
+    return count;
+}
+
+// Mengirimkan jumlah musuh wave 'waveNum' setelah dikompilasi.
+static int CountEnemiesForWave(const WaveScript *script, int waveNum) {
+    if (CountGroupsForWave(script, waveNum) == 0) return 5 + (waveNum - 1);
+    int count = 0;
+    for (int i = 0; i < script->groupCount; i++) {
+        if (script->groups[i].wave == waveNum) count += script->groups[i].count;
+    }
+    return count;
+}
+
+// Mengisi 'entry' dengan musuh wave 'waveNum' dari 'group', atau komposisi bawaan jika 'group' NULL.
+// HP dan kecepatan dasar diambil dari archetype, lalu ditambah bonus per wave dan dikali pengali grup.
+static void FillEntry(WaveSpawnEntry *entry, int waveNum, const WaveGroup *group) {
+    float hpMultiplier = group ? group->hpMultiplier : 1.0f;
+    float speedMultiplier = group ? group->speedMultiplier : 1.0f;
+    int enemyType = group ? group->enemyType : WAVE_ENEMY_MIXED;
+
+    entry->archetype = enemyType == WAVE_ENEMY_MIXED ? rand() % ENEMY_ARCHETYPE_COUNT : enemyType;
+    const EnemyArchetype *archetype = GetEnemyArchetype(entry->archetype);
+    entry->delay = group ? group->spacing : SPAWN_DELAY;
+    entry->maxHp = (int)((archetype->baseHp + (waveNum - 1) * 10) * hpMultiplier + 0.5f);
+    if (entry->maxHp < 1) entry->maxHp = 1;
+    entry->baseSpeed = (archetype->baseSpeed + (waveNum * 3.0f) + (rand() % 20)) * speedMultiplier;
+}
+
+/* I.S. : 'script' sembarang.
+   F.S. : 'script' kosong (semua wave memakai komposisi bawaan). */
+void WaveScript_Init(WaveScript *script) {
+    script->groupCount = 0;
+}
+
+/* I.S. : 'script' berisi baris-baris yang sudah dibaca.
+   F.S. : Jika 'line' adalah baris "wave ...", isinya ditambahkan ke 'script' dan fungsi
+          mengembalikan true (baris yang tidak valid dilewati dengan peringatan). Baris lain
+          tidak mengubah 'script' dan fungsi mengembalikan false. */
+bool WaveScript_ParseLine(WaveScript *script, const char *line) {
+    if (strncmp(line, "wave ", 5) != 0) return false;
+
+    WaveGroup group;
+    char typeName[16];
+    if (sscanf(line, "wave %d %15s %d %f %f %f", &group.wave, typeName, &group.count,
+               &group.spacing, &group.hpMultiplier, &group.speedMultiplier) != 6) {
+        TraceLog(LOG_WARNING, "WAVE_SCRIPT: Ignoring malformed line: %s", line);
+        return true;
+    }
+    bool mixed = strcmp(typeName, WAVE_ENEMY_MIXED_NAME) == 0;
+    group.enemyType = mixed ? WAVE_ENEMY_MIXED : FindEnemyArchetype(typeName);
+    if ((!mixed && group.enemyType < 0) || group.wave < 1 || group.wave > WAVE_SCRIPT_MAX_WAVES || group.count < 1 ||
+        group.spacing < 0.0f || group.hpMultiplier <= 0.0f || group.speedMultiplier <= 0.0f) {
+        TraceLog(LOG_WARNING, "WAVE_SCRIPT: Ignoring invalid line: %s", line);
+        return true;
+    }
+    if (script->groupCount >= MAX_WAVE_GROUPS) {
+        TraceLog(LOG_WARNING, "WAVE_SCRIPT: Ignoring line, limit is %d groups: %s", MAX_WAVE_GROUPS, line);
+        return true;
+    }
+    if (group.count > WAVE_GROUP_MAX_COUNT) group.count = WAVE_GROUP_MAX_COUNT;
+    script->groups[script->groupCount++] = group;
+    return true;
+}
+
+/* I.S. : 'file' terbuka untuk ditulis.
+   F.S. : Semua baris 'script' ditulis ke 'file' dalam format yang dibaca WaveScript_ParseLine. */
+void WaveScript_Write(const WaveScript *script, FILE *file) {
+    for (int i = 0; i < script->groupCount; i++) {
+        const WaveGroup *g = &script->groups[i];
+        fprintf(file, "wave %d %s %d %.2f %.2f %.2f\n", g->wave, EnemyTypeName(g->enemyType), g->count,
+                g->spacing, g->hpMultiplier, g->speedMultiplier);
+    }
+}
+
+/* Mengirimkan nomor wave terbesar yang disebut di 'script', atau 0 jika kosong. */
+int WaveScript_GetMaxWave(const WaveScript *script) {
+    int maxWave = 0;
+    for (int i = 0; script && i < script->groupCount; i++) {
+        if (script->groups[i].wave > maxWave) maxWave = script->groups[i].wave;
+    }
+    return maxWave;
+}
+
+/* I.S. : Tabel spawn level sebelumnya mungkin masih ada.
+   F.S. : 'script' dikompilasi menjadi tabel spawn untuk wave 1..'waveCount' (diperbesar sampai
+          wave terbesar di skrip, dibatasi WAVE_SCRIPT_MAX_WAVES). 'script' boleh NULL.
+          Mengembalikan false jika tabel terlalu besar atau alokasi gagal. */
+bool WaveScript_Compile(const WaveScript *script, int waveCount) {
+    WaveScript_Clear();
+    int maxWave = WaveScript_GetMaxWave(script);
+    if (waveCount < maxWave) waveCount = maxWave;
+    if (waveCount < 1) waveCount = 1;
+    if (waveCount > WAVE_SCRIPT_MAX_WAVES) waveCount = WAVE_SCRIPT_MAX_WAVES;
+
+    table.waveStart = (int *)Memory_Alloc(MEM_TAG_WAVE, sizeof(int) * (waveCount + 1));
+    if (table.waveStart == NULL) {
+        TraceLog(LOG_ERROR, "WAVE_SCRIPT: Failed to allocate wave index for %d waves.", waveCount);
+        return false;
+    }
+    size_t total = 0;
+    table.waveStart[0] = 0;
+    for (int w = 1; w <= waveCount; w++) {
+        total += (size_t)CountEnemiesForWave(script, w);
+        if (total > INT_MAX || total > SIZE_MAX / sizeof(WaveSpawnEntry)) {
+            TraceLog(LOG_ERROR, "WAVE_SCRIPT: Spawn table for %d waves is too large.", waveCount);
+            WaveScript_Clear();
+            return false;
+        }
+        table.waveStart[w] = (int)total;
+    }
+    table.entries = (WaveSpawnEntry *)Memory_Alloc(MEM_TAG_WAVE, sizeof(WaveSpawnEntry) * table.waveStart[waveCount]);
+    if (table.entries == NULL) {
+        TraceLog(LOG_ERROR, "WAVE_SCRIPT: Failed to allocate spawn table with %d entries.", table.waveStart[waveCount]);
+        WaveScript_Clear();
+        return false;
+    }
+
+    for (int w = 1; w <= waveCount; w++) {
+        WaveSpawnEntry *entry = &table.entries[table.waveStart[w - 1]];
+        if (CountGroupsForWave(script, w) == 0) {
+            for (int i = 0; i < 5 + (w - 1); i++) FillEntry(entry++, w, NULL);
+            continue;
+        }
+        for (int g = 0; g < script->groupCount; g++) {
+            const WaveGroup *group = &script->groups[g];
+            if (group->wave != w) continue;
+            for (int i = 0; i < group->count; i++) FillEntry(entry++, w, group);
+        }
+    }
+    table.waveCount = waveCount;
+    TraceLog(LOG_INFO, "WAVE_SCRIPT: Compiled %d waves (%d scripted groups) into %d spawn entries.",
+             waveCount, script ? script->groupCount : 0, table.waveStart[waveCount]);
+    return true;
+}
+
+/* Mengirimkan jumlah musuh wave 'waveNum' dan mengisi '*entries' dengan awal potongan tabelnya.
+   Wave di luar tabel memakai wave terakhir yang dikompilasi (peta tanpa batas wave). */
+int WaveScript_GetWave(int waveNum, const WaveSpawnEntry **entries) {
+    *entries = NULL;
+    if (table.waveCount == 0) return 0;
+    if (waveNum < 1) waveNum = 1;
+    if (waveNum > table.waveCount) waveNum = table.waveCount;
+    *entries = &table.entries[table.waveStart[waveNum - 1]];
+    return table.waveStart[waveNum] - table.waveStart[waveNum - 1];
+}
+
+/* I.S. : Tabel spawn mungkin ada.
+   F.S. : Tabel spawn dibebaskan. */
+void WaveScript_Clear(void) {
+    Memory_Free(table.entries);
+    Memory_Free(table.waveStart);
+    table.entries = NULL;
+    table.waveStart = NULL;
+    table.waveCount = 0;
+}